@@ -0,0 +1,37 @@
+"""Reports the iteration counts of the candidate optimizations.
+
+Usage: python benchmarks/iterations.py [num_cells]
+"""
+import sys
+import numpy as np
+import auguste
+
+
+def main():
+    n = int(sys.argv[1]) if len(sys.argv) > 1 else 20
+    rng = np.random.RandomState(0)
+
+    fcc = np.array([[0, 1, 1], [1, 0, 1], [1, 1, 0]], dtype=float)
+    skew = np.eye(3) + np.triu(rng.randint(-6, 7, (n, 3, 3)), 1)
+    sets = [("near", np.eye(3) + rng.uniform(-0.02, 0.02, (n, 3, 3))),
+            ("sheared", skew @ (fcc + rng.uniform(-0.05, 0.05, (n, 3, 3)))),
+            ("random", rng.uniform(-1, 1, (n, 3, 3)))]
+
+    keys = ["stepwise_iterations", "accelerated_steps", "newton_iterations"]
+    print("%-8s %12s %12s %12s  (per candidate)" % ("", "stepwise",
+                                                   "accelerated", "newton"))
+    for name, cells in sets:
+        evaluated = 0
+        totals = np.zeros(len(keys))
+        for cell in cells:
+            for bravais_type in auguste.names:
+                info = auguste.symmetrize_lattice(cell, bravais_type,
+                                                  return_info=True)[2]
+                evaluated += info["evaluated"]
+                totals += [info[key] for key in keys]
+        counts = tuple(totals / evaluated)
+        print("%-8s %12.2f %12.2f %12.2f" % ((name,) + counts))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,42 @@
+"""Times Minkowski reduction of random and nearly-degenerate cells.
+
+Usage: python benchmarks/minkowski_reduction.py [num_cells]
+"""
+import sys
+import time
+import numpy as np
+from auguste import minkowski_reduce
+
+
+def time_cells(cells, repeats=3):
+    best = np.inf
+    for _ in range(repeats):
+        start = time.perf_counter()
+        for cell in cells:
+            minkowski_reduce(cell)
+        best = min(best, time.perf_counter() - start)
+    return 1E6 * best / len(cells)
+
+
+def main():
+    n = int(sys.argv[1]) if len(sys.argv) > 1 else 2000
+    rng = np.random.RandomState(0)
+
+    random_cells = rng.uniform(-1, 1, (n, 3, 3))
+
+    # skewed cells require many reduction steps
+    skew = np.eye(3) + np.triu(rng.randint(-20, 21, (n, 3, 3)), 1)
+    skewed_cells = skew @ random_cells
+
+    # cells with (nearly) equal norms, which trigger the cycle detection
+    fcc = np.array([[0, 1, 1], [1, 0, 1], [1, 1, 0]], dtype=float)
+    tied_cells = fcc + 1E-9 * rng.uniform(-1, 1, (n, 3, 3))
+
+    for name, cells in [("random", random_cells),
+                        ("skewed", skewed_cells),
+                        ("tied", tied_cells)]:
+        print("%-8s %8.2f us/cell" % (name, time_cells(cells)))
+
+
+if __name__ == "__main__":
+    main()
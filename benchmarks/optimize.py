@@ -0,0 +1,35 @@
+"""Times the symmetrization to each Bravais type on a single thread.
+
+Usage: python benchmarks/optimize.py [num_cells]
+"""
+import sys
+import time
+import numpy as np
+import auguste
+
+
+def main():
+    n = int(sys.argv[1]) if len(sys.argv) > 1 else 50
+    rng = np.random.RandomState(0)
+    cells = rng.uniform(-1, 1, (n, 3, 3))
+
+    previous = auguste.get_num_threads()
+    auguste.set_num_threads(1)
+    try:
+        total = 0
+        for name in auguste.names:
+            best = float("inf")
+            for repeat in range(3):
+                start = time.perf_counter()
+                for cell in cells:
+                    auguste.symmetrize_lattice(cell, name)
+                best = min(best, time.perf_counter() - start)
+            total += best
+            print("%-26s %8.1f us/cell" % (name, 1E6 * best / n))
+        print("%-26s %8.1f us/cell" % ("total", 1E6 * total / n))
+    finally:
+        auguste.set_num_threads(previous)
+
+
+if __name__ == "__main__":
+    main()
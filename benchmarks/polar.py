@@ -0,0 +1,33 @@
+"""Compares auguste.polar_decompose with scipy.linalg.polar.
+
+Usage: python benchmarks/polar.py [num_matrices]
+"""
+import sys
+import time
+import numpy as np
+import scipy.linalg
+import auguste
+
+
+def main():
+    n = int(sys.argv[1]) if len(sys.argv) > 1 else 100000
+    rng = np.random.RandomState(0)
+    F = np.eye(3) + 0.1 * rng.normal(size=(n, 3, 3))
+
+    start = time.perf_counter()
+    U, P = auguste.polar_decompose(F)
+    elapsed = time.perf_counter() - start
+
+    m = min(n, 2000)
+    start = time.perf_counter()
+    expected = [scipy.linalg.polar(f) for f in F[:m]]
+    elapsed_scipy = time.perf_counter() - start
+
+    error = max(np.abs(U[:m] - np.array([u for u, p in expected])).max(),
+                np.abs(P[:m] - np.array([p for u, p in expected])).max())
+    print("auguste %8.3f us/matrix  scipy %8.3f us/matrix  max difference %.2e" % (
+          1E6 * elapsed / n, 1E6 * elapsed_scipy / m, error))
+
+
+if __name__ == "__main__":
+    main()
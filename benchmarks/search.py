@@ -0,0 +1,34 @@
+"""Times the correspondence search for all Bravais types.
+
+Usage: python benchmarks/search.py [num_cells]
+"""
+import sys
+import time
+import numpy as np
+import auguste
+
+
+def main():
+    n = int(sys.argv[1]) if len(sys.argv) > 1 else 20
+    rng = np.random.RandomState(0)
+
+    fcc = np.array([[0, 1, 1], [1, 0, 1], [1, 1, 0]], dtype=float)
+    skew = np.eye(3) + np.triu(rng.randint(-6, 7, (n, 3, 3)), 1)
+    sets = [("near", np.eye(3) + rng.uniform(-0.02, 0.02, (n, 3, 3))),
+            ("sheared", skew @ (fcc + rng.uniform(-0.05, 0.05, (n, 3, 3)))),
+            ("random", rng.uniform(-1, 1, (n, 3, 3)))]
+
+    previous = auguste.get_num_threads()
+    auguste.set_num_threads(1)
+    try:
+        for name, cells in sets:
+            start = time.perf_counter()
+            auguste.calculate_vectors(cells)
+            elapsed = time.perf_counter() - start
+            print("%-8s %8.2f ms/cell" % (name, 1E3 * elapsed / n))
+    finally:
+        auguste.set_num_threads(previous)
+
+
+if __name__ == "__main__":
+    main()
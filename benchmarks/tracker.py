@@ -0,0 +1,53 @@
+"""Compares tracked and full searches along a smoothly deforming trajectory.
+
+Usage: python benchmarks/tracker.py [num_frames]
+"""
+import sys
+import time
+import numpy as np
+import auguste
+
+
+def trajectory(base, num_frames, rng):
+    frames = []
+    for k in range(num_frames):
+        t = k / num_frames
+        D = np.eye(3) + 0.06 * np.array([[np.sin(3 * t), 0.5 * t, 0],
+                                         [0, np.cos(5 * t) - 1, 0.3 * t],
+                                         [0.2 * np.sin(7 * t), 0, 0]])
+        frames.append(base @ D + rng.normal(0, 0.002, (3, 3)))
+    return frames
+
+
+def main():
+    n = int(sys.argv[1]) if len(sys.argv) > 1 else 100
+    rng = np.random.RandomState(0)
+
+    fcc = np.array([[0, 1, 1], [1, 0, 1], [1, 1, 0]], dtype=float)
+    hcp = np.array([[1, 0, 0], [-0.5, np.sqrt(3) / 2, 0], [0, 0, 1.6]])
+    sets = [("fcc", trajectory(fcc, n, rng)),
+            ("hcp", trajectory(hcp, n, rng)),
+            ("random", trajectory(rng.uniform(-1, 1, (3, 3)), n, rng))]
+
+    previous = auguste.get_num_threads()
+    auguste.set_num_threads(1)
+    try:
+        for name, frames in sets:
+            start = time.perf_counter()
+            full = np.array([auguste.calculate_vector(cell) for cell in frames])
+            elapsed_full = time.perf_counter() - start
+
+            tracker = auguste.Tracker()
+            start = time.perf_counter()
+            tracked = np.array([tracker.calculate_vector(cell) for cell in frames])
+            elapsed_tracked = time.perf_counter() - start
+
+            print("%-8s full %8.2f ms/frame  tracked %8.2f ms/frame  max excess %.2e" % (
+                  name, 1E3 * elapsed_full / n, 1E3 * elapsed_tracked / n,
+                  np.max(tracked - full)))
+    finally:
+        auguste.set_num_threads(previous)
+
+
+if __name__ == "__main__":
+    main()
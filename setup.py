@@ -12,6 +12,7 @@ minor_version = 1
 subminor_version = 5
 version = f'{major_version}.{minor_version}.{subminor_version}'
 extra_compile_args = []
+extra_link_args = []
 
 
 def is_platform_mac():
@@ -38,6 +39,24 @@ if is_platform_mac():
         extra_compile_args.append("-Wno-error=deprecated-declarations")
 
 
+if sys.platform != "win32":
+    # the numeric kernels set no floating-point flags or errno, and without
+    # these their lane loops are not vectorized
+    extra_compile_args += ["-std=c++11", "-pthread",
+                           "-fno-math-errno", "-fno-trapping-math"]
+    extra_link_args += ["-pthread"]
+
+
+# A test build counts the heap allocations made by the extension, which the
+# tests check are absent in steady state.  The counter replaces the global
+# allocation functions, so it is never part of a release build.
+test_sources = []
+define_macros = []
+if os.environ.get("AUGUSTE_COUNT_ALLOCATIONS"):
+    test_sources.append('src/heap_counter.cpp')
+    define_macros.append(("AUGUSTE_COUNT_ALLOCATIONS", None))
+
+
 # read the contents of README.md
 this_directory = os.path.abspath(os.path.dirname(__file__))
 with open(os.path.join(this_directory, 'README.md'), encoding='utf-8') as f:
@@ -45,22 +64,31 @@ with open(os.path.join(this_directory, 'README.md'), encoding='utf-8') as f:
 
 module = Extension(
     'auguste',
-    sources=['src/eigendecomposition.cpp',
+    sources=['src/cpu_dispatch.cpp',
+             'src/eigendecomposition.cpp',
              'src/lup_decomposition.cpp',
              'src/mahalonobis_transform.cpp',
-             'src/matrix_vector.cpp',
              'src/minkowski_reduction.cpp',
+             'src/neighbourhood_sweep.cpp',
              'src/parse_string.cpp',
              'src/polar_decomposition.cpp',
-             'src/quaternion.cpp',
              'src/sqp_newton_lagrange.cpp',
              'src/stepwise_iteration.cpp',
+             'src/strain_bound.cpp',
              'src/symmetrization.cpp',
+             'src/template_symmetry.cpp',
+             'src/thread_pool.cpp',
+             'src/two_coefficient_solver.cpp',
              'src/unimodular_functions.cpp',
-             'src/auguste_module.cpp'],
-    include_dirs=[os.path.join(numpy.get_include(), 'numpy'),
+             'src/unimodular_neighbourhood.cpp',
+             'src/visited_set.cpp',
+             'src/auguste_module.cpp'] + test_sources,
+    define_macros=define_macros,
+    include_dirs=[numpy.get_include(),
+                  os.path.join(numpy.get_include(), 'numpy'),
                   'src'],
     extra_compile_args=extra_compile_args,
+    extra_link_args=extra_link_args,
     language='c++'
 )
 
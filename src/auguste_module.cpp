@@ -24,42 +24,55 @@ SOFTWARE.*/
 #include <Python.h>
 #include <ndarraytypes.h>
 #include <arrayobject.h>
+#include <ufuncobject.h>
 #include <stdbool.h>
+#include <algorithm>
+#include <atomic>
+#include <new>
+#include <vector>
 #include "symmetrization.h"
 #include "minkowski_reduction.h"
+#include "parse_string.h"
+#include "thread_pool.h"
+#include "unimodular_neighbourhood.h"
 #include "constants.h"
+#include "polar_decomposition.h"
+#include "matrix_vector.h"
+#include "cpu_dispatch.h"
+#ifdef AUGUSTE_COUNT_ALLOCATIONS
+#include "heap_counter.h"
+#endif
 
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+#define NUM_TYPES 14
+
 static PyObject* error(PyObject* type, const char* msg)
 {
 	PyErr_SetString(type, msg);
 	return NULL;
 }
 
-static void transpose(int n, double* A)
+static const char* error_message(int ret)
 {
-	for (int i=0;i<n;i++) {
-		for (int j=i+1;j<n;j++) {
-			double temp = A[i * n + j];
-			A[i * n + j] = A[j * n + i];
-			A[j * n + i] = temp;
-		}
-	}
+	if (ret == INVALID_BRAVAIS_TYPE)
+		return "unrecognized bravais_type";
+	else if (ret == MINKOWSKI_REDUCTION_FAILURE)
+		return "Minkowski reduction failed";
+	else if (ret == SINGULAR_LATTICE_BASIS)
+		return "lattice basis is singular";
+	else if (ret == OUT_OF_MEMORY)
+		return "out of memory";
+	else
+		return "symmetrization failed";
 }
 
-static void transpose_i(int n, int* A)
+static PyObject* error_type(int ret)
 {
-	for (int i=0;i<n;i++) {
-		for (int j=i+1;j<n;j++) {
-			int temp = A[i * n + j];
-			A[i * n + j] = A[j * n + i];
-			A[j * n + i] = temp;
-		}
-	}
+	return ret == OUT_OF_MEMORY ? PyExc_MemoryError : PyExc_TypeError;
 }
 
 static bool get_unit_cell(PyObject* obj_B, double* BT)
@@ -86,12 +99,209 @@ static bool get_unit_cell(PyObject* obj_B, double* BT)
 	}
 
 	memcpy(BT, B, 9 * sizeof(double));
-	transpose(3, BT);
+	transpose<3>(BT);
 
 	Py_DECREF(obj_Bcont);
 	return true;
 }
 
+// Appends a dict of search information to a result tuple
+static PyObject* append_info(PyObject* result, SearchInfo* info)
+{
+	PyObject* extension = Py_BuildValue("({s:i,s:i,s:i,s:i,s:i,s:i,s:i,s:O,s:d})",
+						"radius", info->radius,
+						"rounds", info->rounds,
+						"evaluated", info->evaluated,
+						"stepwise_iterations", info->stepwise_iterations,
+						"accelerated_steps", info->accelerated_steps,
+						"newton_iterations", info->newton_iterations,
+						"restarts", info->restarts,
+						"verified", info->verified ? Py_True : Py_False,
+						"validation_difference", info->validation_difference);
+	PyObject* extended = NULL;
+	if (extension != NULL)
+		extended = PySequence_Concat(result, extension);
+
+	Py_XDECREF(extension);
+	Py_DECREF(result);
+	return extended;
+}
+
+// Appends an array to a result tuple, taking ownership of both
+static PyObject* append_array(PyObject* result, PyObject* arr)
+{
+	PyObject* extension = Py_BuildValue("(O)", arr);
+	PyObject* extended = NULL;
+	if (extension != NULL)
+		extended = PySequence_Concat(result, extension);
+
+	Py_XDECREF(extension);
+	Py_DECREF(arr);
+	Py_DECREF(result);
+	return extended;
+}
+
+// Builds the result tuple of symmetrize_lattice
+static PyObject* build_result(	double strain, double* optT, double* Q, int* Lbest,
+				bool return_correspondence, SearchInfo* info)
+{
+	npy_intp dim[2] = {3, 3};
+	PyObject* arr_opt = PyArray_SimpleNew(2, dim, NPY_DOUBLE);
+	transpose<3>(optT);
+	memcpy(PyArray_DATA((PyArrayObject*)arr_opt), optT, 9 * sizeof(double));
+
+	PyObject* result = NULL;
+	if (!return_correspondence) {
+		result = Py_BuildValue("dO", strain, arr_opt);
+	}
+	else {
+		PyObject* arr_L = PyArray_SimpleNew(2, dim, NPY_INT);
+		memcpy(PyArray_DATA((PyArrayObject*)arr_L), Lbest, 9 * sizeof(int));
+
+		PyObject* arr_Q = PyArray_SimpleNew(2, dim, NPY_DOUBLE);
+		memcpy(PyArray_DATA((PyArrayObject*)arr_Q), Q, 9 * sizeof(double));
+
+		result = Py_BuildValue("dOOO", strain, arr_opt, arr_Q, arr_L);
+		Py_DECREF(arr_Q);
+		Py_DECREF(arr_L);
+	}
+
+	Py_DECREF(arr_opt);
+	if (result != NULL && info != NULL)
+		result = append_info(result, info);
+	return result;
+}
+
+// Scratch storage for the search, reusable across calls.  The GIL is held
+// while the workspace is claimed and released, so a plain flag suffices to
+// detect concurrent use.
+
+typedef struct
+{
+	PyObject_HEAD
+	SearchWorkspace* workspace;
+	bool busy;
+} WorkspaceObject;
+
+static PyTypeObject* workspace_type = NULL;
+
+// The buffers are created with the object, so that a Workspace is usable even
+// if __init__ is not called
+static PyObject* workspace_new(PyTypeObject* type, PyObject* args, PyObject* kwargs)
+{
+	WorkspaceObject* self = (WorkspaceObject*)PyType_GenericNew(type, args, kwargs);
+	if (self == NULL)
+		return NULL;
+
+	try {
+		self->workspace = create_workspace();
+	}
+	catch (std::bad_alloc&) {
+		Py_DECREF(self);
+		return PyErr_NoMemory();
+	}
+	self->busy = false;
+	return (PyObject*)self;
+}
+
+static int workspace_init(WorkspaceObject* self, PyObject* args, PyObject* kwargs)
+{
+	(void)self;
+	static const char *kwlist[] = {NULL};
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "", (char**)kwlist))
+		return -1;
+	return 0;
+}
+
+static void workspace_dealloc(WorkspaceObject* self)
+{
+	PyTypeObject* type = Py_TYPE(self);
+	if (self->workspace != NULL)
+		destroy_workspace(self->workspace);
+	type->tp_free((PyObject*)self);
+	Py_DECREF(type);
+}
+
+static PyObject* workspace_get_allocations(WorkspaceObject* self, void* closure)
+{
+	(void)closure;
+	return PyLong_FromUnsignedLongLong(workspace_allocations(self->workspace));
+}
+
+static PyGetSetDef workspace_getset[] = {
+	{
+		(char*)"allocations",
+		(getter)workspace_get_allocations,
+		NULL,
+		(char*)"Number of heap allocations made by the workspace so far.",
+		NULL
+	},
+	{NULL, NULL, NULL, NULL, NULL}
+};
+
+static const char workspace_doc[] =
+"Workspace()\n\n"
+"Scratch storage for `symmetrize_lattice`, passed as its `workspace`\n"
+"argument.  The buffers grow to the size of the largest search performed,\n"
+"after which searches make no heap allocations.  Without a workspace, each\n"
+"thread reuses one of its own.  A Workspace must not be used from several\n"
+"threads at once.";
+
+static PyType_Slot workspace_slots[] = {
+	{Py_tp_doc, (void*)workspace_doc},
+	{Py_tp_new, (void*)workspace_new},
+	{Py_tp_init, (void*)workspace_init},
+	{Py_tp_dealloc, (void*)workspace_dealloc},
+	{Py_tp_getset, (void*)workspace_getset},
+	{0, NULL}
+};
+
+static PyType_Spec workspace_spec = {
+	"auguste.Workspace",
+	sizeof(WorkspaceObject),
+	0,
+	Py_TPFLAGS_DEFAULT,
+	workspace_slots
+};
+
+// Parses the workspace keyword argument into the search options, and claims it
+static bool claim_workspace(PyObject* obj, SearchOptions* options)
+{
+	if (obj == NULL || obj == Py_None)
+		return true;
+
+	if (!PyObject_TypeCheck(obj, workspace_type))
+		return error(PyExc_TypeError, "workspace must be an auguste.Workspace");
+
+	WorkspaceObject* workspace = (WorkspaceObject*)obj;
+	if (workspace->busy)
+		return error(PyExc_RuntimeError, "workspace is in use by another thread");
+
+	workspace->busy = true;
+	options->workspace = workspace->workspace;
+	return true;
+}
+
+static void release_workspace(PyObject* obj)
+{
+	if (obj != NULL && obj != Py_None)
+		((WorkspaceObject*)obj)->busy = false;
+}
+
+// Parses the precision keyword argument into the search options
+static bool parse_precision(const char* precision, int validate, SearchOptions* options)
+{
+	if (precision != NULL && strcmp(precision, "single") == 0)
+		options->single_precision = true;
+	else if (precision != NULL && strcmp(precision, "double") != 0)
+		return error(PyExc_ValueError, "precision must be \"double\" or \"single\"");
+
+	if (validate && !options->single_precision)
+		return error(PyExc_ValueError, "validate requires precision=\"single\"");
+	options->validate = validate;
+	return true;
+}
+
 static PyObject* symmetrize_lattice(PyObject* self, PyObject* args, PyObject* kwargs)
 {
 	(void)self;
@@ -100,58 +310,124 @@ static PyObject* symmetrize_lattice(PyObject* self, PyObject* args, PyObject* kw
 	char* name = NULL;
 	int search_correspondences = true;
 	int return_correspondence = false;
-
+	int parallel = false;
+	int adaptive = false;
+	int warm_start = false;
+	char* strategy = NULL;
+	char* precision = NULL;
+	int validate = false;
+	int return_info = false;
+	PyObject* obj_workspace = NULL;
+	SearchOptions options;
+	default_search_options(&options);
 
 	static const char *kwlist[] = {	(const char*)"lattice_basis",
 					(const char*)"bravais_type",
 					(const char*)"search_correspondences",
-					(const char*)"return_correspondence", NULL};
-	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "Os|pp", (char**)kwlist, &obj_B, &name,
+					(const char*)"return_correspondence",
+					(const char*)"parallel",
+					(const char*)"radius",
+					(const char*)"adaptive",
+					(const char*)"max_rounds",
+					(const char*)"warm_start",
+					(const char*)"strategy",
+					(const char*)"prefilter",
+					(const char*)"precision",
+					(const char*)"validate",
+					(const char*)"return_info",
+					(const char*)"workspace", NULL};
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "Os|pppipipsisppO", (char**)kwlist, &obj_B, &name,
 								&search_correspondences,
-								&return_correspondence))
+								&return_correspondence,
+								&parallel,
+								&options.radius,
+								&adaptive,
+								&options.max_rounds,
+								&warm_start,
+								&strategy,
+								&options.prefilter,
+								&precision,
+								&validate,
+								&return_info,
+								&obj_workspace))
+		return NULL;
+
+	if (options.radius < 0 || options.radius > MAX_NEIGHBOURHOOD_RADIUS)
+		return error(PyExc_ValueError, "radius must be in the range [0, 16]");
+	if (options.max_rounds < 1)
+		return error(PyExc_ValueError, "max_rounds must be positive");
+	if (options.prefilter < 0)
+		return error(PyExc_ValueError, "prefilter must be non-negative");
+	options.parallel = parallel;
+	options.adaptive = adaptive;
+	options.warm_start = warm_start;
+	if (strategy != NULL && strcmp(strategy, "best-first") == 0)
+		options.strategy = BEST_FIRST;
+	else if (strategy != NULL && strcmp(strategy, "hill-climb") != 0)
+		return error(PyExc_ValueError, "strategy must be \"hill-climb\" or \"best-first\"");
+	if (!parse_precision(precision, validate, &options))
 		return NULL;
 
 	double BT[9] = {0};
 	if (!get_unit_cell(obj_B, BT))
 		return NULL;
 
+	if (!claim_workspace(obj_workspace, &options))
+		return NULL;
+
 	int Lbest[9];
 	double Q[9];
 	double strain = INFINITY, optT[9] = {0};
-	int ret = optimize(name, BT, search_correspondences, Lbest, Q, optT, &strain);
-	if (ret != 0)
-	{
-		if (ret == INVALID_BRAVAIS_TYPE)
-			return error(PyExc_TypeError, "unrecognized bravais_type");
-		else if (ret == MINKOWSKI_REDUCTION_FAILURE)
-			return error(PyExc_TypeError, "Minkowski reduction failed");
-		else
-			return error(PyExc_TypeError, "symmetrization failed");
+	SearchInfo info;
+	int ret = 0;
+	Py_BEGIN_ALLOW_THREADS
+	try {
+		ret = optimize(name, BT, search_correspondences, &options, Lbest, Q, optT, &strain, &info);
+	}
+	catch (std::bad_alloc&) {
+		ret = OUT_OF_MEMORY;
 	}
+	Py_END_ALLOW_THREADS
+	release_workspace(obj_workspace);
+	if (ret != 0)
+		return error(error_type(ret), error_message(ret));
 
-	npy_intp dim[2] = {3, 3};
-	PyObject* arr_opt = PyArray_SimpleNew(2, dim, NPY_DOUBLE);
-	transpose(3, optT);
-	memcpy(PyArray_DATA((PyArrayObject*)arr_opt), optT, 9 * sizeof(double));
+	return build_result(strain, optT, Q, Lbest, return_correspondence, return_info ? &info : NULL);
+}
 
-	PyObject* result = NULL;
-	if (!return_correspondence) {
-		result = Py_BuildValue("dO", strain, arr_opt);
-	}
-	else {
-		PyObject* arr_L = PyArray_SimpleNew(2, dim, NPY_INT);
-		memcpy(PyArray_DATA((PyArrayObject*)arr_L), Lbest, 9 * sizeof(int));
+struct VectorTask
+{
+	PreparedCell* cells;
+	const SearchOptions* options;
+	double* strains;
+	bool* verified;		//may be NULL
+	double* differences;	//may be NULL
+	std::atomic<int> ret;
+};
 
-		PyObject* arr_Q = PyArray_SimpleNew(2, dim, NPY_DOUBLE);
-		memcpy(PyArray_DATA((PyArrayObject*)arr_Q), Q, 9 * sizeof(double));
+static void vector_task(int index, void* context)
+{
+	VectorTask* task = (VectorTask*)context;
+	int k = index / NUM_TYPES;
+	int type = index % NUM_TYPES;
 
-		result = Py_BuildValue("dOOO", strain, arr_opt, arr_Q, arr_L);
-		Py_DECREF(arr_Q);
-		Py_DECREF(arr_L);
+	double dummy_opt[9] = {0}, dummy_Q[9] = {0};
+	int dummy_L[9];
+	SearchInfo info;
+	int ret = 0;
+	try {
+		ret = optimize_prepared(type, &task->cells[k], task->options, dummy_L, dummy_Q, dummy_opt, &task->strains[index], &info);
 	}
-
-	Py_DECREF(arr_opt);
-	return result;
+	catch (std::bad_alloc&) {
+		task->ret = OUT_OF_MEMORY;
+		return;
+	}
+	if (ret != 0)
+		task->ret = ret;
+	if (task->verified != NULL)
+		task->verified[index] = info.verified;
+	if (task->differences != NULL)
+		task->differences[index] = info.validation_difference;
 }
 
 static PyObject* calculate_vector(PyObject* self, PyObject* args, PyObject* kwargs)
@@ -159,45 +435,81 @@ static PyObject* calculate_vector(PyObject* self, PyObject* args, PyObject* kwar
 	(void)self;
 
 	PyObject* obj_B = NULL;
-	static const char *kwlist[] = {	(const char*)"lattice_basis", NULL};
-	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O", (char**)kwlist, &obj_B))
+	int return_verified = false;
+	char* precision = NULL;
+	int validate = false;
+	SearchOptions options;
+	default_search_options(&options);
+
+	static const char *kwlist[] = {	(const char*)"lattice_basis",
+					(const char*)"prefilter",
+					(const char*)"return_verified",
+					(const char*)"precision",
+					(const char*)"validate", NULL};
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O|ipsp", (char**)kwlist, &obj_B,
+								&options.prefilter,
+								&return_verified,
+								&precision,
+								&validate))
+		return NULL;
+
+	if (options.prefilter < 0)
+		return error(PyExc_ValueError, "prefilter must be non-negative");
+	if (!parse_precision(precision, validate, &options))
 		return NULL;
 
 	double BT[9] = {0};
 	if (!get_unit_cell(obj_B, BT))
 		return NULL;
 
-	#define NUM_TYPES 14
 	double strains[NUM_TYPES] = {	INFINITY, INFINITY, INFINITY, INFINITY, INFINITY, INFINITY, INFINITY,
 					INFINITY, INFINITY, INFINITY, INFINITY, INFINITY, INFINITY, INFINITY};
+	bool verified[NUM_TYPES];
+	double differences[NUM_TYPES] = {0};
 
-	const char* pearson[NUM_TYPES] = {	"aP", "mP", "mS", "oP", "oS", "oF", "oI",
-						"tP", "tI", "hP", "hR", "cP", "cF", "cI"};
-
-	for (int i=0;i<NUM_TYPES;i++)
-	{
-		double strain = 0;
-		double dummy_opt[9] = {0}, dummy_Q[9] = {0};
-		int dummy_L[9];
-
-		int ret = optimize((char*)pearson[i], BT, true, dummy_L, dummy_Q, dummy_opt, &strain);
-		if (ret != 0)
+	PreparedCell cell;
+	VectorTask task = {&cell, &options, strains, verified, differences, {0}};
+	int ret = 0;
+	Py_BEGIN_ALLOW_THREADS
+	try {
+		ret = prepare_cell(BT, true, &cell);
+		if (ret == 0)
 		{
-		    if (ret == INVALID_BRAVAIS_TYPE)
-			    return error(PyExc_TypeError, "unrecognized bravais_type");
-		    else if (ret == MINKOWSKI_REDUCTION_FAILURE)
-			    return error(PyExc_TypeError, "Minkowski reduction failed");
-		    else
-			    return error(PyExc_TypeError, "symmetrization failed");
+			parallel_for(NUM_TYPES, vector_task, &task);
+			ret = task.ret;
 		}
-
-		strains[i] = strain;
 	}
+	catch (std::bad_alloc&) {
+		ret = OUT_OF_MEMORY;
+	}
+	Py_END_ALLOW_THREADS
+	if (ret != 0)
+		return error(error_type(ret), error_message(ret));
 
 	npy_intp dim[1] = {NUM_TYPES};
 	PyObject* arr_strains = PyArray_SimpleNew(1, dim, NPY_DOUBLE);
 	memcpy(PyArray_DATA((PyArrayObject*)arr_strains), strains, NUM_TYPES * sizeof(double));
-	return arr_strains;
+	if (!return_verified && !validate)
+		return arr_strains;
+
+	PyObject* result = Py_BuildValue("(O)", arr_strains);
+	Py_DECREF(arr_strains);
+	if (result != NULL && return_verified)
+	{
+		PyObject* arr_verified = PyArray_SimpleNew(1, dim, NPY_BOOL);
+		for (int i=0;i<NUM_TYPES;i++)
+			((npy_bool*)PyArray_DATA((PyArrayObject*)arr_verified))[i] = verified[i];
+
+		result = append_array(result, arr_verified);
+	}
+
+	if (result != NULL && validate)
+	{
+		PyObject* arr_differences = PyArray_SimpleNew(1, dim, NPY_DOUBLE);
+		memcpy(PyArray_DATA((PyArrayObject*)arr_differences), differences, NUM_TYPES * sizeof(double));
+		result = append_array(result, arr_differences);
+	}
+	return result;
 }
 
 static PyObject* minkowski_reduce(PyObject* self, PyObject* args)
@@ -215,15 +527,18 @@ static PyObject* minkowski_reduce(PyObject* self, PyObject* args)
 
 	double R[9] = {0};
 	int path[9] = {0};
-	int ret = minkowski_basis((double (*)[3])BT, (double (*)[3])R, (int (*)[3])path);
+	int ret = 0;
+	Py_BEGIN_ALLOW_THREADS
+	ret = minkowski_basis((double (*)[3])BT, (double (*)[3])R, (int (*)[3])path);
+	Py_END_ALLOW_THREADS
 
 	npy_intp dim[2] = {3, 3};
 	PyObject* arr_R = PyArray_SimpleNew(2, dim, NPY_DOUBLE);
-	transpose(3, R);
+	transpose<3>(R);
 	memcpy(PyArray_DATA((PyArrayObject*)arr_R), R, 9 * sizeof(double));
 
 	PyObject* arr_path = PyArray_SimpleNew(2, dim, NPY_INT);
-	transpose_i(3, path);
+	transpose<3>(path);
 	memcpy(PyArray_DATA((PyArrayObject*)arr_path), path, 9 * sizeof(int));
 
 	PyObject* result = NULL;
@@ -237,6 +552,663 @@ static PyObject* minkowski_reduce(PyObject* self, PyObject* args)
 	return result;
 }
 
+// Trajectory tracking.  A Tracker holds the solution for each Bravais type,
+// and starts the search for the next frame from it.
+
+typedef struct
+{
+	PyObject_HEAD
+	TrackingOptions options;
+	TrackedSolution solutions[NUM_TYPES];
+	bool busy;		//claimed while a call runs without the GIL
+} TrackerObject;
+
+// The GIL is held while a Tracker is claimed and released, as for a Workspace
+static bool claim_tracker(TrackerObject* self)
+{
+	if (self->busy)
+		return error(PyExc_RuntimeError, "tracker is in use by another thread");
+	self->busy = true;
+	return true;
+}
+
+// The defaults are set with the object, so that a Tracker is usable even if
+// __init__ is not called
+static PyObject* tracker_new(PyTypeObject* type, PyObject* args, PyObject* kwargs)
+{
+	TrackerObject* self = (TrackerObject*)PyType_GenericNew(type, args, kwargs);
+	if (self == NULL)
+		return NULL;
+
+	default_tracking_options(&self->options);
+	memset(self->solutions, 0, sizeof(self->solutions));
+	self->busy = false;
+	return (PyObject*)self;
+}
+
+static int tracker_init(TrackerObject* self, PyObject* args, PyObject* kwargs)
+{
+	TrackingOptions options;
+	default_tracking_options(&options);
+
+	static const char *kwlist[] = {	(const char*)"radius",
+					(const char*)"tolerance", NULL};
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "|id", (char**)kwlist, &options.radius, &options.tolerance))
+		return -1;
+
+	if (options.radius < 0 || options.radius > MAX_NEIGHBOURHOOD_RADIUS)
+	{
+		error(PyExc_ValueError, "radius must be in the range [0, 16]");
+		return -1;
+	}
+	if (!(options.tolerance >= 0))
+	{
+		error(PyExc_ValueError, "tolerance must be non-negative");
+		return -1;
+	}
+
+	if (self->busy)
+	{
+		error(PyExc_RuntimeError, "tracker is in use by another thread");
+		return -1;
+	}
+
+	self->options = options;
+	memset(self->solutions, 0, sizeof(self->solutions));
+	return 0;
+}
+
+static PyObject* tracker_reset(TrackerObject* self, PyObject* args)
+{
+	(void)args;
+	if (self->busy)
+		return error(PyExc_RuntimeError, "tracker is in use by another thread");
+	memset(self->solutions, 0, sizeof(self->solutions));
+	Py_RETURN_NONE;
+}
+
+static PyObject* tracker_symmetrize_lattice(TrackerObject* self, PyObject* args, PyObject* kwargs)
+{
+	PyObject* obj_B = NULL;
+	char* name = NULL;
+	int return_correspondence = false;
+	int return_info = false;
+
+	static const char *kwlist[] = {	(const char*)"lattice_basis",
+					(const char*)"bravais_type",
+					(const char*)"return_correspondence",
+					(const char*)"return_info", NULL};
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "Os|pp", (char**)kwlist, &obj_B, &name,
+								&return_correspondence,
+								&return_info))
+		return NULL;
+
+	int type = parse_string(name);
+	if (type < 0 || type >= NUM_TYPES)
+		return error(PyExc_TypeError, error_message(INVALID_BRAVAIS_TYPE));
+
+	double BT[9] = {0};
+	if (!get_unit_cell(obj_B, BT))
+		return NULL;
+
+	if (!claim_tracker(self))
+		return NULL;
+
+	int Lbest[9];
+	double Q[9];
+	double strain = INFINITY, optT[9] = {0};
+	SearchInfo info;
+	PreparedCell cell;
+	int ret = 0;
+	Py_BEGIN_ALLOW_THREADS
+	try {
+		if (type == TRICLINIC)
+		{
+			// no reduction needed, as in optimize_type
+			memcpy(cell.B, BT, 9 * sizeof(double));
+		}
+		else
+		{
+			ret = prepare_cell(BT, true, &cell);
+		}
+		if (ret == 0)
+			ret = optimize_tracked(type, &cell, &self->options, &self->solutions[type], Lbest, Q, optT, &strain, &info);
+	}
+	catch (std::bad_alloc&) {
+		ret = OUT_OF_MEMORY;
+	}
+	Py_END_ALLOW_THREADS
+	self->busy = false;
+	if (ret != 0)
+		return error(error_type(ret), error_message(ret));
+
+	return build_result(strain, optT, Q, Lbest, return_correspondence, return_info ? &info : NULL);
+}
+
+struct TrackerVectorTask
+{
+	TrackerObject* tracker;
+	PreparedCell* cell;
+	double* strains;
+	std::atomic<int> ret;
+};
+
+static void tracker_vector_task(int type, void* context)
+{
+	TrackerVectorTask* task = (TrackerVectorTask*)context;
+	TrackerObject* tracker = task->tracker;
+
+	double dummy_opt[9] = {0}, dummy_Q[9] = {0};
+	int dummy_L[9];
+	int ret = 0;
+	try {
+		ret = optimize_tracked(type, task->cell, &tracker->options, &tracker->solutions[type],
+					dummy_L, dummy_Q, dummy_opt, &task->strains[type], NULL);
+	}
+	catch (std::bad_alloc&) {
+		ret = OUT_OF_MEMORY;
+	}
+	if (ret != 0)
+		task->ret = ret;
+}
+
+static PyObject* tracker_calculate_vector(TrackerObject* self, PyObject* args, PyObject* kwargs)
+{
+	PyObject* obj_B = NULL;
+	static const char *kwlist[] = {	(const char*)"lattice_basis", NULL};
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O", (char**)kwlist, &obj_B))
+		return NULL;
+
+	double BT[9] = {0};
+	if (!get_unit_cell(obj_B, BT))
+		return NULL;
+
+	double strains[NUM_TYPES] = {	INFINITY, INFINITY, INFINITY, INFINITY, INFINITY, INFINITY, INFINITY,
+					INFINITY, INFINITY, INFINITY, INFINITY, INFINITY, INFINITY, INFINITY};
+
+	if (!claim_tracker(self))
+		return NULL;
+
+	// the cell is reduced once and shared by the searches for each type
+	PreparedCell cell;
+	TrackerVectorTask task = {self, &cell, strains, {0}};
+	int ret = 0;
+	Py_BEGIN_ALLOW_THREADS
+	try {
+		ret = prepare_cell(BT, true, &cell);
+		if (ret == 0)
+		{
+			parallel_for(NUM_TYPES, tracker_vector_task, &task);
+			ret = task.ret;
+		}
+	}
+	catch (std::bad_alloc&) {
+		ret = OUT_OF_MEMORY;
+	}
+	Py_END_ALLOW_THREADS
+	self->busy = false;
+	if (ret != 0)
+		return error(error_type(ret), error_message(ret));
+
+	npy_intp dim[1] = {NUM_TYPES};
+	PyObject* arr_strains = PyArray_SimpleNew(1, dim, NPY_DOUBLE);
+	memcpy(PyArray_DATA((PyArrayObject*)arr_strains), strains, NUM_TYPES * sizeof(double));
+	return arr_strains;
+}
+
+static PyMethodDef tracker_methods[] = {
+	{
+		"symmetrize_lattice",
+		(PyCFunction)tracker_symmetrize_lattice,
+		METH_VARARGS | METH_KEYWORDS,
+"Symmetrize the next frame of a trajectory.\n\n"
+"Parameters:\n"
+"    lattice_basis: ndarray of shape (3, 3)\n"
+"        Input lattice basis (with rows as basis vectors).\n"
+"    bravais_type: string\n"
+"        Bravais type to symmetrize to.\n"
+"    return_correspondence: bool, optional\n"
+"        Whether to also return the rotation and lattice correspondence\n"
+"        (default is False).\n"
+"    return_info: bool, optional\n"
+"        Whether to also return a dict describing the search, as in\n"
+"        `auguste.symmetrize_lattice` (default is False).\n\n"
+"Returns:\n"
+"    As `auguste.symmetrize_lattice`."
+	},
+	{
+		"calculate_vector",
+		(PyCFunction)tracker_calculate_vector,
+		METH_VARARGS | METH_KEYWORDS,
+"Calculate the vector of distances (strains) for the next frame of a trajectory.\n\n"
+"Parameters:\n"
+"    lattice_basis: ndarray of shape (3, 3)\n"
+"        Input lattice basis (with rows as basis vectors).\n\n"
+"Returns:\n"
+"    distances: ndarray of shape (14, )\n"
+"        Symmetrization distance from each of the 14 Bravais types."
+	},
+	{
+		"reset",
+		(PyCFunction)tracker_reset,
+		METH_NOARGS,
+		"Forget the tracked solutions, so that the next frame is searched from scratch."
+	},
+	{NULL, NULL, 0, NULL}
+};
+
+static const char tracker_doc[] =
+"Tracker(radius=2, tolerance=0.01)\n\n"
+"Symmetrizes the frames of a trajectory in which the lattice changes\n"
+"smoothly.  The solution for each Bravais type is remembered, and the search\n"
+"for the next frame starts from it and is restricted to a small\n"
+"neighbourhood.  A full search is performed on the first frame, and whenever\n"
+"the strain exceeds that of the last full search by more than `tolerance`.\n"
+"A Tracker serves one call at a time; a call from another thread while it\n"
+"is in use raises RuntimeError.\n\n"
+"Parameters:\n"
+"    radius: int, optional\n"
+"        Radius of the neighbourhood searched around the previous\n"
+"        correspondence (0 to 16, default is 2).\n"
+"    tolerance: float, optional\n"
+"        Increase in strain over the last full search which triggers\n"
+"        another (default is 0.01).";
+
+static PyType_Slot tracker_slots[] = {
+	{Py_tp_doc, (void*)tracker_doc},
+	{Py_tp_new, (void*)tracker_new},
+	{Py_tp_init, (void*)tracker_init},
+	{Py_tp_methods, (void*)tracker_methods},
+	{0, NULL}
+};
+
+static PyType_Spec tracker_spec = {
+	"auguste.Tracker",
+	sizeof(TrackerObject),
+	0,
+	Py_TPFLAGS_DEFAULT,
+	tracker_slots
+};
+
+// Generalized ufunc loops.  These run with the GIL released; errors are
+// reported by briefly reacquiring it, which makes the ufunc machinery raise.
+// No C++ exception may leave a loop or a pool task, so allocation failures
+// are caught and reported as OUT_OF_MEMORY.
+
+static void gufunc_error(int ret)
+{
+	NPY_ALLOW_C_API_DEF
+	NPY_ALLOW_C_API
+	PyErr_SetString(error_type(ret), error_message(ret));
+	NPY_DISABLE_C_API
+}
+
+static void read_cell(char* p, npy_intp s0, npy_intp s1, double* BT)
+{
+	// strided (3, 3) row-vector cell to column-vector format
+	for (int i=0;i<3;i++)
+		for (int j=0;j<3;j++)
+			BT[j * 3 + i] = *(double*)(p + i * s0 + j * s1);
+}
+
+static void write_matrix(double* A, char* p, npy_intp s0, npy_intp s1)
+{
+	for (int i=0;i<3;i++)
+		for (int j=0;j<3;j++)
+			*(double*)(p + i * s0 + j * s1) = A[i * 3 + j];
+}
+
+static void write_matrix_i(int* A, char* p, npy_intp s0, npy_intp s1)
+{
+	for (int i=0;i<3;i++)
+		for (int j=0;j<3;j++)
+			*(int*)(p + i * s0 + j * s1) = A[i * 3 + j];
+}
+
+// Batches are processed in blocks of at most this many work items, so that
+// item indices fit comfortably in an int.
+#define MAX_BLOCK_SIZE (1 << 24)
+
+struct PrepareLoopTask
+{
+	char* in;
+	const npy_intp* steps;
+	PreparedCell* cells;
+	std::atomic<int> ret;
+};
+
+static void prepare_loop_task(int k, void* context)
+{
+	PrepareLoopTask* task = (PrepareLoopTask*)context;
+	const npy_intp* steps = task->steps;
+
+	double BT[9];
+	read_cell(task->in + k * steps[0], steps[2], steps[3], BT);
+	int ret = 0;
+	try {
+		ret = prepare_cell(BT, true, &task->cells[k]);
+	}
+	catch (std::bad_alloc&) {
+		ret = OUT_OF_MEMORY;
+	}
+	if (ret != 0)
+		task->ret = ret;
+}
+
+// signature (3,3)->(14)
+static void calculate_vector_loop(char** args, npy_intp const* dimensions, npy_intp const* steps, void* data)
+{
+	(void)data;
+	npy_intp n = dimensions[0];
+
+	// cells are reduced once, in parallel, and then shared by the searches
+	// for each (cell, type) pair.  As with the search workspaces, the block
+	// buffers are kept by the calling thread between calls.
+	try {
+		npy_intp block = std::min(n, (npy_intp)4096);
+		static thread_local std::vector<PreparedCell> cells;
+		static thread_local std::vector<double> strains;
+		if ((npy_intp)cells.size() < block || (npy_intp)strains.size() < block * NUM_TYPES)
+		{
+			cells.resize(block);
+			strains.resize(block * NUM_TYPES);
+		}
+
+		for (npy_intp start=0;start<n;start+=block)
+		{
+			npy_intp m = std::min(block, n - start);
+			PrepareLoopTask prepare = {args[0] + start * steps[0], steps, cells.data(), {0}};
+			parallel_for((int)m, prepare_loop_task, &prepare);
+			if (prepare.ret != 0)
+				return gufunc_error(prepare.ret);
+
+			VectorTask task = {cells.data(), NULL, strains.data(), NULL, NULL, {0}};
+			parallel_for((int)(m * NUM_TYPES), vector_task, &task);
+			if (task.ret != 0)
+				return gufunc_error(task.ret);
+
+			for (npy_intp k=0;k<m;k++)
+			{
+				char* pout = args[1] + (start + k) * steps[1];
+				for (int i=0;i<NUM_TYPES;i++)
+					*(double*)(pout + i * steps[4]) = strains[k * NUM_TYPES + i];
+			}
+		}
+	}
+	catch (std::bad_alloc&) {
+		gufunc_error(OUT_OF_MEMORY);
+	}
+}
+
+struct SymmetrizeLoopTask
+{
+	char** args;
+	const npy_intp* steps;
+	std::atomic<int> ret;
+};
+
+static void symmetrize_loop_task(int index, void* context)
+{
+	SymmetrizeLoopTask* task = (SymmetrizeLoopTask*)context;
+	char** args = task->args;
+	const npy_intp* steps = task->steps;
+	const npy_intp* cs = &steps[6];	//core strides, two per (3,3) operand
+	npy_intp k = index;
+
+	double BT[9];
+	read_cell(args[0] + k * steps[0], cs[0], cs[1], BT);
+	npy_intp type = *(npy_intp*)(args[1] + k * steps[1]);
+	if (type < 0 || type >= NUM_TYPES)
+	{
+		task->ret = INVALID_BRAVAIS_TYPE;
+		return;
+	}
+
+	int L[9];
+	double Q[9];
+	double strain = INFINITY, optT[9] = {0};
+	int ret = 0;
+	try {
+		ret = optimize_type((int)type, BT, true, NULL, L, Q, optT, &strain, NULL);
+	}
+	catch (std::bad_alloc&) {
+		ret = OUT_OF_MEMORY;
+	}
+	if (ret != 0)
+	{
+		task->ret = ret;
+		return;
+	}
+
+	transpose<3>(optT);
+	*(double*)(args[2] + k * steps[2]) = strain;
+	write_matrix(optT, args[3] + k * steps[3], cs[2], cs[3]);
+	write_matrix(Q, args[4] + k * steps[4], cs[4], cs[5]);
+	write_matrix_i(L, args[5] + k * steps[5], cs[6], cs[7]);
+}
+
+// signature (3,3),()->(),(3,3),(3,3),(3,3)
+static void symmetrize_lattice_loop(char** args, npy_intp const* dimensions, npy_intp const* steps, void* data)
+{
+	(void)data;
+	npy_intp n = dimensions[0];
+
+	for (npy_intp start=0;start<n;start+=MAX_BLOCK_SIZE)
+	{
+		char* block_args[6];
+		for (int i=0;i<6;i++)
+			block_args[i] = args[i] + start * steps[i];
+
+		npy_intp m = std::min((npy_intp)MAX_BLOCK_SIZE, n - start);
+		SymmetrizeLoopTask task = {block_args, steps, {0}};
+		try {
+			parallel_for((int)m, symmetrize_loop_task, &task);
+		}
+		catch (std::bad_alloc&) {
+			return gufunc_error(OUT_OF_MEMORY);
+		}
+		if (task.ret != 0)
+			return gufunc_error(task.ret);
+	}
+}
+
+// Matrices are decomposed in blocks of this many per parallel task, and
+// gathered into contiguous buffers a chunk at a time.
+#define POLAR_BLOCK_SIZE 256
+#define POLAR_CHUNK_SIZE 32
+
+struct PolarLoopTask
+{
+	char** args;
+	npy_intp n;
+	const npy_intp* steps;
+};
+
+// the loops are instantiated for both precisions
+extern "C++" {
+
+static void polar_batch(int count, const double* A, double* U, double* P)
+{
+	polar_decomposition_3x3_batch(count, A, true, U, P);
+}
+
+static void polar_batch(int count, const float* A, float* U, float* P)
+{
+	polar_decomposition_3x3f_batch(count, A, true, U, P);
+}
+
+template <typename T>
+static void polar_loop_task(int index, void* context)
+{
+	PolarLoopTask* task = (PolarLoopTask*)context;
+	char** args = task->args;
+	const npy_intp* steps = task->steps;
+	const npy_intp* cs = &steps[3];	//core strides, two per (3,3) operand
+
+	npy_intp begin = (npy_intp)index * POLAR_BLOCK_SIZE;
+	npy_intp end = std::min(begin + POLAR_BLOCK_SIZE, task->n);
+
+	T A[POLAR_CHUNK_SIZE * 9], U[POLAR_CHUNK_SIZE * 9], P[POLAR_CHUNK_SIZE * 9];
+	for (npy_intp start=begin;start<end;start+=POLAR_CHUNK_SIZE)
+	{
+		int m = (int)std::min((npy_intp)POLAR_CHUNK_SIZE, end - start);
+		for (int k=0;k<m;k++)
+		{
+			char* p = args[0] + (start + k) * steps[0];
+			for (int i=0;i<3;i++)
+				for (int j=0;j<3;j++)
+					A[k * 9 + i * 3 + j] = *(T*)(p + i * cs[0] + j * cs[1]);
+		}
+
+		polar_batch(m, A, U, P);
+
+		for (int k=0;k<m;k++)
+		{
+			for (int i=0;i<3;i++)
+			{
+				for (int j=0;j<3;j++)
+				{
+					*(T*)(args[1] + (start + k) * steps[1] + i * cs[2] + j * cs[3]) = U[k * 9 + i * 3 + j];
+					*(T*)(args[2] + (start + k) * steps[2] + i * cs[4] + j * cs[5]) = P[k * 9 + i * 3 + j];
+				}
+			}
+		}
+	}
+}
+
+// signature (3,3)->(3,3),(3,3), in single or double precision
+template <typename T>
+static void polar_decompose_loop(char** args, npy_intp const* dimensions, npy_intp const* steps, void* data)
+{
+	(void)data;
+	npy_intp n = dimensions[0];
+
+	npy_intp max_block = (npy_intp)MAX_BLOCK_SIZE * POLAR_BLOCK_SIZE;
+	for (npy_intp start=0;start<n;start+=max_block)
+	{
+		char* block_args[3];
+		for (int i=0;i<3;i++)
+			block_args[i] = args[i] + start * steps[i];
+
+		npy_intp m = std::min(max_block, n - start);
+		PolarLoopTask task = {block_args, m, steps};
+		try {
+			parallel_for((int)((m + POLAR_BLOCK_SIZE - 1) / POLAR_BLOCK_SIZE), polar_loop_task<T>, &task);
+		}
+		catch (std::bad_alloc&) {
+			return gufunc_error(OUT_OF_MEMORY);
+		}
+	}
+}
+
+}
+
+static PyUFuncGenericFunction calculate_vector_funcs[] = {calculate_vector_loop};
+static char calculate_vector_types[] = {NPY_DOUBLE, NPY_DOUBLE};
+static void* calculate_vector_data[] = {NULL};
+
+static PyUFuncGenericFunction symmetrize_lattice_funcs[] = {symmetrize_lattice_loop};
+static char symmetrize_lattice_types[] = {NPY_DOUBLE, NPY_INTP, NPY_DOUBLE, NPY_DOUBLE, NPY_DOUBLE, NPY_INT};
+static void* symmetrize_lattice_data[] = {NULL};
+
+static PyUFuncGenericFunction polar_decompose_funcs[] = {polar_decompose_loop<float>, polar_decompose_loop<double>};
+static char polar_decompose_types[] = {NPY_FLOAT, NPY_FLOAT, NPY_FLOAT, NPY_DOUBLE, NPY_DOUBLE, NPY_DOUBLE};
+static void* polar_decompose_data[] = {NULL, NULL};
+
+static const char calculate_vectors_doc[] =
+"Calculate vectors of distances (strains) from all Bravais lattice types.\n\n"
+"Generalized ufunc with signature (3,3)->(14).\n\n"
+"Parameters:\n"
+"    lattice_bases: ndarray of shape (..., 3, 3)\n"
+"        Input lattice bases (with rows as basis vectors).\n\n"
+"Returns:\n"
+"    distances: ndarray of shape (..., 14)\n"
+"        Symmetrization distance from each of the 14 Bravais types.";
+
+static const char symmetrize_lattices_doc[] =
+"Symmetrize Bravais lattices.\n\n"
+"Generalized ufunc with signature (3,3),()->(),(3,3),(3,3),(3,3).\n\n"
+"Parameters:\n"
+"    lattice_bases: ndarray of shape (..., 3, 3)\n"
+"        Input lattice bases (with rows as basis vectors).\n"
+"    bravais_types: integer or integer ndarray of shape (...)\n"
+"        Index of the Bravais type to symmetrize to, as ordered in\n"
+"        `auguste.names`.  Broadcasts against the lattice bases.\n\n"
+"Returns:\n"
+"    distances: ndarray of shape (...)\n"
+"        Symmetrization distances.\n"
+"    symmetrized: ndarray of shape (..., 3, 3)\n"
+"        Symmetrized cells.\n"
+"    rotations: ndarray of shape (..., 3, 3)\n"
+"        Rotations, as returned by `symmetrize_lattice`.\n"
+"    correspondences: ndarray of shape (..., 3, 3)\n"
+"        Lattice correspondences, as returned by `symmetrize_lattice`.";
+
+static const char polar_decompose_doc[] =
+"Polar decomposition of 3x3 matrices.\n\n"
+"Generalized ufunc with signature (3,3)->(3,3),(3,3).\n\n"
+"Parameters:\n"
+"    F: ndarray of shape (..., 3, 3)\n"
+"        Input matrices.\n\n"
+"Returns:\n"
+"    U: ndarray of shape (..., 3, 3)\n"
+"        Unitary factors.  U is a rotation if det(F) > 0.\n"
+"    P: ndarray of shape (..., 3, 3)\n"
+"        Symmetric factors, such that F = U P.\n\n"
+"float32 input is decomposed in single precision, with twice as many\n"
+"matrices per vector instruction.";
+
+static PyObject* module_set_num_threads(PyObject* self, PyObject* args)
+{
+	(void)self;
+
+	int num_threads = 0;
+	if (!PyArg_ParseTuple(args, "i", &num_threads))
+		return NULL;
+
+	if (num_threads < 1)
+		return error(PyExc_ValueError, "num_threads must be positive");
+
+	Py_BEGIN_ALLOW_THREADS
+	set_num_threads(num_threads);
+	Py_END_ALLOW_THREADS
+	Py_RETURN_NONE;
+}
+
+static PyObject* module_get_num_threads(PyObject* self, PyObject* args)
+{
+	(void)self;
+	(void)args;
+	return PyLong_FromLong(get_num_threads());
+}
+
+#ifdef AUGUSTE_COUNT_ALLOCATIONS
+static PyObject* module_get_heap_allocations(PyObject* self, PyObject* args)
+{
+	(void)self;
+	(void)args;
+	return PyLong_FromUnsignedLongLong(heap_allocations());
+}
+
+static PyObject* module_fail_heap_allocations(PyObject* self, PyObject* args)
+{
+	(void)self;
+	long long n = -1;
+	if (!PyArg_ParseTuple(args, "L", &n))
+		return NULL;
+
+	fail_heap_allocations(n);
+	Py_RETURN_NONE;
+}
+#endif
+
+static PyObject* module_get_isa(PyObject* self, PyObject* args)
+{
+	(void)self;
+	(void)args;
+	return PyUnicode_FromString(isa_name(active_isa()));
+}
+
 static PyMethodDef auguste_methods[] = {
 	{
 		"symmetrize_lattice",
@@ -250,7 +1222,61 @@ static PyMethodDef auguste_methods[] = {
 "        Bravais type to symmetrize to. Permitted names are stored in\n"
 "        `auguste.names` and `auguste.pearson`.\n"
 "    search_correspondences: bool, optional\n"
-"        Whether to search over lattice correspondences (default is True).\n\n"
+"        Whether to search over lattice correspondences (default is True).\n"
+"    return_correspondence: bool, optional\n"
+"        Whether to also return the rotation and lattice correspondence\n"
+"        (default is False).\n"
+"    parallel: bool, optional\n"
+"        Whether to evaluate the candidate correspondences on the thread\n"
+"        pool (default is False).  The result does not depend on this.\n"
+"        Inside a batch function the candidates are evaluated serially.\n"
+"    radius: int, optional\n"
+"        Radius of the unimodular neighbourhood searched in each round, as\n"
+"        the largest squared distance of a neighbour from the identity\n"
+"        (0 to 16, default is 16).\n"
+"    adaptive: bool, optional\n"
+"        Whether to search small neighbourhoods first, growing them towards\n"
+"        `radius` only when they stop improving (default is False).  This\n"
+"        evaluates fewer candidates, but can end in a different local\n"
+"        minimum.\n"
+"    max_rounds: int, optional\n"
+"        Maximum number of improving rounds (default is 40).  For the\n"
+"        best-first strategy, the maximum number of correspondences whose\n"
+"        neighbourhoods are expanded.\n"
+"    warm_start: bool, optional\n"
+"        Whether to start the optimization of each candidate from the\n"
+"        solution of the correspondence it neighbours (default is False).\n"
+"    strategy: string, optional\n"
+"        Search strategy, either \"hill-climb\" (the default), which moves\n"
+"        to the best neighbour of the best correspondence in each round, or\n"
+"        \"best-first\", which keeps the neighbourhoods of all improving\n"
+"        correspondences in a frontier and evaluates the candidate with the\n"
+"        smallest strain lower bound next.  `adaptive` applies to the\n"
+"        hill-climb only.\n"
+"    prefilter: int, optional\n"
+"        If positive, the candidates of each round are optimized in order\n"
+"        of their strain lower bounds only until this many in a row fail to\n"
+"        improve, which is faster but can miss the correspondence found by\n"
+"        the exhaustive search (default is 0, exhaustive).\n"
+"    precision: string, optional\n"
+"        Either \"double\" (the default) or \"single\", which optimizes\n"
+"        the candidate correspondences in single precision, to a few\n"
+"        significant figures, and then re-optimizes the best one in double\n"
+"        precision.  This is faster, but can end in a different local\n"
+"        minimum.\n"
+"    validate: bool, optional\n"
+"        With precision=\"single\", also performs the search in double\n"
+"        precision and reports the difference in distance in the info dict\n"
+"        (default is False).\n"
+"    return_info: bool, optional\n"
+"        Whether to also return a dict with the neighbourhood radius of the\n"
+"        round which found the result, the number of rounds, the number\n"
+"        of candidates evaluated, iteration counts, whether the result is\n"
+"        verified to be that of the exhaustive search, and the validation\n"
+"        difference (default is False).\n"
+"    workspace: auguste.Workspace, optional\n"
+"        Scratch storage to reuse for the search (default is one which\n"
+"        belongs to the calling thread).\n\n"
 "Returns:\n"
 "    distance: float\n"
 "        Symmetrization distance.\n"
@@ -264,10 +1290,25 @@ static PyMethodDef auguste_methods[] = {
 "Calculate a vector of distances (strains) from all Bravais lattice types.\n\n"
 "Parameters:\n"
 "    lattice_basis: ndarray of shape (3, 3)\n"
-"        Input lattice basis (with rows as basis vectors).\n\n"
+"        Input lattice basis (with rows as basis vectors).\n"
+"    prefilter: int, optional\n"
+"        As for `symmetrize_lattice` (default is 0, exhaustive).\n"
+"    return_verified: bool, optional\n"
+"        Whether to also return, for each type, whether the distance is\n"
+"        verified to be that of the exhaustive search (default is False).\n"
+"    precision: string, optional\n"
+"        As for `symmetrize_lattice` (default is \"double\").\n"
+"    validate: bool, optional\n"
+"        With precision=\"single\", whether to also return the difference\n"
+"        of each distance from that of the double-precision search\n"
+"        (default is False).\n\n"
 "Returns:\n"
 "    distances: ndarray of shape (14, )\n"
-"        Symmetrization distance from each of the 14 Bravais types."
+"        Symmetrization distance from each of the 14 Bravais types.\n"
+"    verified: ndarray of shape (14, ), optional\n"
+"        Whether each distance is verified.\n"
+"    differences: ndarray of shape (14, ), optional\n"
+"        Difference of each distance from the double-precision distance."
 	},
 	{
 		"minkowski_reduce",
@@ -275,6 +1316,42 @@ static PyMethodDef auguste_methods[] = {
 		METH_VARARGS,
 		"Minkowski-reduce a Bravais lattice basis."
 	},
+	{
+		"set_num_threads",
+		module_set_num_threads,
+		METH_VARARGS,
+		"Set the number of threads used by `calculate_vector` and the batch functions."
+	},
+	{
+		"get_num_threads",
+		module_get_num_threads,
+		METH_NOARGS,
+		"Get the number of threads used by `calculate_vector` and the batch functions."
+	},
+	{
+		"get_isa",
+		module_get_isa,
+		METH_NOARGS,
+		"Get the instruction set (\"baseline\", \"avx2\" or \"avx512\") which the numeric kernels\n"
+"were selected for.  The environment variable AUGUSTE_ISA, read at import, forces\n"
+"a variant supported by the CPU."
+	},
+#ifdef AUGUSTE_COUNT_ALLOCATIONS
+	{
+		"_get_heap_allocations",
+		module_get_heap_allocations,
+		METH_NOARGS,
+		"Get the number of heap allocations made by the extension so far.  Only\n"
+"present in a test build, made with AUGUSTE_COUNT_ALLOCATIONS set."
+	},
+	{
+		"_fail_heap_allocations",
+		module_fail_heap_allocations,
+		METH_VARARGS,
+		"Make every heap allocation by the extension after the next n fail; a\n"
+"negative n stops the failures.  Only present in a test build."
+	},
+#endif
 	{NULL, NULL, 0, NULL}
 };
 
@@ -294,6 +1371,8 @@ PyMODINIT_FUNC PyInit_auguste(void)
 {
 	Py_Initialize();
 	import_array();
+	import_umath();
+	active_isa();	//reads the CPU features and AUGUSTE_ISA once, at import
 
 	PyObject* module = PyModule_Create(&auguste_definition);
 	if (module == NULL)
@@ -323,6 +1402,40 @@ PyMODINIT_FUNC PyInit_auguste(void)
 						"aP", "mP", "mS", "oP", "oS", "oF", "oI",
 						"tP", "tI", "hP", "hR", "cP", "cF", "cI")))
 		goto except;
+
+	if (PyModule_AddObject(	module, "calculate_vectors",
+				PyUFunc_FromFuncAndDataAndSignature(
+						calculate_vector_funcs, calculate_vector_data,
+						calculate_vector_types, 1, 1, 1, PyUFunc_None,
+						"calculate_vectors", calculate_vectors_doc, 0,
+						"(3,3)->(14)")))
+		goto except;
+
+	if (PyModule_AddObject(	module, "symmetrize_lattices",
+				PyUFunc_FromFuncAndDataAndSignature(
+						symmetrize_lattice_funcs, symmetrize_lattice_data,
+						symmetrize_lattice_types, 1, 2, 4, PyUFunc_None,
+						"symmetrize_lattices", symmetrize_lattices_doc, 0,
+						"(3,3),()->(),(3,3),(3,3),(3,3)")))
+		goto except;
+
+	if (PyModule_AddObject(	module, "polar_decompose",
+				PyUFunc_FromFuncAndDataAndSignature(
+						polar_decompose_funcs, polar_decompose_data,
+						polar_decompose_types, 2, 1, 2, PyUFunc_None,
+						"polar_decompose", polar_decompose_doc, 0,
+						"(3,3)->(3,3),(3,3)")))
+		goto except;
+
+	if (PyModule_AddObject(module, "Tracker", PyType_FromSpec(&tracker_spec)))
+		goto except;
+
+	workspace_type = (PyTypeObject*)PyType_FromSpec(&workspace_spec);
+	if (workspace_type == NULL)
+		goto except;
+	Py_INCREF(workspace_type);
+	if (PyModule_AddObject(module, "Workspace", (PyObject*)workspace_type))
+		goto except;
 	goto finally;
 
 except:
@@ -26,6 +26,8 @@ SOFTWARE.*/
 
 #define INVALID_BRAVAIS_TYPE -101
 #define MINKOWSKI_REDUCTION_FAILURE -102
+#define SINGULAR_LATTICE_BASIS -103
+#define OUT_OF_MEMORY -104
 
 
 #define TRICLINIC	0
@@ -43,6 +45,8 @@ SOFTWARE.*/
 #define BCC		12
 #define FCC		13
 
+#define NUM_BRAVAIS_TYPES 14
+
 #define aP 0 	//primitive triclinic
 #define mP 1	//primitive monoclinic
 #define mS 2	//base-centred monoclinic
@@ -0,0 +1,73 @@
+/*MIT License
+
+Copyright (c) 2019 P. M. Larsen
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.*/
+
+#ifndef COUNTING_ALLOCATOR_H
+#define COUNTING_ALLOCATOR_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+// Standard allocator which counts its allocations in a shared counter, so that
+// the buffers of a workspace can be checked to stop allocating once they have
+// grown to the size of the searches performed.
+template <typename T>
+struct CountingAllocator
+{
+	typedef T value_type;
+
+	uint64_t* count;
+
+	CountingAllocator(uint64_t* count) : count(count) {}
+
+	template <typename U>
+	CountingAllocator(const CountingAllocator<U>& other) : count(other.count) {}
+
+	T* allocate(size_t n)
+	{
+		(*count)++;
+		return std::allocator<T>().allocate(n);
+	}
+
+	void deallocate(T* p, size_t n)
+	{
+		std::allocator<T>().deallocate(p, n);
+	}
+};
+
+template <typename T, typename U>
+bool operator==(const CountingAllocator<T>& a, const CountingAllocator<U>& b)
+{
+	return a.count == b.count;
+}
+
+template <typename T, typename U>
+bool operator!=(const CountingAllocator<T>& a, const CountingAllocator<U>& b)
+{
+	return a.count != b.count;
+}
+
+template <typename T>
+using counted_vector = std::vector<T, CountingAllocator<T> >;
+
+#endif
@@ -0,0 +1,67 @@
+/*MIT License
+
+Copyright (c) 2019 P. M. Larsen
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.*/
+
+#include <cstdlib>
+#include <cstring>
+#include "cpu_dispatch.h"
+
+static const char* isa_names[] = {"baseline", "avx2", "avx512"};
+
+static int supported_isa()
+{
+#if CPU_DISPATCH
+	__builtin_cpu_init();
+	if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512dq")
+		&& __builtin_cpu_supports("avx512vl") && __builtin_cpu_supports("avx512bw")
+		&& __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma"))
+		return ISA_AVX512;
+	if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma"))
+		return ISA_AVX2;
+#endif
+	return ISA_BASELINE;
+}
+
+// The AVX-512 variants are used only on request: they are no faster than the
+// AVX2 ones for the symmetrization, which spends much of its time in
+// unvectorized code, and processors lower their clock when running them.
+static int requested_isa()
+{
+	int isa = supported_isa();
+	const char* request = getenv("AUGUSTE_ISA");
+	if (request != NULL)
+		for (int i=0;i<3;i++)
+			if (strcmp(request, isa_names[i]) == 0)
+				return i < isa ? i : isa;
+
+	return isa < ISA_AVX2 ? isa : ISA_AVX2;
+}
+
+int active_isa()
+{
+	static const int isa = requested_isa();
+	return isa;
+}
+
+const char* isa_name(int isa)
+{
+	return isa_names[isa];
+}
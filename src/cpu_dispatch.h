@@ -0,0 +1,67 @@
+/*MIT License
+
+Copyright (c) 2019 P. M. Larsen
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.*/
+
+#ifndef CPU_DISPATCH_H
+#define CPU_DISPATCH_H
+
+// The numeric kernels are compiled for several instruction sets, and the
+// variant used is chosen once, from the features reported by the CPU: AVX2 if
+// supported, otherwise the baseline.  The environment variable AUGUSTE_ISA
+// ("baseline", "avx2" or "avx512") forces a variant; one which the CPU does not
+// support falls back to the best one that it does.
+
+enum
+{
+	ISA_BASELINE = 0,
+	ISA_AVX2 = 1,
+	ISA_AVX512 = 2,
+};
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define CPU_DISPATCH 1
+// Each variant inlines the kernel body, so that it is compiled for that
+// instruction set.  The AVX-512 variant keeps to 256-bit vectors, which avoids
+// the clock penalty of the wider ones on most processors.
+#define TARGET_AVX2 __attribute__((target("avx2,fma"), flatten))
+#define TARGET_AVX512 __attribute__((target("avx512f,avx512dq,avx512vl,avx512bw,avx2,fma,prefer-vector-width=256"), flatten))
+#else
+#define CPU_DISPATCH 0
+#define TARGET_AVX2
+#define TARGET_AVX512
+#endif
+
+int active_isa();
+const char* isa_name(int isa);
+
+// Chooses between the variants of a kernel
+template <typename F>
+F select_kernel(F baseline, F avx2, F avx512)
+{
+	int isa = active_isa();
+	if (isa == ISA_AVX512)
+		return avx512;
+	if (isa == ISA_AVX2)
+		return avx2;
+	return baseline;
+}
+
+#endif
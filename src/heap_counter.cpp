@@ -0,0 +1,96 @@
+/*MIT License
+
+Copyright (c) 2019 P. M. Larsen
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.*/
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include "heap_counter.h"
+
+
+// The global allocation functions are replaced by ones which count the calls.
+// They allocate with malloc, as the library versions do, so memory allocated
+// by either can be freed by either.  The replacements apply to the whole
+// process, so this file is only compiled into test builds.
+
+static std::atomic<uint64_t> num_allocations(0);
+static std::atomic<uint64_t> first_failure(UINT64_MAX);
+
+uint64_t heap_allocations()
+{
+	return num_allocations.load(std::memory_order_relaxed);
+}
+
+void fail_heap_allocations(int64_t n)
+{
+	first_failure.store(n < 0 ? UINT64_MAX : heap_allocations() + n, std::memory_order_relaxed);
+}
+
+static void* counted_malloc(size_t size)
+{
+	uint64_t index = num_allocations.fetch_add(1, std::memory_order_relaxed);
+	if (index >= first_failure.load(std::memory_order_relaxed))
+		return NULL;
+	return malloc(size == 0 ? 1 : size);
+}
+
+void* operator new(size_t size)
+{
+	void* p = counted_malloc(size);
+	if (p == NULL)
+		throw std::bad_alloc();
+	return p;
+}
+
+void* operator new[](size_t size)
+{
+	return operator new(size);
+}
+
+void* operator new(size_t size, const std::nothrow_t&) noexcept
+{
+	return counted_malloc(size);
+}
+
+void* operator new[](size_t size, const std::nothrow_t&) noexcept
+{
+	return counted_malloc(size);
+}
+
+void operator delete(void* p) noexcept
+{
+	free(p);
+}
+
+void operator delete[](void* p) noexcept
+{
+	free(p);
+}
+
+void operator delete(void* p, const std::nothrow_t&) noexcept
+{
+	free(p);
+}
+
+void operator delete[](void* p, const std::nothrow_t&) noexcept
+{
+	free(p);
+}
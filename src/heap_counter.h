@@ -0,0 +1,38 @@
+/*MIT License
+
+Copyright (c) 2019 P. M. Larsen
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.*/
+
+#ifndef HEAP_COUNTER_H
+#define HEAP_COUNTER_H
+
+#include <cstdint>
+
+// Number of calls to the global operator new made by the extension so far, on
+// any thread.  The tests use it to check that a search with a grown workspace
+// makes no heap allocations.  The counter is only built into a test build,
+// with AUGUSTE_COUNT_ALLOCATIONS defined (see setup.py).
+uint64_t heap_allocations();
+
+// Makes every allocation after the next n fail, so that the tests can check
+// how allocation failures are reported.  A negative n stops the failures.
+void fail_heap_allocations(int64_t n);
+
+#endif
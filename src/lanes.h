@@ -0,0 +1,51 @@
+/*MIT License
+
+Copyright (c) 2019 P. M. Larsen
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.*/
+
+#ifndef LANES_H
+#define LANES_H
+
+// Number of candidate correspondences which are optimized in lock-step.  Each
+// quantity of the optimization is stored as an array over the lanes, x[i][l]
+// being element i of lane l, so that the loops over lanes vectorize.  Lanes
+// which have nothing to do repeat the work of another lane, whose results they
+// discard, so that they only perform arithmetic that some lane needs.
+#define CANDIDATE_LANES 4
+
+// Copies `rows` rows of lane data from lane `from` to lane `to`
+template <int rows, int LANES, typename T>
+inline void copy_lane(T (*a)[LANES], int from, int to)
+{
+	for (int k=0;k<rows;k++)
+		a[k][to] = a[k][from];
+}
+
+// Index of the first set flag, or -1
+template <int LANES>
+inline int first_lane(const bool* flags)
+{
+	for (int l=0;l<LANES;l++)
+		if (flags[l])
+			return l;
+	return -1;
+}
+
+#endif
@@ -35,8 +35,12 @@
 #include <cassert>
 
 #define MAX_LEN 10
-bool lup_decompose(int n, double* A, int* P)
+
+// The size is either fixed at compile time (N > 0) or given at run time
+template <int N>
+static bool _lup_decompose(int size, double* A, int* P)
 {
+	const int n = N > 0 ? N : size;
 	double swap_area[MAX_LEN];
 
 	int* tmpPermutations = P;
@@ -147,8 +151,10 @@ bool lup_decompose(int n, double* A, int* P)
 	return true;
 }
 
-void lup_solve(int n, double* A, int* P, double* b, double* x)
+template <int N>
+static void _lup_solve(int size, double* A, int* P, double* b, double* x)
 {
+	const int n = N > 0 ? N : size;
 	double intermediate_data[MAX_LEN * MAX_LEN];
 
 	int lStride = n + 1;
@@ -204,3 +210,34 @@ void lup_solve(int n, double* A, int* P, double* b, double* x)
 	}
 }
 
+bool lup_decompose(int n, double* A, int* P)
+{
+	return _lup_decompose<0>(n, A, P);
+}
+
+void lup_solve(int n, double* A, int* P, double* b, double* x)
+{
+	_lup_solve<0>(n, A, P, b, x);
+}
+
+template <int n>
+bool lup_decompose(double* A, int* P)
+{
+	return _lup_decompose<n>(n, A, P);
+}
+
+template <int n>
+void lup_solve(double* A, int* P, double* b, double* x)
+{
+	_lup_solve<n>(n, A, P, b, x);
+}
+
+// full (7-10) KKT systems of the SQP step
+template bool lup_decompose<7>(double* A, int* P);
+template bool lup_decompose<8>(double* A, int* P);
+template bool lup_decompose<9>(double* A, int* P);
+template bool lup_decompose<10>(double* A, int* P);
+template void lup_solve<7>(double* A, int* P, double* b, double* x);
+template void lup_solve<8>(double* A, int* P, double* b, double* x);
+template void lup_solve<9>(double* A, int* P, double* b, double* x);
+template void lup_solve<10>(double* A, int* P, double* b, double* x);
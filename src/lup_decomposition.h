@@ -27,5 +27,122 @@ SOFTWARE.*/
 bool lup_decompose(int n, double* A, int* P);
 void lup_solve(int n, double* A, int* P, double* b, double* x);
 
+// Versions for a size fixed at compile time, instantiated for 7 <= n <= 10
+template <int n> bool lup_decompose(double* A, int* P);
+template <int n> void lup_solve(double* A, int* P, double* b, double* x);
+
+// Versions for LANES systems of a fixed size n, solved in lock-step, in
+// structure-of-arrays layout: A[i][j][l] is element (i, j) of system l.  They
+// perform the arithmetic and pivoting of the versions above.  singular[l] is
+// set for a system which lup_decompose rejects, whose factors are then
+// meaningless, but computed without dividing by zero.  The functions are
+// defined here so that they are inlined into the loops over lanes, as for
+// matrix_vector.h.
+template <int n, int LANES>
+inline void lup_decompose_lanes(double (*A)[n][LANES], int (*P)[LANES], bool* singular)
+{
+	for (int l=0;l<LANES;l++)
+	{
+		singular[l] = false;
+		for (int i=0;i<n;i++)
+			P[i][l] = i;
+	}
+
+	for (int k=0;k<n-1;k++)
+	{
+		// the first row with the largest magnitude in column k is the pivot
+		double p[LANES];
+		int k2[LANES];
+		for (int l=0;l<LANES;l++)
+		{
+			p[l] = 0;
+			k2[l] = k;
+		}
+
+		for (int i=k;i<n;i++)
+		{
+			for (int l=0;l<LANES;l++)
+			{
+				double temp = A[i][k][l] > 0 ? A[i][k][l] : -A[i][k][l];
+				bool larger = temp > p[l];
+				p[l] = larger ? temp : p[l];
+				k2[l] = larger ? i : k2[l];
+			}
+		}
+
+		for (int l=0;l<LANES;l++)
+			singular[l] = singular[l] || p[l] == 0;
+
+		for (int i=k+1;i<n;i++)
+		{
+			for (int l=0;l<LANES;l++)
+			{
+				bool swap = k2[l] == i;
+				int pk = P[k][l], pi = P[i][l];
+				P[k][l] = swap ? pi : pk;
+				P[i][l] = swap ? pk : pi;
+			}
+
+			for (int j=0;j<n;j++)
+			{
+				for (int l=0;l<LANES;l++)
+				{
+					bool swap = k2[l] == i;
+					double a = A[k][j][l], b = A[i][j][l];
+					A[k][j][l] = swap ? b : a;
+					A[i][j][l] = swap ? a : b;
+				}
+			}
+		}
+
+		double pivot[LANES];
+		for (int l=0;l<LANES;l++)
+			pivot[l] = singular[l] ? 1 : A[k][k][l];
+
+		for (int i=k+1;i<n;i++)
+		{
+			for (int l=0;l<LANES;l++)
+				A[i][k][l] /= pivot[l];
+
+			for (int j=k+1;j<n;j++)
+				for (int l=0;l<LANES;l++)
+					A[i][j][l] -= A[i][k][l] * A[k][j][l];
+		}
+	}
+}
+
+template <int n, int LANES>
+inline void lup_solve_lanes(double (*A)[n][LANES], int (*P)[LANES], const bool* singular,
+				double (*b)[LANES], double (*x)[LANES])
+{
+	double y[n][LANES];
+	for (int i=0;i<n;i++)
+	{
+		double sum[LANES] = {0};
+		for (int j=0;j<i;j++)
+			for (int l=0;l<LANES;l++)
+				sum[l] += A[i][j][l] * y[j][l];
+
+		for (int l=0;l<LANES;l++)
+		{
+			double permuted = b[0][l];
+			for (int r=1;r<n;r++)
+				permuted = P[i][l] == r ? b[r][l] : permuted;
+			y[i][l] = permuted - sum[l];
+		}
+	}
+
+	for (int k=n-1;k>=0;k--)
+	{
+		double sum[LANES] = {0};
+		for (int j=k+1;j<n;j++)
+			for (int l=0;l<LANES;l++)
+				sum[l] += A[k][j][l] * x[j][l];
+
+		for (int l=0;l<LANES;l++)
+			x[k][l] = (y[k][l] - sum[l]) / (singular[l] ? 1 : A[k][k][l]);
+	}
+}
+
 #endif
 
@@ -26,6 +26,7 @@ SOFTWARE.*/
 #include "matrix_vector.h"
 #include "eigendecomposition.h"
 #include "lup_decomposition.h"
+#include "mahalonobis_transform.h"
 
 
 static void compute_matrix_inverse_product(int n, double* LU, int* pivot, double* A, double* C)
@@ -38,42 +39,58 @@ static void compute_matrix_inverse_product(int n, double* LU, int* pivot, double
 		lup_solve(n, LU, pivot, &A[j * n], &C[j * n]);
 }
 
-void mahalonobis_transform(int n, double* T, double* B, double* Ktrans)
+bool prepare_basis(double* B, PreparedBasis* prepared)
 {
 	// compute LU decomposition of B
-	double LU[9], Hinvsqrt[16];
+	double LU[9];
 	int pivot[3];
+	memcpy(LU, B, 9 * sizeof(double));
+	transpose<3>(LU);
+	if (!lup_decompose(3, LU, pivot))
+	{
+		for (int i=0;i<9;i++)
+			prepared->inverse[i] = NAN;
+		return false;
+	}
 
+	// B^{-1} is computed once per basis, so that each transform only needs
+	// matrix products: K = T B^{-1}
+	double identity[9] = {1, 0, 0, 0, 1, 0, 0, 0, 1};
+	compute_matrix_inverse_product(3, LU, pivot, identity, prepared->inverse);
+	return true;
+}
 
-	memcpy(LU, B, 9 * sizeof(double));
-	transpose(3, LU);
-	lup_decompose(3, LU, pivot);	//todo: check return code
+template <int n>
+void mahalonobis_transform(double* T, PreparedBasis* prepared, double* Ktrans,
+				double* Hsqrt, double* p_Hinvsqrt)
+{
+	double Hinvsqrt[n * n];
 
-	double K[4 * 9];
+	double K[n * 9];
 	for (int i=0;i<n;i++)
-		compute_matrix_inverse_product(3, LU, pivot, &T[i * 9], &K[i * 9]);
+		matmul<3>(&T[i * 9], prepared->inverse, &K[i * 9]);
 
-	double H[4 * 4] = {0};
+	double H[n * n] = {0};
 	for (int i=0;i<n;i++)
 		for (int j=0;j<n;j++)
 			H[i * n + j] += frobenius_inner_product(&K[i * 9], &K[j * 9]);
 
-	double l[4], V[16];
+	double l[n], V[n * n];
 	eigendecomposition(n, H, l, V);
 
-	double d[16] = {0};
+	double d[n * n] = {0};
 	for (int i=0;i<n;i++)
 		d[i*n + i] = 1. / sqrt(l[i]);
 
 #if 1
-	double VT[16];
-	double Vd[16];
+	double VT[n * n];
+	double Vd[n * n];
 	memcpy(VT, V, n * n * sizeof(double));
-	transpose(n, VT);
-	matmul(n, V, d, Vd);
-	matmul(n, Vd, VT, Hinvsqrt);
+	transpose<n>(VT);
+	matmul<n>(V, d, Vd);
+	matmul<n>(Vd, VT, Hinvsqrt);
 #else
-	matmul(n, V, d, Hinvsqrt);
+	matmul<n>(V, d, Hinvsqrt);
 #endif
 
 	memset(Ktrans, 0, 9 * n * sizeof(double));
@@ -88,5 +105,23 @@ void mahalonobis_transform(int n, double* T, double* B, double* Ktrans)
 			}
 		}
 	}
+
+	// the square roots map between the coefficients x of the transformed
+	// templates and the coefficients y = H^{-1/2} x of the original templates
+	if (p_Hinvsqrt != NULL)
+		memcpy(p_Hinvsqrt, Hinvsqrt, n * n * sizeof(double));
+
+	if (Hsqrt != NULL)
+	{
+		for (int i=0;i<n;i++)
+			d[i*n + i] = sqrt(l[i]);
+
+		matmul<n>(V, d, Vd);
+		matmul<n>(Vd, VT, Hsqrt);
+	}
 }
 
+template void mahalonobis_transform<1>(double* T, PreparedBasis* prepared, double* Ktrans, double* Hsqrt, double* Hinvsqrt);
+template void mahalonobis_transform<2>(double* T, PreparedBasis* prepared, double* Ktrans, double* Hsqrt, double* Hinvsqrt);
+template void mahalonobis_transform<3>(double* T, PreparedBasis* prepared, double* Ktrans, double* Hsqrt, double* Hinvsqrt);
+template void mahalonobis_transform<4>(double* T, PreparedBasis* prepared, double* Ktrans, double* Hsqrt, double* Hinvsqrt);
@@ -24,7 +24,19 @@ SOFTWARE.*/
 #ifndef MAHALONOBIS_TRANSFORM_H
 #define MAHALONOBIS_TRANSFORM_H
 
-void mahalonobis_transform(int n, double* T, double* B, double* Ktrans);
+// Inverse of a lattice basis, computed once and shared by all transforms
+// against that basis
+typedef struct
+{
+	double inverse[9];
+} PreparedBasis;
+
+bool prepare_basis(double* B, PreparedBasis* prepared);
+
+// Transform of n templates, instantiated for 1 <= n <= 4
+template <int n>
+void mahalonobis_transform(double* T, PreparedBasis* prepared, double* Ktrans,
+				double* Hsqrt, double* Hinvsqrt);	//H^{1/2} and H^{-1/2}, may be NULL
 
 #endif
 
@@ -24,27 +24,133 @@ SOFTWARE.*/
 #ifndef MATRIX_VECTOR_H
 #define MATRIX_VECTOR_H
 
+#include <cmath>
 #include <stdint.h>
+#include <utility>
 
+// Small dense linear algebra on row-major arrays.  The sizes are template
+// parameters and the functions are defined here, so that they are inlined
+// into the calling loops with the operands kept in registers.  Products
+// accumulate in the element type of the result, which may differ from those
+// of the operands (e.g. an integer matrix times a double matrix).
 
-void swap(double* a, double* b);
-double vector_dot(int n, double* a, double* b);
-double vector_norm(int n, double* x);
-void normalize_vector(int n, double* x);
-void matvec(int n, double* A, double* x, double* b);
-void matveci(int n, double* A, int* x, double* b);
-void transpose(int n, double* A);
-void transposei(int n, int* A);
-double frobenius_inner_product(double* A, double* B);
-void matmul(int n, double* A, double* x, double* b);
-void matmuli(int n, int* A, int* x, int* b);
-void matmul_int8(int n, int* A, int8_t* x, int* b);
-void matmul_di(int n, double* A, int* x, double* b);
-void matmul_id(int n, int* A, double* x, double* b);
-double determinant_3x3(double* m);
-void unimodular_inverse_3x3i(int* A, int* B);
-void flip_matrix(int n, double* m);
-void flip_matrix_i(int n, int* m);
+template <int n, typename T>
+inline T vector_dot(const T* a, const T* b)
+{
+	T dot = 0;
+	for (int i=0;i<n;i++)
+		dot += a[i] * b[i];
+	return dot;
+}
 
-#endif
+template <int n, typename T>
+inline T vector_norm(const T* x)
+{
+	return std::sqrt(vector_dot<n>(x, x));
+}
+
+template <int n, typename T>
+inline void normalize_vector(T* x)
+{
+	T norm = vector_norm<n>(x);
+
+	for (int i=0;i<n;i++)
+		x[i] /= norm;
+}
+
+template <int n, typename TA, typename TX, typename TB>
+inline void matvec(const TA* A, const TX* x, TB* b)
+{
+	for (int i=0;i<n;i++)
+	{
+		TB acc = 0;
+		for (int j=0;j<n;j++)
+			acc += A[i * n + j] * x[j];
+
+		b[i] = acc;
+	}
+}
+
+template <int n, typename TA, typename TB, typename TC>
+inline void matmul(const TA* A, const TB* B, TC* C)
+{
+	for (int i=0;i<n;i++)
+	{
+		for (int j=0;j<n;j++)
+		{
+			TC acc = 0;
+			for (int k=0;k<n;k++)
+				acc += A[i * n + k] * B[k * n + j];
+
+			C[i * n + j] = acc;
+		}
+	}
+}
+
+template <int n, typename T>
+inline void transpose(T* A)
+{
+	for (int i=0;i<n;i++)
+		for (int j=i+1;j<n;j++)
+			std::swap(A[i * n + j], A[j * n + i]);
+}
+
+template <int n, typename T>
+inline void flip_matrix(T* m)
+{
+	for (int i=0;i<n*n;i++)
+		m[i] = -m[i];
+}
 
+template <typename T>
+inline T frobenius_inner_product(const T* A, const T* B)
+{
+	return vector_dot<9>(A, B);
+}
+
+template <typename T>
+inline T determinant_3x3(const T* m)
+{
+	/*	0 1 2
+		3 4 5
+		6 7 8	*/
+
+	return    m[0] * (m[4] * m[8] - m[5] * m[7])
+		- m[1] * (m[3] * m[8] - m[5] * m[6])
+		+ m[2] * (m[3] * m[7] - m[4] * m[6]);
+}
+
+// Adjugate, the inverse times the determinant
+template <typename T>
+inline void adjugate_3x3(const T* A, T* B)
+{
+	B[0] = A[4] * A[8] - A[5] * A[7];
+	B[1] = A[2] * A[7] - A[1] * A[8];
+	B[2] = A[1] * A[5] - A[2] * A[4];
+
+	B[3] = A[5] * A[6] - A[3] * A[8];
+	B[4] = A[0] * A[8] - A[2] * A[6];
+	B[5] = A[2] * A[3] - A[0] * A[5];
+
+	B[6] = A[3] * A[7] - A[4] * A[6];
+	B[7] = A[1] * A[6] - A[0] * A[7];
+	B[8] = A[0] * A[4] - A[1] * A[3];
+}
+
+inline void inverse_3x3(const double* A, double* Ainv)
+{
+	adjugate_3x3(A, Ainv);
+	double det = determinant_3x3(A);
+	for (int i=0;i<9;i++)
+		Ainv[i] /= det;
+}
+
+inline void unimodular_inverse_3x3i(const int* A, int* B)
+{
+	adjugate_3x3(A, B);
+	int sign = determinant_3x3(A);
+	for (int i=0;i<9;i++)
+		B[i] *= sign;
+}
+
+#endif
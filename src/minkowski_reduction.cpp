@@ -30,6 +30,8 @@ SOFTWARE.*/
 #include <cmath>
 #include <cstring>
 #include <algorithm>
+#include <cstdint>
+#include "cpu_dispatch.h"
 #include "matrix_vector.h"
 
 
@@ -38,48 +40,56 @@ SOFTWARE.*/
 const int max_it = 10000;	//in practice this is not exceeded
 
 
+// Detects revisited paths during reduction.  Paths are kept in a small
+// open-addressing hash table, so that insertion and lookup take constant time.
+// The table is cleared if it fills up; cycles are short in practice, and the
+// iteration count is bounded by max_it regardless.
 class CycleChecker
 {
 public:
     CycleChecker(int d) {
-        visited = data;
-        if (d == 2) {
-            max_cycle_length = (6 * 5) * (2 * 1);
-            size = 6;
-        }
-        else if (d == 3) {
-            max_cycle_length = (12 * 11 * 10) * (3 * 2 * 1);
-            size = 9;
-        }
-
-        memset(visited, 0, max_cycle_length * sizeof(int));
+        size = d == 2 ? 6 : 9;
+        count = 0;
+        memset(occupied, 0, sizeof(occupied));
     }
 
     bool add_site(int* path) {
-        bool found = false;
-        for (int i=0;i<max_cycle_length;i++) {
-            if (memcmp(path, &visited[i * size], size * sizeof(int)) == 0) {
-                found = true;
-                break;
-            }
+        if (count >= max_load) {
+            memset(occupied, 0, sizeof(occupied));
+            count = 0;
         }
 
-        // shift all visited sites down and place current site at the top
-        for (int i=0;i<max_cycle_length - 1;i++) {
-            memcpy(&visited[(i + 1) * size], &visited[i * size], size * sizeof(int));
+        uint32_t i = hash(path) & (capacity - 1);
+        while (occupied[i]) {
+            if (memcmp(path, &visited[i * 9], size * sizeof(int)) == 0)
+                return true;
+            i = (i + 1) & (capacity - 1);
         }
 
-        memcpy(&visited[0], path, size * sizeof(int));
-        return found;
+        occupied[i] = true;
+        memcpy(&visited[i * 9], path, size * sizeof(int));
+        count++;
+        return false;
     }
 
 
 private:
-    static const int nmax = 12 * 11 * 10 * 6;
-    int max_cycle_length;
+    static const int capacity = 256;
+    static const int max_load = 3 * capacity / 4;
     int size;
-    int data[nmax * 9];
-    int* visited;
+    int count;
+    bool occupied[capacity];
+    int visited[capacity * 9];
+
+    uint32_t hash(int* path) {
+        // FNV-1a over the path entries
+        uint32_t h = 2166136261u;
+        for (int i=0;i<size;i++) {
+            h ^= (uint32_t)path[i];
+            h *= 16777619u;
+        }
+        return h ^ (h >> 16);
+    }
 };
 
 static double round_even(double x)
@@ -104,24 +114,24 @@ static int gauss(double (*BT)[3], int* hu, int *hv)
 {
     CycleChecker cycle_checker = CycleChecker(2);
 	double u[3], v[3];
-	matveci(3, (double*)BT, hu, u);
-	matveci(3, (double*)BT, hv, v);
+	matvec<3>((double*)BT, hu, u);
+	matvec<3>((double*)BT, hv, v);
 
 	int temp[3];
 	for (int it=0;it<max_it;it++)
 	{
-		int x = (int)round_even(vector_dot(3, u, v) / vector_dot(3, u, u));
+		int x = (int)round_even(vector_dot<3>(u, v) / vector_dot<3>(u, u));
 
 		memcpy(temp, hu, 3 * sizeof(int));
 		for (int i=0;i<3;i++)
 			hu[i] = hv[i] - x * hu[i];
 		memcpy(hv, temp, 3 * sizeof(int));
 
-		matveci(3, (double*)BT, hu, u);
-		matveci(3, (double*)BT, hv, v);
+		matvec<3>((double*)BT, hu, u);
+		matvec<3>((double*)BT, hv, v);
 
         int path[6] = {hu[0], hu[1], hu[2], hv[0], hv[1], hv[2]};
-		if (vector_dot(3, u, u) >= vector_dot(3, v, v) or cycle_checker.add_site(path))
+		if (vector_dot<3>(u, u) >= vector_dot<3>(v, v) or cycle_checker.add_site(path))
 		{
 			memcpy(temp, hv, 3 * sizeof(int));
 			memcpy(hv, hu, 3 * sizeof(int));
@@ -155,7 +165,7 @@ static int closest_vector(double* t0, double* u, double* v, int* _a)
 	for (int it=0;it<max_it;it++)
 	{
 		int index = 0;
-		double best = vector_dot(2, t, t);
+		double best = vector_dot<2>(t, t);
 
 		//todo: only test 7 best
 		for (int i=0;i<9;i++)
@@ -178,7 +188,7 @@ static int closest_vector(double* t0, double* u, double* v, int* _a)
 		}
 
 		dprev = best;
-		int kopt = (int)round_even(-vector_dot(2, t, vs[index]) / vector_dot(2, vs[index], vs[index]));
+		int kopt = (int)round_even(-vector_dot<2>(t, vs[index]) / vector_dot<2>(vs[index], vs[index]));
 		a[0] += kopt * cs[index][0];
 		a[1] += kopt * cs[index][1];
 
@@ -242,11 +252,11 @@ static void column_norms(double (*BT)[3], double* norms)
 static void gram_schmidt(double (*Bprime)[3], double* X, double* Y)
 {
 	memcpy(X, Bprime[0], 3 * sizeof(double));
-	normalize_vector(3, X);
-	double dot = vector_dot(3, Bprime[1], X);
+	normalize_vector<3>(X);
+	double dot = vector_dot<3>(Bprime[1], X);
 	for (int i=0;i<3;i++)
 		Y[i] = Bprime[1][i] - dot * X[i];
-	normalize_vector(3, Y);
+	normalize_vector<3>(Y);
 }
 
 static int _minkowski_basis(double (*BT)[3], double (*reduced_basis)[3], int (*output_path)[3])
@@ -267,20 +277,20 @@ static int _minkowski_basis(double (*BT)[3], double (*reduced_basis)[3], int (*o
 			return ret;
 
 		double Bprime[3][3];
-		matveci(3, (double*)BT, path[0], Bprime[0]);
-		matveci(3, (double*)BT, path[1], Bprime[1]);
-		matveci(3, (double*)BT, path[2], Bprime[2]);
+		matvec<3>((double*)BT, path[0], Bprime[0]);
+		matvec<3>((double*)BT, path[1], Bprime[1]);
+		matvec<3>((double*)BT, path[2], Bprime[2]);
 
 		double X[3], Y[3];
 		gram_schmidt(Bprime, X, Y);
 
 		double pu[2], pv[2], pw[2], temp[3];
-		matvec(3, (double*)Bprime, X, temp);
+		matvec<3>((double*)Bprime, X, temp);
 		pu[0] = temp[0];
 		pv[0] = temp[1];
 		pw[0] = temp[2];
 
-		matvec(3, (double*)Bprime, Y, temp);
+		matvec<3>((double*)Bprime, Y, temp);
 		pu[1] = temp[0];
 		pv[1] = temp[1];
 		pw[1] = temp[2];
@@ -296,13 +306,13 @@ static int _minkowski_basis(double (*BT)[3], double (*reduced_basis)[3], int (*o
 			path[2][i] += nb[1] * path[1][i];
 		}
 
-		matveci(3, (double*)BT, path[0], Bprime[0]);
-		matveci(3, (double*)BT, path[1], Bprime[1]);
-		matveci(3, (double*)BT, path[2], Bprime[2]);
+		matvec<3>((double*)BT, path[0], Bprime[0]);
+		matvec<3>((double*)BT, path[1], Bprime[1]);
+		matvec<3>((double*)BT, path[2], Bprime[2]);
 
-		norms[0] = vector_norm(3, Bprime[0]);
-		norms[1] = vector_norm(3, Bprime[1]);
-		norms[2] = vector_norm(3, Bprime[2]);
+		norms[0] = vector_norm<3>(Bprime[0]);
+		norms[1] = vector_norm<3>(Bprime[1]);
+		norms[2] = vector_norm<3>(Bprime[2]);
 
 		if (norms[2] >= norms[1] or cycle_checker.add_site((int*)path))
 		{
@@ -316,8 +326,8 @@ static int _minkowski_basis(double (*BT)[3], double (*reduced_basis)[3], int (*o
 					}
 			}
 
-			transpose(3, (double*)Bprime);
-			transposei(3, (int*)path);
+			transpose<3>((double*)Bprime);
+			transpose<3>((int*)path);
 			memcpy(reduced_basis, Bprime, 9 * sizeof(double));
 			memcpy(output_path, path, 9 * sizeof(int));
 			return 0;
@@ -331,11 +341,30 @@ static int _minkowski_basis(double (*BT)[3], double (*reduced_basis)[3], int (*o
 extern "C" {
 #endif
 
-int minkowski_basis(double (*BT)[3], double (*reduced_basis)[3], int (*output_path)[3])
+typedef int (*minkowski_kernel)(double (*BT)[3], double (*reduced_basis)[3], int (*output_path)[3]);
+
+static int minkowski_baseline(double (*BT)[3], double (*reduced_basis)[3], int (*output_path)[3])
 {
 	return _minkowski_basis(BT, reduced_basis, output_path);
 }
 
+TARGET_AVX2 static int minkowski_avx2(double (*BT)[3], double (*reduced_basis)[3], int (*output_path)[3])
+{
+	return _minkowski_basis(BT, reduced_basis, output_path);
+}
+
+TARGET_AVX512 static int minkowski_avx512(double (*BT)[3], double (*reduced_basis)[3], int (*output_path)[3])
+{
+	return _minkowski_basis(BT, reduced_basis, output_path);
+}
+
+int minkowski_basis(double (*BT)[3], double (*reduced_basis)[3], int (*output_path)[3])
+{
+	static const minkowski_kernel kernel = select_kernel<minkowski_kernel>(minkowski_baseline, minkowski_avx2,
+										minkowski_avx512);
+	return kernel(BT, reduced_basis, output_path);
+}
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,150 @@
+/*MIT License
+
+Copyright (c) 2019 P. M. Larsen
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.*/
+
+// The hash is linear in the entries of a correspondence (modulo 2^64), so the
+// hash of S L0 N is a fixed linear function of the entries of N for each
+// round.  Its nine coefficients are computed once per symmetry S, and the
+// neighbours are then processed in loops over contiguous columns, which the
+// compiler vectorizes.
+
+#include <algorithm>
+#include <cstdlib>
+#include "matrix_vector.h"
+#include "unimodular_functions.h"
+#include "unimodular_neighbourhood.h"
+#include "neighbourhood_sweep.h"
+
+
+#define BLOCK_SIZE 256
+
+// Whether a product A N can have entries outside the hashable range, from the
+// row sums of |A|, since the entries of N are in {-1, 0, 1}
+static bool may_exceed_range(int* A)
+{
+	for (int r=0;r<3;r++)
+		if (abs(A[r * 3 + 0]) + abs(A[r * 3 + 1]) + abs(A[r * 3 + 2]) > 68)
+			return true;
+	return false;
+}
+
+// Sets flags[i - begin] if A N_i has entries outside the hashable range, for
+// begin <= i < end.  Entries of A N are dot products of a row of A and a
+// column of N.
+static void flag_out_of_range(int* A, const int8_t* columns, int stride, int begin, int end, uint8_t* flags)
+{
+	if (!may_exceed_range(A))
+		return;
+
+	for (int r=0;r<3;r++)
+	{
+		for (int c=0;c<3;c++)
+		{
+			const int8_t* N0 = &columns[(0 * 3 + c) * stride + begin];
+			const int8_t* N1 = &columns[(1 * 3 + c) * stride + begin];
+			const int8_t* N2 = &columns[(2 * 3 + c) * stride + begin];
+			int a0 = A[r * 3 + 0], a1 = A[r * 3 + 1], a2 = A[r * 3 + 2];
+
+			for (int i=0;i<end-begin;i++)
+			{
+				int x = a0 * N0[i] + a1 * N1[i] + a2 * N2[i];
+				flags[i] |= (x > 68) | (x < -68);
+			}
+		}
+	}
+}
+
+void sweep_neighbourhood(	const TemplateSymmetry* symmetry,
+				int* L0,
+				int count,
+				uint64_t* keys,
+				uint8_t* too_large)
+{
+	const int8_t* columns = unimodular_neighbourhood_columns();
+	const int stride = unimodular_neighbourhood_size(MAX_NEIGHBOURHOOD_RADIUS);
+
+	for (int i=0;i<count;i++)
+	{
+		too_large[i] = 0;
+		keys[i] = UINT64_MAX;	//exceeds every hash
+	}
+	flag_out_of_range(L0, columns, stride, 0, count, too_large);
+
+	uint64_t w[9];
+	uint64_t offset = 0;
+	for (int k=0;k<9;k++)
+	{
+		w[k] = unimodular_hash_weight(k);
+		offset += 68 * w[k];
+	}
+
+	for (int s=0;s<symmetry->num_symmetries;s++)
+	{
+		int A[9];
+		matmul<3>((int*)symmetry->S[s], L0, A);
+
+		// hash(A N) = offset + sum_{j,c} N[j][c] sum_r w[r][c] A[r][j]
+		uint64_t coefficients[9];
+		for (int j=0;j<3;j++)
+		{
+			for (int c=0;c<3;c++)
+			{
+				uint64_t sum = 0;
+				for (int r=0;r<3;r++)
+					sum += w[r * 3 + c] * (uint64_t)A[r * 3 + j];
+				coefficients[j * 3 + c] = sum;
+			}
+		}
+
+		for (int begin=0;begin<count;begin+=BLOCK_SIZE)
+		{
+			int size = std::min(BLOCK_SIZE, count - begin);
+
+			uint64_t hash[BLOCK_SIZE];
+			for (int i=0;i<size;i++)
+				hash[i] = offset;
+
+			for (int k=0;k<9;k++)
+			{
+				const int8_t* N = &columns[k * stride + begin];
+				uint64_t coefficient = coefficients[k];
+				for (int i=0;i<size;i++)
+				{
+					// branch-free coefficient * N[i], for N[i] in {-1, 0, 1}
+					int64_t n = N[i];
+					uint64_t sign = (uint64_t)(n >> 63);
+					uint64_t nonzero = (uint64_t)(-(n & 1));
+					hash[i] += ((coefficient & nonzero) ^ sign) - sign;
+				}
+			}
+
+			// the hash is only injective in range, so symmetric images with
+			// larger entries are left out of the minimum; the minimum over the
+			// remaining images is still the same for every member of the class
+			uint8_t out_of_range[BLOCK_SIZE] = {0};
+			flag_out_of_range(A, columns, stride, begin, begin + size, out_of_range);
+
+			uint64_t* block_keys = &keys[begin];
+			for (int i=0;i<size;i++)
+				block_keys[i] = out_of_range[i] ? block_keys[i] : std::min(block_keys[i], hash[i]);
+		}
+	}
+}
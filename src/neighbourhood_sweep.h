@@ -0,0 +1,40 @@
+/*MIT License
+
+Copyright (c) 2019 P. M. Larsen
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.*/
+
+#ifndef NEIGHBOURHOOD_SWEEP_H
+#define NEIGHBOURHOOD_SWEEP_H
+
+#include <stdint.h>
+#include "template_symmetry.h"
+
+// Screens the neighbours L0 N_i (i < count) of a correspondence L0, using the
+// structure-of-arrays neighbourhood table.  keys[i] receives the hash of
+// L0 N_i minimized over the template symmetries S, i.e. min_S hash(S L0 N_i),
+// where only the S L0 N_i with entries in the hashable range take part, and
+// too_large[i] whether L0 N_i has entries outside that range.
+void sweep_neighbourhood(	const TemplateSymmetry* symmetry,
+				int* L0,
+				int count,
+				uint64_t* keys,
+				uint8_t* too_large);
+
+#endif
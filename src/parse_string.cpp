@@ -21,82 +21,86 @@ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 SOFTWARE.*/
 
 
-#include <map>
-#include <string>
+#include <cstring>
 #include "constants.h"
 
 
+struct BravaisName
+{
+	const char* name;
+	int type;
+};
+
+static const BravaisName lookup[] = {
+	{"triclinic", TRICLINIC},
+	{"primitive triclinic", TRICLINIC},
+	{"aP", TRICLINIC},
+
+	{"monoclinic", MONOCLINIC},
+	{"primitive monoclinic", MONOCLINIC},
+	{"mP", MONOCLINIC},
+
+	{"base-centred monoclinic", BASEMONOCLINIC},
+	{"base-centered monoclinic", BASEMONOCLINIC},
+	{"mS", BASEMONOCLINIC},
+	{"mC", BASEMONOCLINIC},
+
+	{"orthorhombic", ORTHORHOMBIC},
+	{"primitive orthorhombic", ORTHORHOMBIC},
+	{"oP", ORTHORHOMBIC},
+
+	{"base-centred orthorhombic", BASECO},
+	{"base-centered orthorhombic", BASECO},
+	{"oS", BASECO},
+	{"oC", BASECO},
+
+	{"body-centred orthorhombic", BCO},
+	{"body-centered orthorhombic", BCO},
+	{"oF", BCO},
+
+	{"face-centred orthorhombic", FCO},
+	{"face-centered orthorhombic", FCO},
+	{"oI", FCO},
+
+	{"tetragonal", TETRAGONAL},
+	{"primitive tetragonal", TETRAGONAL},
+	{"tP", TETRAGONAL},
+
+	{"body-centred tetragonal", BCT},
+	{"body-centered tetragonal", BCT},
+	{"tI", BCT},
+
+	{"rhombohedral", RHOMBOHEDRAL},
+	{"primitive rhombohedral", RHOMBOHEDRAL},
+	{"hP", RHOMBOHEDRAL},
+
+	{"hexagonal", HEXAGONAL},
+	{"primitive hexagonal", HEXAGONAL},
+	{"hR", HEXAGONAL},
+
+	{"cubic", CUBIC},
+	{"primitive cubic", CUBIC},
+	{"cP", CUBIC},
+
+	{"body-centred cubic", BCC},
+	{"body-centered cubic", BCC},
+	{"bcc", BCC},
+	{"BCC", BCC},
+	{"cF", BCC},
+
+	{"face-centred cubic", FCC},
+	{"face-centered cubic", FCC},
+	{"fcc", FCC},
+	{"FCC", FCC},
+	{"cI", FCC},
+};
+
 int parse_string(char* name)
 {
-	std::map<std::string, int> lookup;
-	lookup.insert(std::make_pair("triclinic", TRICLINIC));
-	lookup.insert(std::make_pair("primitive triclinic", TRICLINIC));
-	lookup.insert(std::make_pair("aP", TRICLINIC));
-
-	lookup.insert(std::make_pair("monoclinic", MONOCLINIC));
-	lookup.insert(std::make_pair("primitive monoclinic", MONOCLINIC));
-	lookup.insert(std::make_pair("mP", MONOCLINIC));
-
-	lookup.insert(std::make_pair("base-centred monoclinic", BASEMONOCLINIC));
-	lookup.insert(std::make_pair("base-centered monoclinic", BASEMONOCLINIC));
-	lookup.insert(std::make_pair("mS", BASEMONOCLINIC));
-	lookup.insert(std::make_pair("mC", BASEMONOCLINIC));
-
-	lookup.insert(std::make_pair("orthorhombic", ORTHORHOMBIC));
-	lookup.insert(std::make_pair("primitive orthorhombic", ORTHORHOMBIC));
-	lookup.insert(std::make_pair("oP", ORTHORHOMBIC));
-
-	lookup.insert(std::make_pair("base-centred orthorhombic", BASECO));
-	lookup.insert(std::make_pair("base-centered orthorhombic", BASECO));
-	lookup.insert(std::make_pair("oS", BASECO));
-	lookup.insert(std::make_pair("oC", BASECO));
-
-	lookup.insert(std::make_pair("body-centred orthorhombic", BCO));
-	lookup.insert(std::make_pair("body-centered orthorhombic", BCO));
-	lookup.insert(std::make_pair("oF", BCO));
-
-	lookup.insert(std::make_pair("face-centred orthorhombic", FCO));
-	lookup.insert(std::make_pair("face-centered orthorhombic", FCO));
-	lookup.insert(std::make_pair("oI", FCO));
-
-	lookup.insert(std::make_pair("tetragonal", TETRAGONAL));
-	lookup.insert(std::make_pair("primitive tetragonal", TETRAGONAL));
-	lookup.insert(std::make_pair("tP", TETRAGONAL));
-
-	lookup.insert(std::make_pair("body-centred tetragonal", BCT));
-	lookup.insert(std::make_pair("body-centered tetragonal", BCT));
-	lookup.insert(std::make_pair("tI", BCT));
-
-	lookup.insert(std::make_pair("rhombohedral", RHOMBOHEDRAL));
-	lookup.insert(std::make_pair("primitive rhombohedral", RHOMBOHEDRAL));
-	lookup.insert(std::make_pair("hP", RHOMBOHEDRAL));
-
-	lookup.insert(std::make_pair("hexagonal", HEXAGONAL));
-	lookup.insert(std::make_pair("primitive hexagonal", HEXAGONAL));
-	lookup.insert(std::make_pair("hR", HEXAGONAL));
-
-	lookup.insert(std::make_pair("cubic", CUBIC));
-	lookup.insert(std::make_pair("primitive cubic", CUBIC));
-	lookup.insert(std::make_pair("cP", CUBIC));
-
-	lookup.insert(std::make_pair("body-centred cubic", BCC));
-	lookup.insert(std::make_pair("body-centered cubic", BCC));
-	lookup.insert(std::make_pair("bcc", BCC));
-	lookup.insert(std::make_pair("BCC", BCC));
-	lookup.insert(std::make_pair("cF", BCC));
-
-	lookup.insert(std::make_pair("face-centred cubic", FCC));
-	lookup.insert(std::make_pair("face-centered cubic", FCC));
-	lookup.insert(std::make_pair("fcc", FCC));
-	lookup.insert(std::make_pair("FCC", FCC));
-	lookup.insert(std::make_pair("cI", FCC));
-
-	std::string sname = std::string(name);
-	std::map<std::string, int>::iterator it = lookup.find(sname);
-	if (it != lookup.end()) {
-		return it->second;
-	}
+	int num_names = sizeof(lookup) / sizeof(BravaisName);
+	for (int i=0;i<num_names;i++)
+		if (strcmp(name, lookup[i].name) == 0)
+			return lookup[i].type;
 
 	return -1;
 }
-
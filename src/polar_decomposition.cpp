@@ -88,215 +88,432 @@
 #include <cmath>
 #include <algorithm>
 #include <string.h>
-#include "quaternion.h"
+#include "cpu_dispatch.h"
+#include "polar_decomposition.h"
 
 
-static void matmul_3x3(double* A, double* x, double* b)
-{
-	b[0] = A[0] * x[0] + A[1] * x[3] + A[2] * x[6];
-	b[3] = A[3] * x[0] + A[4] * x[3] + A[5] * x[6];
-	b[6] = A[6] * x[0] + A[7] * x[3] + A[8] * x[6];
-
-	b[1] = A[0] * x[1] + A[1] * x[4] + A[2] * x[7];
-	b[4] = A[3] * x[1] + A[4] * x[4] + A[5] * x[7];
-	b[7] = A[6] * x[1] + A[7] * x[4] + A[8] * x[7];
-
-	b[2] = A[0] * x[2] + A[1] * x[5] + A[2] * x[8];
-	b[5] = A[3] * x[2] + A[4] * x[5] + A[5] * x[8];
-	b[8] = A[6] * x[2] + A[7] * x[5] + A[8] * x[8];
-}
+// Convergence tolerances of the QCP method.  In single precision the
+// eigenvalue is only resolved to a few units in the last place.
+template <typename T> struct Tolerance;
 
-static double matrix_determinant_3x3(double* A)
+template <> struct Tolerance<double>
 {
-	return    A[0] * (A[4]*A[8] - A[5]*A[7])
-		- A[1] * (A[3]*A[8] - A[5]*A[6])
-		+ A[2] * (A[3]*A[7] - A[4]*A[6]);
-}
+	static constexpr double eigenvector = 1e-6;
+	static constexpr double eigenvalue = 1e-11;
+};
 
-static void flip_matrix(double* A)
+template <> struct Tolerance<float>
 {
-	for (int i=0;i<9;i++)
-		A[i] = -A[i];
-}
-
-static bool optimal_quaternion(double* A, bool polar, double E0, double* p_nrmsdsq, double* qopt)
+	static constexpr float eigenvector = 1e-6f;
+	static constexpr float eigenvalue = 1e-6f;
+};
+
+// The decomposition is computed for LANES matrices at a time, in
+// structure-of-arrays layout: A[k][l] is element k of matrix l.  Every step is
+// a loop over the lanes, and the Newton-Raphson iteration runs until all lanes
+// have converged, so that the loops vectorize.  With a single lane, the
+// arithmetic is that of the scalar QCP code.
+
+template <typename T, int LANES>
+static void optimal_quaternion(T (*A)[LANES], T (*qopt)[LANES])
 {
-	const double evecprec = 1e-6;
-	const double evalprec = 1e-11;
-
-	double	Sxx = A[0], Sxy = A[1], Sxz = A[2],
-		Syx = A[3], Syy = A[4], Syz = A[5],
-		Szx = A[6], Szy = A[7], Szz = A[8];
-
-	double	Sxx2 = Sxx * Sxx, Syy2 = Syy * Syy, Szz2 = Szz * Szz,
-		Sxy2 = Sxy * Sxy, Syz2 = Syz * Syz, Sxz2 = Sxz * Sxz,
-		Syx2 = Syx * Syx, Szy2 = Szy * Szy, Szx2 = Szx * Szx;
-
-	double fnorm_squared = Sxx2 + Syy2 + Szz2 + Sxy2 + Syz2 + Sxz2 + Syx2 + Szy2 + Szx2;
-
-	double SyzSzymSyySzz2 = 2.0 * (Syz * Szy - Syy * Szz);
-	double Sxx2Syy2Szz2Syz2Szy2 = Syy2 + Szz2 - Sxx2 + Syz2 + Szy2;
-	double SxzpSzx = Sxz + Szx;
-	double SyzpSzy = Syz + Szy;
-	double SxypSyx = Sxy + Syx;
-	double SyzmSzy = Syz - Szy;
-	double SxzmSzx = Sxz - Szx;
-	double SxymSyx = Sxy - Syx;
-	double SxxpSyy = Sxx + Syy;
-	double SxxmSyy = Sxx - Syy;
-	double Sxy2Sxz2Syx2Szx2 = Sxy2 + Sxz2 - Syx2 - Szx2;
-
-	double C[3];
-	C[0] = Sxy2Sxz2Syx2Szx2 * Sxy2Sxz2Syx2Szx2
-		 + (Sxx2Syy2Szz2Syz2Szy2 + SyzSzymSyySzz2) * (Sxx2Syy2Szz2Syz2Szy2 - SyzSzymSyySzz2)
-		 + (-(SxzpSzx)*(SyzmSzy)+(SxymSyx)*(SxxmSyy-Szz)) * (-(SxzmSzx)*(SyzpSzy)+(SxymSyx)*(SxxmSyy+Szz))
-		 + (-(SxzpSzx)*(SyzpSzy)-(SxypSyx)*(SxxpSyy-Szz)) * (-(SxzmSzx)*(SyzmSzy)-(SxypSyx)*(SxxpSyy+Szz))
-		 + (+(SxypSyx)*(SyzpSzy)+(SxzpSzx)*(SxxmSyy+Szz)) * (-(SxymSyx)*(SyzmSzy)+(SxzpSzx)*(SxxpSyy+Szz))
-		 + (+(SxypSyx)*(SyzmSzy)+(SxzmSzx)*(SxxmSyy-Szz)) * (-(SxymSyx)*(SyzpSzy)+(SxzmSzx)*(SxxpSyy-Szz));
-
-	C[1] = 8.0 * (Sxx*Syz*Szy + Syy*Szx*Sxz + Szz*Sxy*Syx - Sxx*Syy*Szz - Syz*Szx*Sxy - Szy*Syx*Sxz);
-	C[2] = -2.0 * fnorm_squared;
+	const T evecprec = Tolerance<T>::eigenvector;
+	const T evalprec = Tolerance<T>::eigenvalue;
+
+	T C[3][LANES];
+	T mxEigenV[LANES];
+	T a[4][4][LANES];
+	for (int l=0;l<LANES;l++)
+	{
+		T	Sxx = A[0][l], Sxy = A[1][l], Sxz = A[2][l],
+			Syx = A[3][l], Syy = A[4][l], Syz = A[5][l],
+			Szx = A[6][l], Szy = A[7][l], Szz = A[8][l];
+
+		T	Sxx2 = Sxx * Sxx, Syy2 = Syy * Syy, Szz2 = Szz * Szz,
+			Sxy2 = Sxy * Sxy, Syz2 = Syz * Syz, Sxz2 = Sxz * Sxz,
+			Syx2 = Syx * Syx, Szy2 = Szy * Szy, Szx2 = Szx * Szx;
+
+		T fnorm_squared = Sxx2 + Syy2 + Szz2 + Sxy2 + Syz2 + Sxz2 + Syx2 + Szy2 + Szx2;
+
+		T SyzSzymSyySzz2 = 2.0 * (Syz * Szy - Syy * Szz);
+		T Sxx2Syy2Szz2Syz2Szy2 = Syy2 + Szz2 - Sxx2 + Syz2 + Szy2;
+		T SxzpSzx = Sxz + Szx;
+		T SyzpSzy = Syz + Szy;
+		T SxypSyx = Sxy + Syx;
+		T SyzmSzy = Syz - Szy;
+		T SxzmSzx = Sxz - Szx;
+		T SxymSyx = Sxy - Syx;
+		T SxxpSyy = Sxx + Syy;
+		T SxxmSyy = Sxx - Syy;
+		T Sxy2Sxz2Syx2Szx2 = Sxy2 + Sxz2 - Syx2 - Szx2;
+
+		C[0][l] = Sxy2Sxz2Syx2Szx2 * Sxy2Sxz2Syx2Szx2
+			 + (Sxx2Syy2Szz2Syz2Szy2 + SyzSzymSyySzz2) * (Sxx2Syy2Szz2Syz2Szy2 - SyzSzymSyySzz2)
+			 + (-(SxzpSzx)*(SyzmSzy)+(SxymSyx)*(SxxmSyy-Szz)) * (-(SxzmSzx)*(SyzpSzy)+(SxymSyx)*(SxxmSyy+Szz))
+			 + (-(SxzpSzx)*(SyzpSzy)-(SxypSyx)*(SxxpSyy-Szz)) * (-(SxzmSzx)*(SyzmSzy)-(SxypSyx)*(SxxpSyy+Szz))
+			 + (+(SxypSyx)*(SyzpSzy)+(SxzpSzx)*(SxxmSyy+Szz)) * (-(SxymSyx)*(SyzmSzy)+(SxzpSzx)*(SxxpSyy+Szz))
+			 + (+(SxypSyx)*(SyzmSzy)+(SxzmSzx)*(SxxmSyy-Szz)) * (-(SxymSyx)*(SyzpSzy)+(SxzmSzx)*(SxxpSyy-Szz));
+
+		C[1][l] = 8.0 * (Sxx*Syz*Szy + Syy*Szx*Sxz + Szz*Sxy*Syx - Sxx*Syy*Szz - Syz*Szx*Sxy - Szy*Syx*Sxz);
+		C[2][l] = -2.0 * fnorm_squared;
+		mxEigenV[l] = std::sqrt(3 * fnorm_squared);
+
+		// the largest eigenvalue is subtracted from the diagonal below
+		a[0][0][l] = SxxpSyy + Szz;
+		a[0][1][l] = SyzmSzy;
+		a[0][2][l] = -SxzmSzx;
+		a[0][3][l] = SxymSyx;
+
+		a[1][0][l] = SyzmSzy;
+		a[1][1][l] = SxxmSyy - Szz;
+		a[1][2][l] = SxypSyx;
+		a[1][3][l] = SxzpSzx;
+
+		a[2][2][l] = Syy - Sxx - Szz;
+		a[2][3][l] = SyzpSzy;
+		a[3][3][l] = Szz - SxxpSyy;
+	}
 
 	//Newton-Raphson
-	double mxEigenV = polar ? sqrt(3 * fnorm_squared) : E0;
-	if (mxEigenV > evalprec)
+	bool active[LANES];
+	bool positive[LANES];
+	bool any = false;
+	for (int l=0;l<LANES;l++)
 	{
-		for (int i=0;i<50;i++)
+		positive[l] = mxEigenV[l] > evalprec;
+		active[l] = positive[l];
+		any |= active[l];
+	}
+
+	for (int i=0;i<50 && any;i++)
+	{
+		any = false;
+		for (int l=0;l<LANES;l++)
 		{
-			double oldg = mxEigenV;
-			double x2 = mxEigenV*mxEigenV;
-			double b = (x2 + C[2])*mxEigenV;
-			double a = b + C[1];
-			double delta = ((a * mxEigenV + C[0]) / (2 * x2 * mxEigenV + b + a));
-			mxEigenV -= delta;
-			if (fabs(mxEigenV - oldg) < fabs(evalprec * mxEigenV))
-				break;
+			T oldg = mxEigenV[l];
+			T x2 = oldg*oldg;
+			T b = (x2 + C[2][l])*oldg;
+			T aa = b + C[1][l];
+			T delta = ((aa * oldg + C[0][l]) / (2 * x2 * oldg + b + aa));
+			T next = oldg - delta;
+			bool converged = std::fabs(next - oldg) < std::fabs(evalprec * next);
+			mxEigenV[l] = active[l] ? next : oldg;
+			active[l] = active[l] && !converged;
+			any |= active[l];
 		}
 	}
-	else
+
+	T q[4][4][LANES];
+	T qsqr[4][LANES];
+	for (int l=0;l<LANES;l++)
 	{
-		mxEigenV = 0.0;
+		T mx = positive[l] ? mxEigenV[l] : 0;
+
+		T a11 = a[0][0][l] - mx;
+		T a12 = a[0][1][l];
+		T a13 = a[0][2][l];
+		T a14 = a[0][3][l];
+
+		T a21 = a[1][0][l];
+		T a22 = a[1][1][l] - mx;
+		T a23 = a[1][2][l];
+		T a24 = a[1][3][l];
+
+		T a31 = a13;
+		T a32 = a23;
+		T a33 = a[2][2][l] - mx;
+		T a34 = a[2][3][l];
+
+		T a41 = a14;
+		T a42 = a24;
+		T a43 = a34;
+		T a44 = a[3][3][l] - mx;
+
+		T a3344_4334 = a33 * a44 - a43 * a34;
+		T a3244_4234 = a32 * a44 - a42 * a34;
+		T a3243_4233 = a32 * a43 - a42 * a33;
+		T a3143_4133 = a31 * a43 - a41 * a33;
+		T a3144_4134 = a31 * a44 - a41 * a34;
+		T a3142_4132 = a31 * a42 - a41 * a32;
+		T a1324_1423 = a13 * a24 - a14 * a23;
+		T a1224_1422 = a12 * a24 - a14 * a22;
+		T a1223_1322 = a12 * a23 - a13 * a22;
+		T a1124_1421 = a11 * a24 - a14 * a21;
+		T a1123_1321 = a11 * a23 - a13 * a21;
+		T a1122_1221 = a11 * a22 - a12 * a21;
+
+		q[0][0][l] =  a12 * a3344_4334 - a13 * a3244_4234 + a14 * a3243_4233;
+		q[0][1][l] = -a11 * a3344_4334 + a13 * a3144_4134 - a14 * a3143_4133;
+		q[0][2][l] =  a11 * a3244_4234 - a12 * a3144_4134 + a14 * a3142_4132;
+		q[0][3][l] = -a11 * a3243_4233 + a12 * a3143_4133 - a13 * a3142_4132;
+
+		q[1][0][l] =  a22 * a3344_4334 - a23 * a3244_4234 + a24 * a3243_4233;
+		q[1][1][l] = -a21 * a3344_4334 + a23 * a3144_4134 - a24 * a3143_4133;
+		q[1][2][l] =  a21 * a3244_4234 - a22 * a3144_4134 + a24 * a3142_4132;
+		q[1][3][l] = -a21 * a3243_4233 + a22 * a3143_4133 - a23 * a3142_4132;
+
+		q[2][0][l] =  a32 * a1324_1423 - a33 * a1224_1422 + a34 * a1223_1322;
+		q[2][1][l] = -a31 * a1324_1423 + a33 * a1124_1421 - a34 * a1123_1321;
+		q[2][2][l] =  a31 * a1224_1422 - a32 * a1124_1421 + a34 * a1122_1221;
+		q[2][3][l] = -a31 * a1223_1322 + a32 * a1123_1321 - a33 * a1122_1221;
+
+		q[3][0][l] =  a42 * a1324_1423 - a43 * a1224_1422 + a44 * a1223_1322;
+		q[3][1][l] = -a41 * a1324_1423 + a43 * a1124_1421 - a44 * a1123_1321;
+		q[3][2][l] =  a41 * a1224_1422 - a42 * a1124_1421 + a44 * a1122_1221;
+		q[3][3][l] = -a41 * a1223_1322 + a42 * a1123_1321 - a43 * a1122_1221;
+
+		for (int i=0;i<4;i++)
+			qsqr[i][l] = q[i][0][l]*q[i][0][l] + q[i][1][l]*q[i][1][l] + q[i][2][l]*q[i][2][l] + q[i][3][l]*q[i][3][l];
 	}
 
-	(*p_nrmsdsq) = std::max(0.0, 2.0 * (E0 - mxEigenV));
-
-	double a11 = SxxpSyy + Szz - mxEigenV;
-	double a12 = SyzmSzy;
-	double a13 = -SxzmSzx;
-	double a14 = SxymSyx;
-
-	double a21 = SyzmSzy;
-	double a22 = SxxmSyy - Szz  -mxEigenV;
-	double a23 = SxypSyx;
-	double a24 = SxzpSzx;
-
-	double a31 = a13;
-	double a32 = a23;
-	double a33 = Syy - Sxx - Szz - mxEigenV;
-	double a34 = SyzpSzy;
-
-	double a41 = a14;
-	double a42 = a24;
-	double a43 = a34;
-	double a44 = Szz - SxxpSyy - mxEigenV;
-
-	double a3344_4334 = a33 * a44 - a43 * a34;
-	double a3244_4234 = a32 * a44 - a42 * a34;
-	double a3243_4233 = a32 * a43 - a42 * a33;
-	double a3143_4133 = a31 * a43 - a41 * a33;
-	double a3144_4134 = a31 * a44 - a41 * a34;
-	double a3142_4132 = a31 * a42 - a41 * a32;
-	double a1324_1423 = a13 * a24 - a14 * a23;
-	double a1224_1422 = a12 * a24 - a14 * a22;
-	double a1223_1322 = a12 * a23 - a13 * a22;
-	double a1124_1421 = a11 * a24 - a14 * a21;
-	double a1123_1321 = a11 * a23 - a13 * a21;
-	double a1122_1221 = a11 * a22 - a12 * a21;
-
-	double q[4][4];
-	q[0][0] =  a12 * a3344_4334 - a13 * a3244_4234 + a14 * a3243_4233;
-	q[0][1] = -a11 * a3344_4334 + a13 * a3144_4134 - a14 * a3143_4133;
-	q[0][2] =  a11 * a3244_4234 - a12 * a3144_4134 + a14 * a3142_4132;
-	q[0][3] = -a11 * a3243_4233 + a12 * a3143_4133 - a13 * a3142_4132;
-
-	q[1][0] =  a22 * a3344_4334 - a23 * a3244_4234 + a24 * a3243_4233;
-	q[1][1] = -a21 * a3344_4334 + a23 * a3144_4134 - a24 * a3143_4133;
-	q[1][2] =  a21 * a3244_4234 - a22 * a3144_4134 + a24 * a3142_4132;
-	q[1][3] = -a21 * a3243_4233 + a22 * a3143_4133 - a23 * a3142_4132;
-
-	q[2][0] =  a32 * a1324_1423 - a33 * a1224_1422 + a34 * a1223_1322;
-	q[2][1] = -a31 * a1324_1423 + a33 * a1124_1421 - a34 * a1123_1321;
-	q[2][2] =  a31 * a1224_1422 - a32 * a1124_1421 + a34 * a1122_1221;
-	q[2][3] = -a31 * a1223_1322 + a32 * a1123_1321 - a33 * a1122_1221;
-
-	q[3][0] =  a42 * a1324_1423 - a43 * a1224_1422 + a44 * a1223_1322;
-	q[3][1] = -a41 * a1324_1423 + a43 * a1124_1421 - a44 * a1123_1321;
-	q[3][2] =  a41 * a1224_1422 - a42 * a1124_1421 + a44 * a1122_1221;
-	q[3][3] = -a41 * a1223_1322 + a42 * a1123_1321 - a43 * a1122_1221;
-
-	double qsqr[4];
-	for (int i=0;i<4;i++)
-		qsqr[i] = q[i][0]*q[i][0] + q[i][1]*q[i][1] + q[i][2]*q[i][2] + q[i][3]*q[i][3];
-
-	int bi = 0;
-	double max = 0;
-	for (int i=0;i<4;i++)
+	// use the row of the adjoint with the largest norm
+	for (int l=0;l<LANES;l++)
 	{
-		if (qsqr[i] > max)
+		T best[4] = {q[0][0][l], q[0][1][l], q[0][2][l], q[0][3][l]};
+		T max = qsqr[0][l];
+		for (int i=1;i<4;i++)
 		{
-			bi = i;
-			max = qsqr[i];
+			bool larger = qsqr[i][l] > max;
+			max = larger ? qsqr[i][l] : max;
+			for (int j=0;j<4;j++)
+				best[j] = larger ? q[i][j][l] : best[j];
 		}
+
+		//if qsqr is still too small, return the identity rotation.  Both
+		//sides of the selection are evaluated, so the divisor is bounded
+		//away from zero to avoid raising floating-point exceptions.
+		T normq = std::sqrt(max);
+		bool too_small = normq < evecprec;
+		T divisor = std::sqrt(std::max(max, evecprec * evecprec));
+		qopt[0][l] = too_small ? 1 : best[0] / divisor;
+		qopt[1][l] = too_small ? 0 : best[1] / divisor;
+		qopt[2][l] = too_small ? 0 : best[2] / divisor;
+		qopt[3][l] = too_small ? 0 : best[3] / divisor;
 	}
+}
 
-	double normq = sqrt(qsqr[bi]);
-	bool too_small = false;
-	if (normq < evecprec)
+template <typename T, int LANES>
+static void polar_lanes(T (*A)[LANES], bool right_sided, T (*U)[LANES], T (*P)[LANES])
+{
+	T sign[LANES];
+	T B[9][LANES];
+	for (int l=0;l<LANES;l++)
 	{
-		//if qsqr is still too small, return the identity rotation.
-		q[bi][0] = 1;
-		q[bi][1] = 0;
-		q[bi][2] = 0;
-		q[bi][3] = 0;
-		too_small = true;
+		T det =	  A[0][l] * (A[4][l]*A[8][l] - A[5][l]*A[7][l])
+				- A[1][l] * (A[3][l]*A[8][l] - A[5][l]*A[6][l])
+				+ A[2][l] * (A[3][l]*A[7][l] - A[4][l]*A[6][l]);
+		sign[l] = det < 0 ? -1 : 1;
+		for (int k=0;k<9;k++)
+			B[k][l] = det < 0 ? -A[k][l] : A[k][l];
 	}
-	else
+
+	T q[4][LANES];
+	optimal_quaternion<T, LANES>(B, q);
+
+	for (int l=0;l<LANES;l++)
 	{
-		q[bi][0] /= normq;
-		q[bi][1] /= normq;
-		q[bi][2] /= normq;
-		q[bi][3] /= normq;
+		T a = -q[0][l];
+		T b = q[1][l];
+		T c = q[2][l];
+		T d = q[3][l];
+
+		T u[9];
+		u[0] = a*a + b*b - c*c - d*d;
+		u[1] = 2*b*c - 2*a*d;
+		u[2] = 2*b*d + 2*a*c;
+
+		u[3] = 2*b*c + 2*a*d;
+		u[4] = a*a - b*b + c*c - d*d;
+		u[5] = 2*c*d - 2*a*b;
+
+		u[6] = 2*b*d - 2*a*c;
+		u[7] = 2*c*d + 2*a*b;
+		u[8] = a*a - b*b - c*c + d*d;
+
+		for (int k=0;k<9;k++)
+			U[k][l] = sign[l] < 0 ? -u[k] : u[k];
 	}
 
-	memcpy(qopt, q[bi], 4 * sizeof(double));
-	return !too_small;
+	// P = U^T A for the right-sided decomposition, A U^T otherwise
+	for (int l=0;l<LANES;l++)
+	{
+		for (int i=0;i<3;i++)
+		{
+			for (int j=0;j<3;j++)
+			{
+				if (right_sided)
+					P[i * 3 + j][l] = U[i][l] * A[j][l] + U[3 + i][l] * A[3 + j][l] + U[6 + i][l] * A[6 + j][l];
+				else
+					P[i * 3 + j][l] = A[i * 3][l] * U[j * 3][l] + A[i * 3 + 1][l] * U[j * 3 + 1][l] + A[i * 3 + 2][l] * U[j * 3 + 2][l];
+			}
+		}
+	}
 }
 
-int polar_decomposition_3x3(double* _A, bool right_sided, double* U, double* P)
+// matrices per batch: 512 bits of lanes in either precision
+template <typename T> struct BatchLanes;
+template <> struct BatchLanes<double> { static constexpr int value = POLAR_LANES; };
+template <> struct BatchLanes<float> { static constexpr int value = POLAR_LANES_SINGLE; };
+
+template <typename T>
+static int _polar_decomposition_3x3(T* _A, bool right_sided, T* U, T* P)
 {
-	double A[9];
-	memcpy(A, _A, 9 * sizeof(double));
+	T A[9][1], Ulanes[9][1], Planes[9][1];
+	for (int k=0;k<9;k++)
+		A[k][0] = _A[k];
 
-	double det = matrix_determinant_3x3(A);
-	if (det < 0)
-		flip_matrix(A);
+	polar_lanes<T, 1>(A, right_sided, Ulanes, Planes);
 
-	double q[4];
-	double nrmsdsq = 0;
-	optimal_quaternion(A, true, -1, &nrmsdsq, q);
-	q[0] = -q[0];
-	quaternion_to_rotation_matrix(q, U);
+	for (int k=0;k<9;k++)
+	{
+		U[k] = Ulanes[k][0];
+		P[k] = Planes[k][0];
+	}
+	return 0;
+}
 
-	if (det < 0)
-		flip_matrix(U);
+template <typename T>
+static void _polar_decomposition_3x3_batch(int count, const T* A, bool right_sided, T* U, T* P)
+{
+	const int LANES = BatchLanes<T>::value;
+	for (int start=0;start<count;start+=LANES)
+	{
+		int m = std::min(LANES, count - start);
 
-	double UT[9] = {U[0], U[3], U[6], U[1], U[4], U[7], U[2], U[5], U[8]};
+		// unused lanes repeat the last matrix, so that only input is read
+		T Alanes[9][LANES], Ulanes[9][LANES], Planes[9][LANES];
+		for (int l=0;l<LANES;l++)
+		{
+			const T* a = &A[(start + std::min(l, m - 1)) * 9];
+			for (int k=0;k<9;k++)
+				Alanes[k][l] = a[k];
+		}
 
-	if (right_sided)
-		matmul_3x3(UT, _A, P);
-	else
-		matmul_3x3(_A, UT, P);
+		polar_lanes<T, LANES>(Alanes, right_sided, Ulanes, Planes);
 
-	return 0;
+		for (int l=0;l<m;l++)
+		{
+			for (int k=0;k<9;k++)
+			{
+				U[(start + l) * 9 + k] = Ulanes[k][l];
+				P[(start + l) * 9 + k] = Planes[k][l];
+			}
+		}
+	}
+}
+
+template <typename T>
+static int polar_baseline(T* A, bool right_sided, T* U, T* P)
+{
+	return _polar_decomposition_3x3<T>(A, right_sided, U, P);
+}
+
+template <typename T>
+TARGET_AVX2 static int polar_avx2(T* A, bool right_sided, T* U, T* P)
+{
+	return _polar_decomposition_3x3<T>(A, right_sided, U, P);
+}
+
+template <typename T>
+TARGET_AVX512 static int polar_avx512(T* A, bool right_sided, T* U, T* P)
+{
+	return _polar_decomposition_3x3<T>(A, right_sided, U, P);
 }
 
+template <typename T>
+static void polar_batch_baseline(int count, const T* A, bool right_sided, T* U, T* P)
+{
+	_polar_decomposition_3x3_batch<T>(count, A, right_sided, U, P);
+}
+
+template <typename T>
+TARGET_AVX2 static void polar_batch_avx2(int count, const T* A, bool right_sided, T* U, T* P)
+{
+	_polar_decomposition_3x3_batch<T>(count, A, right_sided, U, P);
+}
+
+template <typename T>
+TARGET_AVX512 static void polar_batch_avx512(int count, const T* A, bool right_sided, T* U, T* P)
+{
+	_polar_decomposition_3x3_batch<T>(count, A, right_sided, U, P);
+}
+
+template <typename T>
+static void polar_lanes_baseline(T (*A)[CANDIDATE_LANES], bool right_sided, T (*U)[CANDIDATE_LANES], T (*P)[CANDIDATE_LANES])
+{
+	polar_lanes<T, CANDIDATE_LANES>(A, right_sided, U, P);
+}
+
+template <typename T>
+TARGET_AVX2 static void polar_lanes_avx2(T (*A)[CANDIDATE_LANES], bool right_sided, T (*U)[CANDIDATE_LANES], T (*P)[CANDIDATE_LANES])
+{
+	polar_lanes<T, CANDIDATE_LANES>(A, right_sided, U, P);
+}
+
+template <typename T>
+TARGET_AVX512 static void polar_lanes_avx512(T (*A)[CANDIDATE_LANES], bool right_sided, T (*U)[CANDIDATE_LANES], T (*P)[CANDIDATE_LANES])
+{
+	polar_lanes<T, CANDIDATE_LANES>(A, right_sided, U, P);
+}
+
+template <typename T>
+static int dispatch_polar(T* A, bool right_sided, T* U, T* P)
+{
+	typedef int (*kernel_t)(T*, bool, T*, T*);
+	static const kernel_t kernel = select_kernel<kernel_t>(polar_baseline<T>,
+								polar_avx2<T>,
+								polar_avx512<T>);
+	return kernel(A, right_sided, U, P);
+}
+
+template <typename T>
+static void dispatch_polar_batch(int count, const T* A, bool right_sided, T* U, T* P)
+{
+	typedef void (*kernel_t)(int, const T*, bool, T*, T*);
+	static const kernel_t kernel = select_kernel<kernel_t>(polar_batch_baseline<T>,
+								polar_batch_avx2<T>,
+								polar_batch_avx512<T>);
+	kernel(count, A, right_sided, U, P);
+}
+
+template <typename T>
+static void dispatch_polar_lanes(T (*A)[CANDIDATE_LANES], bool right_sided, T (*U)[CANDIDATE_LANES], T (*P)[CANDIDATE_LANES])
+{
+	typedef void (*kernel_t)(T (*)[CANDIDATE_LANES], bool, T (*)[CANDIDATE_LANES], T (*)[CANDIDATE_LANES]);
+	static const kernel_t kernel = select_kernel<kernel_t>(polar_lanes_baseline<T>,
+								polar_lanes_avx2<T>,
+								polar_lanes_avx512<T>);
+	kernel(A, right_sided, U, P);
+}
+
+int polar_decomposition_3x3(double* A, bool right_sided, double* U, double* P)
+{
+	return dispatch_polar<double>(A, right_sided, U, P);
+}
+
+void polar_decomposition_3x3_batch(int count, const double* A, bool right_sided, double* U, double* P)
+{
+	dispatch_polar_batch<double>(count, A, right_sided, U, P);
+}
+
+int polar_decomposition_3x3f(float* A, bool right_sided, float* U, float* P)
+{
+	return dispatch_polar<float>(A, right_sided, U, P);
+}
+
+void polar_decomposition_3x3f_batch(int count, const float* A, bool right_sided, float* U, float* P)
+{
+	dispatch_polar_batch<float>(count, A, right_sided, U, P);
+}
+
+void polar_decomposition_3x3_lanes(double (*A)[CANDIDATE_LANES], bool right_sided,
+					double (*U)[CANDIDATE_LANES], double (*P)[CANDIDATE_LANES])
+{
+	dispatch_polar_lanes<double>(A, right_sided, U, P);
+}
+
+void polar_decomposition_3x3f_lanes(float (*A)[CANDIDATE_LANES], bool right_sided,
+					float (*U)[CANDIDATE_LANES], float (*P)[CANDIDATE_LANES])
+{
+	dispatch_polar_lanes<float>(A, right_sided, U, P);
+}
@@ -2,8 +2,29 @@
 #define POLAR_DECOMPOSITION_H
 
 #include <stdbool.h>
+#include "lanes.h"
+
+// number of matrices decomposed together by the batch kernels
+#define POLAR_LANES 8
+#define POLAR_LANES_SINGLE 16
 
 int polar_decomposition_3x3(double* _A, bool right_sided, double* U, double* P);
 
+// Decomposes `count` row-major 3x3 matrices, stored contiguously, in lanes of
+// POLAR_LANES, with the same arithmetic as polar_decomposition_3x3.
+void polar_decomposition_3x3_batch(int count, const double* A, bool right_sided, double* U, double* P);
+
+// Single-precision versions of the above
+int polar_decomposition_3x3f(float* _A, bool right_sided, float* U, float* P);
+void polar_decomposition_3x3f_batch(int count, const float* A, bool right_sided, float* U, float* P);
+
+// Decomposes CANDIDATE_LANES matrices in structure-of-arrays layout, A[k][l]
+// being element k of matrix l, with the same arithmetic as
+// polar_decomposition_3x3
+void polar_decomposition_3x3_lanes(double (*A)[CANDIDATE_LANES], bool right_sided,
+					double (*U)[CANDIDATE_LANES], double (*P)[CANDIDATE_LANES]);
+void polar_decomposition_3x3f_lanes(float (*A)[CANDIDATE_LANES], bool right_sided,
+					float (*U)[CANDIDATE_LANES], float (*P)[CANDIDATE_LANES]);
+
 #endif
 
@@ -24,12 +24,117 @@ SOFTWARE.*/
 #ifndef QUATERNION_H
 #define QUATERNION_H
 
-double quat_dot(double* a, double* b);
-double quat_size(double* q);
-void normalize_quaternion(double* q);
-void quaternion_to_rotation_matrix(double* q, double* U);
-void rotation_matrix_to_quaternion(double* u, double* q);
+#include <cmath>
+#include <algorithm>
 
-#endif
+// Quaternions are stored as (w, x, y, z).  The functions are defined here so
+// that they are inlined, as for matrix_vector.h.
+
+inline double quat_sign(double x)
+{
+	return x >= 0 ? 1 : -1;
+}
+
+inline double quat_dot(const double* a, const double* b)
+{
+	return	  a[0] * b[0]
+		+ a[1] * b[1]
+		+ a[2] * b[2]
+		+ a[3] * b[3];
+}
+
+inline double quat_size(const double* q)
+{
+	return std::sqrt(quat_dot(q, q));
+}
+
+inline void normalize_quaternion(double* q)
+{
+	double size = quat_size(q);
+
+	q[0] /= size;
+	q[1] /= size;
+	q[2] /= size;
+	q[3] /= size;
+}
+
+inline void rotation_matrix_to_quaternion(const double* u, double* q)
+{
+	double r11 = u[0];
+	double r12 = u[1];
+	double r13 = u[2];
+	double r21 = u[3];
+	double r22 = u[4];
+	double r23 = u[5];
+	double r31 = u[6];
+	double r32 = u[7];
+	double r33 = u[8];
+
+	q[0] = (1.0 + r11 + r22 + r33) / 4.0;
+	q[1] = (1.0 + r11 - r22 - r33) / 4.0;
+	q[2] = (1.0 - r11 + r22 - r33) / 4.0;
+	q[3] = (1.0 - r11 - r22 + r33) / 4.0;
+
+	q[0] = std::sqrt(std::max(0.0, q[0]));
+	q[1] = std::sqrt(std::max(0.0, q[1]));
+	q[2] = std::sqrt(std::max(0.0, q[2]));
+	q[3] = std::sqrt(std::max(0.0, q[3]));
 
+	double m0 = std::max(q[0], q[1]);
+	double m1 = std::max(q[2], q[3]);
+	double max = std::max(m0, m1);
 
+	int i = 0;
+	for (i=0;i<4;i++)
+		if (q[i] == max)
+			break;
+
+	if (i == 0)
+	{
+		q[1] *= quat_sign(r32 - r23);
+		q[2] *= quat_sign(r13 - r31);
+		q[3] *= quat_sign(r21 - r12);
+	}
+	else if (i == 1)
+	{
+		q[0] *= quat_sign(r32 - r23);
+		q[2] *= quat_sign(r21 + r12);
+		q[3] *= quat_sign(r13 + r31);
+	}
+	else if (i == 2)
+	{
+		q[0] *= quat_sign(r13 - r31);
+		q[1] *= quat_sign(r21 + r12);
+		q[3] *= quat_sign(r32 + r23);
+	}
+	else if (i == 3)
+	{
+		q[0] *= quat_sign(r21 - r12);
+		q[1] *= quat_sign(r31 + r13);
+		q[2] *= quat_sign(r32 + r23);
+	}
+
+	normalize_quaternion(q);
+}
+
+inline void quaternion_to_rotation_matrix(const double* q, double* u)
+{
+	double a = q[0];
+	double b = q[1];
+	double c = q[2];
+	double d = q[3];
+
+	u[0] = a*a + b*b - c*c - d*d;
+	u[1] = 2*b*c - 2*a*d;
+	u[2] = 2*b*d + 2*a*c;
+
+	u[3] = 2*b*c + 2*a*d;
+	u[4] = a*a - b*b + c*c - d*d;
+	u[5] = 2*c*d - 2*a*b;
+
+	u[6] = 2*b*d - 2*a*c;
+	u[7] = 2*c*d + 2*a*b;
+	u[8] = a*a - b*b - c*c + d*d;
+}
+
+#endif
@@ -28,82 +28,526 @@ SOFTWARE.*/
 #include "lup_decomposition.h"
 #include "matrix_vector.h"
 #include "quaternion.h"
+#include "cpu_dispatch.h"
+#include "sqp_newton_lagrange.h"
 
 
 #define HESSIAN(a,b) hessian[(a) * (6 + n) + b]
 
-double newton_lagrange_step(int n, double* args, double (*key)[4][4], double* step)
+// The variables are ordered (kappa, lambda, q, x).  The KKT matrix has the
+// block structure
+//
+//	[  0     0     0   -2x^T ]
+//	[  0     0   -2q^T   0   ]
+//	[  0   -2q     A     C   ]
+//	[ -2x    0    C^T    D   ]
+//
+// where A = 2 sum_i x_i K_i - 2 lambda I, the columns of C are 2 K_i q, and
+// D = -2 kappa I.
+
+// General solver for the KKT system, which ignores its structure
+template <int n>
+static bool solve_dense(double k, double* q, double* x, double (*A)[4],
+			double (*r)[4], double* gradient, double* step)
 {
-	double k = args[0];	//kappa
-	double l = args[1];	//lambda
+	double hessian[(6 + n) * (6 + n)];
+	memset(hessian, 0, sizeof(hessian));
 
-	double qw = args[2];
-	double qx = args[3];
-	double qy = args[4];
-	double qz = args[5];
+	for (int i=0;i<4;i++)
+	{
+		HESSIAN(1,2 + i) = -2 * q[i];
+		for (int j=i;j<4;j++)
+			HESSIAN(2 + i,2 + j) = A[i][j];
+	}
 
-	double* q = &args[2];
-	double* x = &args[6];
+	for (int i=0;i<n;i++)
+	{
+		HESSIAN(0,6 + i) = -2 * x[i];
+		HESSIAN(6 + i,6 + i) = -2 * k;
+		for (int j=0;j<4;j++)
+			HESSIAN(2 + j,6 + i) = 2 * r[i][j];
+	}
 
-	double gradient[10] = {1, 1, -2*l*qw, -2*l*qx, -2*l*qy, -2*l*qz, 0, 0, 0, 0};
+	// make hessian symmetric
+	for (int j=0;j<6+n;j++)
+		for (int i=j+1;i<6+n;i++)
+			HESSIAN(i,j) = HESSIAN(j,i);
 
-	double hessian[10 * 10];
-	memset(hessian, 0, 10 * 10 * sizeof(double));
+	int pivot[6 + n];
+	if (!lup_decompose<6 + n>((double*)hessian, pivot))
+		return false;
 
-	gradient[0] += -vector_dot(n, x, x);
-	gradient[1] += -vector_dot(4, q, q);
+	lup_solve<6 + n>((double*)hessian, pivot, gradient, step);
+	return true;
+}
 
-	HESSIAN(2,2) += -2 * l;
-	HESSIAN(3,3) += -2 * l;
-	HESSIAN(4,4) += -2 * l;
-	HESSIAN(5,5) += -2 * l;
+// Factorization of the KKT systems of the lanes, which later steps may reuse
+template <int n, int LANES>
+struct KKTFactorization
+{
+	bool valid[LANES];
+	double d[LANES];		//diagonal of the x block
+	double q[4][LANES];
+	double x[n][LANES];
+	double r[n][4][LANES];		//products of the key matrices with q
+	double S[4][4][LANES];		//LU decomposition of the reduced system in q
+	int pivot[4][LANES];
+	double c[4][LANES];
+	double vc[4][LANES];		//S^-1 c
+	double vq[4][LANES];		//S^-1 q
+	double m[2][2][LANES];		//Schur complement in the multipliers
+	double det[LANES];
+};
+
+template <int n, int LANES>
+static void copy_factorization(const KKTFactorization<n, LANES>* src, int from,
+				KKTFactorization<n, LANES>* dst, int to)
+{
+	dst->valid[to] = src->valid[from];
+	dst->d[to] = src->d[from];
+	dst->det[to] = src->det[from];
+	for (int i=0;i<4;i++)
+	{
+		dst->q[i][to] = src->q[i][from];
+		dst->pivot[i][to] = src->pivot[i][from];
+		dst->c[i][to] = src->c[i][from];
+		dst->vc[i][to] = src->vc[i][from];
+		dst->vq[i][to] = src->vq[i][from];
+		for (int j=0;j<4;j++)
+			dst->S[i][j][to] = src->S[i][j][from];
+	}
 
 	for (int i=0;i<n;i++)
-		HESSIAN(6+i,6+i) += -2 * k;
+	{
+		dst->x[i][to] = src->x[i][from];
+		for (int j=0;j<4;j++)
+			dst->r[i][j][to] = src->r[i][j][from];
+	}
+
+	for (int i=0;i<2;i++)
+		for (int j=0;j<2;j++)
+			dst->m[i][j][to] = src->m[i][j][from];
+}
+
+template <int LANES>
+static inline void quat_dot_lanes(double (*a)[LANES], double (*b)[LANES], double* dot)
+{
+	for (int l=0;l<LANES;l++)
+		dot[l] = a[0][l] * b[0][l] + a[1][l] * b[1][l] + a[2][l] * b[2][l] + a[3][l] * b[3][l];
+}
+
+template <int n, int LANES>
+static inline void vector_dot_lanes(double (*a)[LANES], double (*b)[LANES], double* dot)
+{
+	for (int l=0;l<LANES;l++)
+		dot[l] = 0;
+	for (int i=0;i<n;i++)
+		for (int l=0;l<LANES;l++)
+			dot[l] += a[i][l] * b[i][l];
+}
 
+// Factorizes the KKT systems using their structure.  The x block is diagonal
+// and is eliminated first, which leaves a 4x4 system in q bordered by the two
+// multiplier rows.  The multipliers are then found from a 2x2 Schur
+// complement.  A lane is marked invalid if either reduced system is singular,
+// in which case the dense solver is used instead.
+template <int n, int LANES>
+static void factorize_structured(	double* k, double (*q)[LANES], double (*x)[LANES], double (*A)[4][LANES],
+					double (*r)[4][LANES], KKTFactorization<n, LANES>* f)
+{
+	bool singular[LANES];
+	double d[LANES];
+	for (int l=0;l<LANES;l++)
+	{
+		f->d[l] = -2 * k[l];
+		singular[l] = f->d[l] == 0;
+		d[l] = singular[l] ? 1 : f->d[l];
+	}
+
+	memcpy(f->x, x, sizeof(f->x));
+	memcpy(f->r, r, sizeof(f->r));
+	memcpy(f->q, q, sizeof(f->q));
+
+	// reduced system: S dq + c dk - 2q dl = b
 	for (int i=0;i<4;i++)
-		HESSIAN(1,2 + i) = -2 * q[i];
+	{
+		for (int l=0;l<LANES;l++)
+		{
+			double t = 0;
+			for (int j=0;j<n;j++)
+				t += x[j][l] * r[j][i][l];
+			f->c[i][l] = 4 * t / d[l];
+		}
+
+		for (int j=i;j<4;j++)
+		{
+			for (int l=0;l<LANES;l++)
+			{
+				double t = 0;
+				for (int m=0;m<n;m++)
+					t += r[m][i][l] * r[m][j][l];
+				f->S[i][j][l] = f->S[j][i][l] = A[i][j][l] - 4 * t / d[l];
+			}
+		}
+	}
+
+	bool lu_singular[LANES];
+	lup_decompose_lanes<4, LANES>(f->S, f->pivot, lu_singular);
+	for (int l=0;l<LANES;l++)
+		singular[l] = singular[l] || lu_singular[l];
+
+	lup_solve_lanes<4, LANES>(f->S, f->pivot, singular, f->c, f->vc);
+	lup_solve_lanes<4, LANES>(f->S, f->pivot, singular, q, f->vq);
+
+	// Schur complement in the multipliers
+	double cvc[LANES], cvq[LANES], qvc[LANES], qvq[LANES], xx[LANES];
+	quat_dot_lanes<LANES>(f->c, f->vc, cvc);
+	quat_dot_lanes<LANES>(f->c, f->vq, cvq);
+	quat_dot_lanes<LANES>(q, f->vc, qvc);
+	quat_dot_lanes<LANES>(q, f->vq, qvq);
+	vector_dot_lanes<n, LANES>(x, x, xx);
+	for (int l=0;l<LANES;l++)
+	{
+		f->m[0][0][l] = -cvc[l] - 4 * xx[l] / d[l];
+		f->m[0][1][l] = 2 * cvq[l];
+		f->m[1][0][l] = 2 * qvc[l];
+		f->m[1][1][l] = -4 * qvq[l];
+
+		double p = f->m[0][0][l] * f->m[1][1][l];
+		double o = f->m[0][1][l] * f->m[1][0][l];
+		f->det[l] = p - o;
+		f->valid[l] = !singular[l] && std::fabs(f->det[l]) > 1E-14 * (std::fabs(p) + std::fabs(o));
+	}
+}
+
+// Solves the KKT systems with a structured factorization.  The results of
+// lanes without a valid factorization are meaningless, but are computed
+// without dividing by zero.
+template <int n, int LANES>
+static void solve_structured(KKTFactorization<n, LANES>* f, double (*gradient)[LANES], double (*step)[LANES])
+{
+	bool invalid[LANES];
+	double d[LANES], det[LANES];
+	for (int l=0;l<LANES;l++)
+	{
+		invalid[l] = !f->valid[l];
+		d[l] = invalid[l] ? 1 : f->d[l];
+		det[l] = invalid[l] ? 1 : f->det[l];
+	}
+
+	double (*gq)[LANES] = &gradient[2];
+	double (*gx)[LANES] = &gradient[6];
+
+	double b[4][LANES], u[4][LANES];
+	for (int i=0;i<4;i++)
+	{
+		for (int l=0;l<LANES;l++)
+		{
+			double t = 0;
+			for (int j=0;j<n;j++)
+				t += f->r[j][i][l] * gx[j][l];
+			b[i][l] = gq[i][l] - 2 * t / d[l];
+		}
+	}
+	lup_solve_lanes<4, LANES>(f->S, f->pivot, invalid, b, u);
+
+	double xgx[LANES], cu[LANES], qu[LANES];
+	vector_dot_lanes<n, LANES>(f->x, gx, xgx);
+	quat_dot_lanes<LANES>(f->c, u, cu);
+	quat_dot_lanes<LANES>(f->q, u, qu);
+	for (int l=0;l<LANES;l++)
+	{
+		double rhs0 = gradient[0][l] + 2 * xgx[l] / d[l] - cu[l];
+		double rhs1 = gradient[1][l] + 2 * qu[l];
+
+		double dk = (rhs0 * f->m[1][1][l] - f->m[0][1][l] * rhs1) / det[l];
+		double dl = (f->m[0][0][l] * rhs1 - f->m[1][0][l] * rhs0) / det[l];
+
+		step[0][l] = dk;
+		step[1][l] = dl;
+		for (int i=0;i<4;i++)
+			step[2 + i][l] = u[i][l] - f->vc[i][l] * dk + 2 * f->vq[i][l] * dl;
+	}
 
 	for (int i=0;i<n;i++)
 	{
-		double r[4];
-		matvec(4, (double*)key[i], q, r);
+		double rs[LANES];
+		quat_dot_lanes<LANES>(f->r[i], &step[2], rs);
+		for (int l=0;l<LANES;l++)
+			step[6 + i][l] = (gx[i][l] + 2 * f->x[i][l] * step[0][l] - 2 * rs[l]) / d[l];
+	}
+}
 
-		gradient[2] += 2 * x[i] * r[0];
-		gradient[3] += 2 * x[i] * r[1];
-		gradient[4] += 2 * x[i] * r[2];
-		gradient[5] += 2 * x[i] * r[3];
-		gradient[6 + i] += -2 * x[i] * k + quat_dot(q, r);
+// One step of the SQP iteration in each lane.  The KKT system of a lane is
+// factorized, unless reuse is set and the factorization of a previous step
+// is valid, in which case it is used for a simplified Newton step.  Writes
+// the norm of the gradient of the Lagrangian, or -1 if the KKT system is
+// singular, in which case the step is zero.
+template <int n, int LANES>
+static void newton_lagrange_step(double (*args)[LANES], double (*key)[4][4][LANES], double (*step)[LANES],
+					KKTFactorization<n, LANES>* f, const bool* reuse, double* gradient_norm)
+{
+	double* k = args[0];	//kappa
+	double* lambda = args[1];
 
-		HESSIAN(0,6 + i) = -2 * x[i];
+	double (*q)[LANES] = &args[2];
+	double (*x)[LANES] = &args[6];
 
-		HESSIAN(2,2) += 2 * x[i] * key[i][0][0];
-		HESSIAN(2,3) += 2 * x[i] * key[i][0][1];
-		HESSIAN(2,4) += 2 * x[i] * key[i][0][2];
-		HESSIAN(2,5) += 2 * x[i] * key[i][0][3];
-		HESSIAN(2,6 + i) = 2 * r[0];
+	double gradient[6 + n][LANES];
+	double xx[LANES], qq[LANES];
+	vector_dot_lanes<n, LANES>(x, x, xx);
+	vector_dot_lanes<4, LANES>(q, q, qq);
+	for (int l=0;l<LANES;l++)
+	{
+		gradient[0][l] = 1 + -xx[l];
+		gradient[1][l] = 1 + -qq[l];
+		for (int j=0;j<4;j++)
+			gradient[2 + j][l] = -2 * lambda[l] * q[j][l];
+	}
 
-		HESSIAN(3,3) += 2 * x[i] * key[i][1][1];
-		HESSIAN(3,4) += 2 * x[i] * key[i][1][2];
-		HESSIAN(3,5) += 2 * x[i] * key[i][1][3];
-		HESSIAN(3,6 + i) = 2 * r[1];
+	double r[n][4][LANES];
+	for (int i=0;i<n;i++)
+	{
+		for (int j=0;j<4;j++)
+		{
+			for (int l=0;l<LANES;l++)
+			{
+				double acc = 0;
+				for (int m=0;m<4;m++)
+					acc += key[i][j][m][l] * q[m][l];
+				r[i][j][l] = acc;
+			}
+		}
 
-		HESSIAN(4,4) += 2 * x[i] * key[i][2][2];
-		HESSIAN(4,5) += 2 * x[i] * key[i][2][3];
-		HESSIAN(4,6 + i) = 2 * r[2];
+		for (int j=0;j<4;j++)
+			for (int l=0;l<LANES;l++)
+				gradient[2 + j][l] += 2 * x[i][l] * r[i][j][l];
 
-		HESSIAN(5,5) += 2 * x[i] * key[i][3][3];
-		HESSIAN(5,6 + i) = 2 * r[3];
+		double qr[LANES];
+		quat_dot_lanes<LANES>(q, r[i], qr);
+		for (int l=0;l<LANES;l++)
+			gradient[6 + i][l] = -2 * x[i][l] * k[l] + qr[l];
 	}
 
-	// make hessian symmetric
-	for (int j=0;j<6+n;j++)
-		for (int i=j+1;i<6+n;i++)
-			HESSIAN(i,j) = HESSIAN(j,i);
+	double norm[LANES];
+	vector_dot_lanes<6 + n, LANES>(gradient, gradient, norm);
+	for (int l=0;l<LANES;l++)
+		gradient_norm[l] = std::sqrt(norm[l]);
+
+	bool refactor[LANES];
+	bool any = false;
+	for (int l=0;l<LANES;l++)
+	{
+		refactor[l] = !(reuse[l] && f->valid[l]);
+		any = any || refactor[l];
+	}
+
+	double A[4][4][LANES];
+	if (any)
+	{
+		memset(A, 0, sizeof(A));
+		for (int i=0;i<4;i++)
+			for (int l=0;l<LANES;l++)
+				A[i][i][l] = -2 * lambda[l];
+
+		for (int i=0;i<n;i++)
+			for (int j=0;j<4;j++)
+				for (int m=j;m<4;m++)
+					for (int l=0;l<LANES;l++)
+						A[j][m][l] += 2 * x[i][l] * key[i][j][m][l];
+
+		KKTFactorization<n, LANES> g;
+		factorize_structured<n, LANES>(k, q, x, A, r, &g);
+		for (int l=0;l<LANES;l++)
+			if (refactor[l])
+				copy_factorization<n, LANES>(&g, l, f, l);
+	}
+
+	solve_structured<n, LANES>(f, gradient, step);
+
+	for (int l=0;l<LANES;l++)
+	{
+		if (f->valid[l])
+			continue;
+
+		double ql[4], xl[n], Al[4][4], rl[n][4], gl[6 + n], sl[6 + n];
+		for (int i=0;i<4;i++)
+		{
+			ql[i] = q[i][l];
+			for (int j=0;j<4;j++)
+				Al[i][j] = A[i][j][l];
+		}
+
+		for (int i=0;i<n;i++)
+		{
+			xl[i] = x[i][l];
+			for (int j=0;j<4;j++)
+				rl[i][j] = r[i][j][l];
+		}
+
+		for (int i=0;i<6+n;i++)
+			gl[i] = gradient[i][l];
+
+		bool solved = solve_dense<n>(k[l], ql, xl, Al, rl, gl, sl);
+		if (!solved)
+			gradient_norm[l] = -1;
+		for (int i=0;i<6+n;i++)
+			step[i][l] = solved ? sl[i] : 0;
+	}
+}
+
+// Control state of the iteration in one lane
+struct SQPLane
+{
+	int owner;		//lane whose problem is solved, or -1 for a repeat of another lane
+	double gradient_norm;
+	bool decreasing;
+	int iterations;
+};
+
+template <int n, int LANES>
+static void _sqp_newton_lagrange(double (*args)[LANES], double (*key)[4][4][LANES], const bool* active,
+					int max_it, int* p_iterations, bool* p_stationary)
+{
+	int first = first_lane<LANES>(active);
+	if (first < 0)
+		return;
+
+	// The lanes iterate on working copies.  Inactive lanes, and those whose
+	// iteration has ended, repeat a lane which is still iterating.
+	double w[6 + n][LANES], kw[n][4][4][LANES];
+	KKTFactorization<n, LANES> f;
+	memset(&f, 0, sizeof(f));
+	SQPLane lanes[LANES];
+	int num_running = 0;
+	for (int l=0;l<LANES;l++)
+	{
+		int source = active[l] ? l : first;
+		for (int i=0;i<6+n;i++)
+			w[i][l] = args[i][source];
+		for (int i=0;i<n;i++)
+			for (int j=0;j<4;j++)
+				for (int m=0;m<4;m++)
+					kw[i][j][m][l] = key[i][j][m][source];
+
+		lanes[l].owner = active[l] ? l : -1;
+		lanes[l].gradient_norm = INFINITY;
+		lanes[l].decreasing = false;
+		lanes[l].iterations = 0;
+		num_running += active[l];
+	}
+
+	for (int it=0;num_running>0;it++)
+	{
+		bool reuse[LANES];
+		double previous[LANES], gradient_norm[LANES];
+		for (int l=0;l<LANES;l++)
+		{
+			reuse[l] = lanes[l].decreasing && lanes[l].gradient_norm < 1E-5;
+			previous[l] = lanes[l].gradient_norm;
+		}
+
+		double step[6 + n][LANES];
+		newton_lagrange_step<n, LANES>(w, kw, step, &f, reuse, gradient_norm);
+
+		// a singular KKT system ends the iteration without a step
+		for (int i=0;i<6+n;i++)
+			for (int l=0;l<LANES;l++)
+				w[i][l] -= step[i][l];
+
+		bool finished = false;
+		for (int l=0;l<LANES;l++)
+		{
+			SQPLane* s = &lanes[l];
+			s->gradient_norm = gradient_norm[l];
+			bool singular = gradient_norm[l] < 0;
+			bool stationary = !singular && gradient_norm[l] < 1E-14;
+			if (!singular)
+			{
+				s->decreasing = gradient_norm[l] < previous[l];
+				s->iterations++;
+			}
+
+			bool stop = singular || stationary || it + 1 == max_it;
+			if (!stop || s->owner < 0)
+				continue;
+
+			for (int i=0;i<6+n;i++)
+				args[i][l] = w[i][l];
+			p_iterations[l] = s->iterations;
+			p_stationary[l] = stationary;
+			s->owner = -1;
+			num_running--;
+			finished = true;
+		}
+
+		// repeats follow a lane which is still iterating
+		int source = -1;
+		for (int l=0;l<LANES && source<0;l++)
+			if (lanes[l].owner >= 0)
+				source = l;
 
-	int pivot[10];
-	lup_decompose(6 + n, (double*)hessian, pivot);	//todo: check return code
-	lup_solve(6 + n, (double*)hessian, pivot, gradient, step);
-	return vector_norm(6 + n, gradient);
+		if (!finished || source < 0)
+			continue;
+
+		for (int l=0;l<LANES;l++)
+		{
+			if (lanes[l].owner >= 0)
+				continue;
+
+			copy_lane<6 + n, LANES>(w, source, l);
+			copy_lane<n * 16, LANES>((double (*)[LANES])kw, source, l);
+			copy_factorization<n, LANES>(&f, source, &f, l);
+			lanes[l] = lanes[source];
+			lanes[l].owner = -1;
+		}
+	}
+}
+
+template <int n, int LANES>
+static void sqp_baseline(double (*args)[LANES], double (*key)[4][4][LANES], const bool* active,
+				int max_it, int* p_iterations, bool* p_stationary)
+{
+	_sqp_newton_lagrange<n, LANES>(args, key, active, max_it, p_iterations, p_stationary);
+}
+
+template <int n, int LANES>
+TARGET_AVX2 static void sqp_avx2(double (*args)[LANES], double (*key)[4][4][LANES], const bool* active,
+					int max_it, int* p_iterations, bool* p_stationary)
+{
+	_sqp_newton_lagrange<n, LANES>(args, key, active, max_it, p_iterations, p_stationary);
+}
+
+template <int n, int LANES>
+TARGET_AVX512 static void sqp_avx512(double (*args)[LANES], double (*key)[4][4][LANES], const bool* active,
+					int max_it, int* p_iterations, bool* p_stationary)
+{
+	_sqp_newton_lagrange<n, LANES>(args, key, active, max_it, p_iterations, p_stationary);
+}
+
+template <int n, int LANES>
+void sqp_newton_lagrange(double (*args)[LANES], double (*key)[4][4][LANES], const bool* active,
+				int max_it, int* p_iterations, bool* p_stationary)
+{
+	typedef void (*kernel_t)(double (*)[LANES], double (*)[4][4][LANES], const bool*, int, int*, bool*);
+	static const kernel_t kernel = select_kernel<kernel_t>(sqp_baseline<n, LANES>, sqp_avx2<n, LANES>,
+								sqp_avx512<n, LANES>);
+	kernel(args, key, active, max_it, p_iterations, p_stationary);
 }
 
+template void sqp_newton_lagrange<1, 1>(double (*args)[1], double (*key)[4][4][1], const bool* active,
+					int max_it, int* p_iterations, bool* p_stationary);
+template void sqp_newton_lagrange<1, CANDIDATE_LANES>(double (*args)[CANDIDATE_LANES], double (*key)[4][4][CANDIDATE_LANES],
+					const bool* active, int max_it, int* p_iterations, bool* p_stationary);
+template void sqp_newton_lagrange<2, 1>(double (*args)[1], double (*key)[4][4][1], const bool* active,
+					int max_it, int* p_iterations, bool* p_stationary);
+template void sqp_newton_lagrange<2, CANDIDATE_LANES>(double (*args)[CANDIDATE_LANES], double (*key)[4][4][CANDIDATE_LANES],
+					const bool* active, int max_it, int* p_iterations, bool* p_stationary);
+template void sqp_newton_lagrange<3, 1>(double (*args)[1], double (*key)[4][4][1], const bool* active,
+					int max_it, int* p_iterations, bool* p_stationary);
+template void sqp_newton_lagrange<3, CANDIDATE_LANES>(double (*args)[CANDIDATE_LANES], double (*key)[4][4][CANDIDATE_LANES],
+					const bool* active, int max_it, int* p_iterations, bool* p_stationary);
+template void sqp_newton_lagrange<4, 1>(double (*args)[1], double (*key)[4][4][1], const bool* active,
+					int max_it, int* p_iterations, bool* p_stationary);
+template void sqp_newton_lagrange<4, CANDIDATE_LANES>(double (*args)[CANDIDATE_LANES], double (*key)[4][4][CANDIDATE_LANES],
+					const bool* active, int max_it, int* p_iterations, bool* p_stationary);
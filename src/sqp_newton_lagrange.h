@@ -24,7 +24,23 @@ SOFTWARE.*/
 #ifndef SQP_NEWTON_LAGRANGE_H
 #define SQP_NEWTON_LAGRANGE_H
 
-double newton_lagrange_step(int n, double* args, double (*key)[4][4], double* step);
+#include "lanes.h"
+
+// Sequential quadratic programming for the template coefficients and the
+// rotation, for n template coefficients (1 <= n <= 4), on LANES problems in
+// lock-step, where LANES is 1 or CANDIDATE_LANES.  args[i][l] is variable i
+// of lane l, the variables being ordered (kappa, lambda, q, x), and
+// key[i][j][k][l] is element (j, k) of the key matrix of template i.  Close
+// to convergence the KKT matrix barely changes between steps, so its
+// factorization is reused for as long as the gradient keeps decreasing.
+//
+// The active lanes take at most max_it steps, and stop once the gradient of
+// the Lagrangian vanishes or the KKT system is singular.  The number of steps
+// taken, and whether the gradient vanished, are written to p_iterations and
+// p_stationary.  Inactive lanes are left unchanged.
+template <int n, int LANES>
+void sqp_newton_lagrange(double (*args)[LANES], double (*key)[4][4][LANES], const bool* active,
+				int max_it, int* p_iterations, bool* p_stationary);
 
 #endif
 
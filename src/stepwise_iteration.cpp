@@ -23,68 +23,467 @@ SOFTWARE.*/
 
 #include <cmath>
 #include <cstring>
+#include <limits>
+#include "cpu_dispatch.h"
+#include "lanes.h"
 #include "matrix_vector.h"
 #include "polar_decomposition.h"
 
 
-double calculate_trace(int n, double* x, double* Ktrans, double* Q, double* P)
+// The iteration is implemented for both precisions, using the helpers in
+// matrix_vector.h, and for LANES problems in lock-step.  With a single lane it
+// is the scalar iteration, and every lane performs the same arithmetic as the
+// scalar iteration would for its problem.
+
+static void polar(double (*A)[1], double (*Q)[1], double (*P)[1])
+{
+	polar_decomposition_3x3(A[0], true, Q[0], P[0]);
+}
+
+static void polar(float (*A)[1], float (*Q)[1], float (*P)[1])
+{
+	polar_decomposition_3x3f(A[0], true, Q[0], P[0]);
+}
+
+static void polar(double (*A)[CANDIDATE_LANES], double (*Q)[CANDIDATE_LANES], double (*P)[CANDIDATE_LANES])
+{
+	polar_decomposition_3x3_lanes(A, true, Q, P);
+}
+
+static void polar(float (*A)[CANDIDATE_LANES], float (*Q)[CANDIDATE_LANES], float (*P)[CANDIDATE_LANES])
+{
+	polar_decomposition_3x3f_lanes(A, true, Q, P);
+}
+
+template <typename T, int n, int LANES>
+static void normalize_lanes(T (*x)[LANES])
 {
-	double t[9] = {0};
+	T norm[LANES] = {0};
+	for (int i=0;i<n;i++)
+		for (int l=0;l<LANES;l++)
+			norm[l] += x[i][l] * x[i][l];
+
+	for (int l=0;l<LANES;l++)
+		norm[l] = std::sqrt(norm[l]);
+
+	for (int i=0;i<n;i++)
+		for (int l=0;l<LANES;l++)
+			x[i][l] /= norm[l];
+}
+
+template <typename T, int n, int LANES>
+static void _calculate_trace(T (*x)[LANES], T (*Ktrans)[LANES], T (*Q)[LANES], T (*P)[LANES], T* trace)
+{
+	T t[9][LANES] = {{0}};
 	for (int i=0;i<n;i++)
 		for (int j=0;j<9;j++)
-			t[j] += x[i] * Ktrans[i * 9 + j];
+			for (int l=0;l<LANES;l++)
+				t[j][l] += x[i][l] * Ktrans[i * 9 + j][l];
 
-	polar_decomposition_3x3(t, true, Q, P);
-	return P[0] + P[4] + P[8];
+	polar(t, Q, P);
+	for (int l=0;l<LANES;l++)
+		trace[l] = P[0][l] + P[4][l] + P[8][l];
 }
 
-double stepwise_iteration(int n, double* x, double* Ktrans, double* Q, double* P)
+template <typename T, int n, int LANES>
+static void _stepwise_iteration(T (*x)[LANES], T (*Ktrans)[LANES], T (*Q)[LANES], T (*P)[LANES], T* trace)
 {
-	double trace = calculate_trace(n, x, Ktrans, Q, P);
+	_calculate_trace<T, n, LANES>(x, Ktrans, Q, P, trace);
 
 	if (n == 1)
 	{
-		x[0] = 1;
+		for (int l=0;l<LANES;l++)
+			x[0][l] = 1;
 	}
 	else
 	{
 		//x[i] = trace(Q^T &Ktrans[i * 9] )
 		for (int i=0;i<n;i++)
 		{
-			x[i] = 0;
+			for (int l=0;l<LANES;l++)
+				x[i][l] = 0;
+
 			for (int j=0;j<9;j++)
-				x[i] += Q[j] * Ktrans[i * 9 + j];
+				for (int l=0;l<LANES;l++)
+					x[i][l] += Q[j][l] * Ktrans[i * 9 + j][l];
 		}
 
-		normalize_vector(n, x);
+		normalize_lanes<T, n, LANES>(x);
 	}
-
-	return trace;
 }
 
-double optimize_stepwise(int n, double* x, double* Ktrans, double* Q, double* P, int max_it, double tolerance)
+// The stepwise iteration is a fixed-point iteration x -> G(x) which converges
+// linearly.  It is accelerated with Anderson mixing: the next iterate is the
+// combination of the last few values of G whose residuals G(x) - x combine to
+// the smallest norm.
+#define ANDERSON_DEPTH 2
+
+template <typename T, int n>
+struct AndersonHistory
+{
+	int size;
+	T g[ANDERSON_DEPTH + 1][n];	//values of G
+	T f[ANDERSON_DEPTH + 1][n];	//residuals G(x) - x
+};
+
+// Adds the step x0 -> x = G(x0) to the history and replaces x by the
+// extrapolated iterate.  Returns false if there is not enough history yet, or
+// the least-squares problem is singular, in which case x is unchanged.
+template <typename T, int n>
+static bool anderson_step(AndersonHistory<T, n>* h, T* x0, T* x)
 {
-	int it = 0;
-	double previous = 0, dif = 0;
-	for (it=0;it<max_it;it++)
+	if (h->size == ANDERSON_DEPTH + 1)
 	{
-		double trace = stepwise_iteration(n, x, Ktrans, Q, P);
-		dif = fabs(trace - previous);
-		if (dif < tolerance)
-			break;
+		memmove(h->g[0], h->g[1], ANDERSON_DEPTH * n * sizeof(T));
+		memmove(h->f[0], h->f[1], ANDERSON_DEPTH * n * sizeof(T));
+		h->size--;
+	}
 
-		previous = trace;
+	int k = h->size++;
+	for (int i=0;i<n;i++)
+	{
+		h->g[k][i] = x[i];
+		h->f[k][i] = x[i] - x0[i];
 	}
 
-	if (determinant_3x3(Q) < 0)
+	const int m = k;
+	if (m == 0)
+		return false;
+
+	// minimize |f_k - sum_j gamma_j (f_(j+1) - f_j)| using the normal equations
+	T df[ANDERSON_DEPTH][n];
+	for (int j=0;j<m;j++)
+		for (int i=0;i<n;i++)
+			df[j][i] = h->f[j + 1][i] - h->f[j][i];
+
+	T A[ANDERSON_DEPTH][ANDERSON_DEPTH], gamma[ANDERSON_DEPTH];
+	T trace = 0;
+	for (int j=0;j<m;j++)
 	{
-		for (int i=0;i<9;i++)
-			Q[i] = -Q[i];
+		gamma[j] = 0;
+		for (int i=0;i<n;i++)
+			gamma[j] += df[j][i] * h->f[k][i];
 
+		for (int l=0;l<m;l++)
+		{
+			A[j][l] = 0;
+			for (int i=0;i<n;i++)
+				A[j][l] += df[j][i] * df[l][i];
+		}
+		trace += A[j][j];
+	}
+
+	// regularize against nearly parallel residual differences
+	for (int j=0;j<m;j++)
+		A[j][j] += 16 * std::numeric_limits<T>::epsilon() * trace;
+
+	for (int c=0;c<m;c++)
+	{
+		for (int r=c+1;r<m;r++)
+		{
+			T factor = A[r][c] / A[c][c];
+			for (int l=c;l<m;l++)
+				A[r][l] -= factor * A[c][l];
+			gamma[r] -= factor * gamma[c];
+		}
+	}
+
+	for (int c=m-1;c>=0;c--)
+	{
+		for (int l=c+1;l<m;l++)
+			gamma[c] -= A[c][l] * gamma[l];
+		gamma[c] /= A[c][c];
+		if (!std::isfinite(gamma[c]))
+			return false;
+	}
+
+	for (int i=0;i<n;i++)
+		for (int j=0;j<m;j++)
+			x[i] -= gamma[j] * (h->g[j + 1][i] - h->g[j][i]);
+
+	normalize_vector<n>(x);
+	return true;
+}
+
+// Control state of the iteration in one lane
+template <typename T, int n>
+struct StepwiseLane
+{
+	int owner;		//lane whose problem is solved, or -1 for a repeat of another lane
+	int max_it;
+	AndersonHistory<T, n> history;
+	T plain[n];		//unaccelerated step, taken if an extrapolation is rejected
+	bool extrapolated;
+	T previous;		//trace of the previous iteration
+	int accelerated;
+};
+
+template <typename T, int n, int LANES>
+static void _optimize_stepwise(T (*x)[LANES], T (*Ktrans)[LANES], T (*Q)[LANES], T (*P)[LANES],
+				const bool* active, const int* max_it, T tolerance, T handoff,
+				int* p_iterations, int* p_accelerated)
+{
+	int first = first_lane<LANES>(active);
+	if (first < 0)
+		return;
+
+	// The lanes iterate on working copies.  Inactive lanes, and those whose
+	// iteration has ended, repeat a lane which is still iterating.
+	T xw[n][LANES], Kw[n * 9][LANES], Qw[9][LANES], Pw[9][LANES];
+	StepwiseLane<T, n> lanes[LANES];
+	int num_running = 0;
+	for (int l=0;l<LANES;l++)
+	{
+		int source = active[l] ? l : first;
 		for (int i=0;i<n;i++)
-			x[i] = -x[i];
+			xw[i][l] = x[i][source];
+		for (int k=0;k<n*9;k++)
+			Kw[k][l] = Ktrans[k][source];
+
+		StepwiseLane<T, n>* s = &lanes[l];
+		s->owner = active[l] ? l : -1;
+		s->max_it = max_it[source];
+		s->history.size = 0;
+		s->extrapolated = false;
+		s->previous = 0;
+		s->accelerated = 0;
+		num_running += active[l];
 	}
 
-	return previous;
+	for (int it=0;num_running>0;it++)
+	{
+		T x0[n][LANES], trace[LANES];
+		memcpy(x0, xw, sizeof(x0));
+		_stepwise_iteration<T, n, LANES>(xw, Kw, Qw, Pw, trace);
+
+		bool finished = false;
+		for (int l=0;l<LANES;l++)
+		{
+			StepwiseLane<T, n>* s = &lanes[l];
+			T xl[n], x0l[n];
+			for (int i=0;i<n;i++)
+			{
+				xl[i] = xw[i][l];
+				x0l[i] = x0[i][l];
+			}
+
+			// the plain iteration never decreases the trace, so an extrapolated
+			// iterate which does is discarded along with the history
+			bool stop = false, rejected = false;
+			if (s->extrapolated && trace[l] < s->previous - 8 * std::numeric_limits<T>::epsilon() * std::fabs(s->previous))
+			{
+				memcpy(xl, s->plain, n * sizeof(T));
+				s->history.size = 0;
+				s->extrapolated = false;
+				rejected = true;
+			}
+			else if (std::fabs(trace[l] - s->previous) < tolerance)
+			{
+				stop = true;
+			}
+			else
+			{
+				s->previous = trace[l];
+
+				// hand over to the SQP stage once the iterate barely moves, which is
+				// well within the region where Newton's method converges
+				T change = 0;
+				for (int i=0;i<n;i++)
+					change += (xl[i] - x0l[i]) * (xl[i] - x0l[i]);
+				if (it > 0 && std::sqrt(change) < handoff)
+				{
+					stop = true;
+				}
+				else
+				{
+					memcpy(s->plain, xl, n * sizeof(T));
+					s->extrapolated = n > 1 && anderson_step<T, n>(&s->history, x0l, xl);
+					s->accelerated += s->extrapolated;
+				}
+			}
+
+			for (int i=0;i<n;i++)
+				xw[i][l] = xl[i];
+
+			// Q and P belong to a rejected iterate, so the lane runs one more
+			// plain evaluation before it ends
+			int iterations = stop ? it : it + 1;
+			stop = stop || (!rejected && iterations >= s->max_it);
+			if (!stop || s->owner < 0)
+				continue;
+
+			T Ql[9];
+			for (int k=0;k<9;k++)
+				Ql[k] = Qw[k][l];
+			T sign = determinant_3x3(Ql) < 0 ? -1 : 1;
+			for (int k=0;k<9;k++)
+			{
+				Q[k][l] = sign < 0 ? -Ql[k] : Ql[k];
+				P[k][l] = Pw[k][l];
+			}
+			for (int i=0;i<n;i++)
+				x[i][l] = sign < 0 ? -xl[i] : xl[i];
+
+			p_iterations[l] = iterations;
+			p_accelerated[l] = s->accelerated;
+			s->owner = -1;
+			num_running--;
+			finished = true;
+		}
+
+		// repeats follow a lane which is still iterating
+		int source = -1;
+		for (int l=0;l<LANES && source<0;l++)
+			if (lanes[l].owner >= 0)
+				source = l;
+
+		if (!finished || source < 0)
+			continue;
+
+		for (int l=0;l<LANES;l++)
+		{
+			if (lanes[l].owner >= 0)
+				continue;
+
+			copy_lane<n, LANES>(xw, source, l);
+			copy_lane<n * 9, LANES>(Kw, source, l);
+			lanes[l] = lanes[source];
+			lanes[l].owner = -1;
+		}
+	}
+}
+
+template <typename T, int n, int LANES>
+static void optimize_stepwise_baseline(T (*x)[LANES], T (*Ktrans)[LANES], T (*Q)[LANES], T (*P)[LANES],
+					const bool* active, const int* max_it, T tolerance, T handoff,
+					int* p_iterations, int* p_accelerated)
+{
+	_optimize_stepwise<T, n, LANES>(x, Ktrans, Q, P, active, max_it, tolerance, handoff, p_iterations, p_accelerated);
 }
 
+template <typename T, int n, int LANES>
+TARGET_AVX2 static void optimize_stepwise_avx2(T (*x)[LANES], T (*Ktrans)[LANES], T (*Q)[LANES], T (*P)[LANES],
+						const bool* active, const int* max_it, T tolerance, T handoff,
+						int* p_iterations, int* p_accelerated)
+{
+	_optimize_stepwise<T, n, LANES>(x, Ktrans, Q, P, active, max_it, tolerance, handoff, p_iterations, p_accelerated);
+}
+
+template <typename T, int n, int LANES>
+TARGET_AVX512 static void optimize_stepwise_avx512(T (*x)[LANES], T (*Ktrans)[LANES], T (*Q)[LANES], T (*P)[LANES],
+						const bool* active, const int* max_it, T tolerance, T handoff,
+						int* p_iterations, int* p_accelerated)
+{
+	_optimize_stepwise<T, n, LANES>(x, Ktrans, Q, P, active, max_it, tolerance, handoff, p_iterations, p_accelerated);
+}
+
+template <typename T, int n, int LANES>
+static void dispatch_stepwise(T (*x)[LANES], T (*Ktrans)[LANES], T (*Q)[LANES], T (*P)[LANES],
+				const bool* active, const int* max_it, T tolerance, T handoff,
+				int* p_iterations, int* p_accelerated)
+{
+	typedef void (*kernel_t)(T (*)[LANES], T (*)[LANES], T (*)[LANES], T (*)[LANES],
+				const bool*, const int*, T, T, int*, int*);
+	static const kernel_t kernel = select_kernel<kernel_t>(optimize_stepwise_baseline<T, n, LANES>,
+								optimize_stepwise_avx2<T, n, LANES>,
+								optimize_stepwise_avx512<T, n, LANES>);
+	kernel(x, Ktrans, Q, P, active, max_it, tolerance, handoff, p_iterations, p_accelerated);
+}
+
+template <int n, int LANES>
+void calculate_trace(double (*x)[LANES], double (*Ktrans)[LANES], double (*Q)[LANES], double (*P)[LANES])
+{
+	double trace[LANES];
+	_calculate_trace<double, n, LANES>(x, Ktrans, Q, P, trace);
+}
+
+template <int n, int LANES>
+void optimize_stepwise(double (*x)[LANES], double (*Ktrans)[LANES], double (*Q)[LANES], double (*P)[LANES],
+			const bool* active, const int* max_it, double tolerance, double handoff,
+			int* p_iterations, int* p_accelerated)
+{
+	dispatch_stepwise<double, n, LANES>(x, Ktrans, Q, P, active, max_it, tolerance, handoff, p_iterations, p_accelerated);
+}
+
+template <int n, int LANES>
+void calculate_trace_single(float (*x)[LANES], float (*Ktrans)[LANES], float (*Q)[LANES], float (*P)[LANES])
+{
+	float trace[LANES];
+	_calculate_trace<float, n, LANES>(x, Ktrans, Q, P, trace);
+}
+
+template <int n, int LANES>
+void optimize_stepwise_single(float (*x)[LANES], float (*Ktrans)[LANES], float (*Q)[LANES], float (*P)[LANES],
+				const bool* active, const int* max_it, float tolerance, float handoff,
+				int* p_iterations, int* p_accelerated)
+{
+	dispatch_stepwise<float, n, LANES>(x, Ktrans, Q, P, active, max_it, tolerance, handoff, p_iterations, p_accelerated);
+}
+
+template void calculate_trace<1, 1>(double (*x)[1], double (*Ktrans)[1], double (*Q)[1], double (*P)[1]);
+template void calculate_trace<1, CANDIDATE_LANES>(double (*x)[CANDIDATE_LANES], double (*Ktrans)[CANDIDATE_LANES], double (*Q)[CANDIDATE_LANES], double (*P)[CANDIDATE_LANES]);
+template void calculate_trace<2, 1>(double (*x)[1], double (*Ktrans)[1], double (*Q)[1], double (*P)[1]);
+template void calculate_trace<2, CANDIDATE_LANES>(double (*x)[CANDIDATE_LANES], double (*Ktrans)[CANDIDATE_LANES], double (*Q)[CANDIDATE_LANES], double (*P)[CANDIDATE_LANES]);
+template void calculate_trace<3, 1>(double (*x)[1], double (*Ktrans)[1], double (*Q)[1], double (*P)[1]);
+template void calculate_trace<3, CANDIDATE_LANES>(double (*x)[CANDIDATE_LANES], double (*Ktrans)[CANDIDATE_LANES], double (*Q)[CANDIDATE_LANES], double (*P)[CANDIDATE_LANES]);
+template void calculate_trace<4, 1>(double (*x)[1], double (*Ktrans)[1], double (*Q)[1], double (*P)[1]);
+template void calculate_trace<4, CANDIDATE_LANES>(double (*x)[CANDIDATE_LANES], double (*Ktrans)[CANDIDATE_LANES], double (*Q)[CANDIDATE_LANES], double (*P)[CANDIDATE_LANES]);
+
+template void optimize_stepwise<1, 1>(double (*x)[1], double (*Ktrans)[1], double (*Q)[1], double (*P)[1],
+				const bool* active, const int* max_it, double tolerance, double handoff,
+				int* p_iterations, int* p_accelerated);
+template void optimize_stepwise<1, CANDIDATE_LANES>(double (*x)[CANDIDATE_LANES], double (*Ktrans)[CANDIDATE_LANES], double (*Q)[CANDIDATE_LANES], double (*P)[CANDIDATE_LANES],
+				const bool* active, const int* max_it, double tolerance, double handoff,
+				int* p_iterations, int* p_accelerated);
+template void optimize_stepwise<2, 1>(double (*x)[1], double (*Ktrans)[1], double (*Q)[1], double (*P)[1],
+				const bool* active, const int* max_it, double tolerance, double handoff,
+				int* p_iterations, int* p_accelerated);
+template void optimize_stepwise<2, CANDIDATE_LANES>(double (*x)[CANDIDATE_LANES], double (*Ktrans)[CANDIDATE_LANES], double (*Q)[CANDIDATE_LANES], double (*P)[CANDIDATE_LANES],
+				const bool* active, const int* max_it, double tolerance, double handoff,
+				int* p_iterations, int* p_accelerated);
+template void optimize_stepwise<3, 1>(double (*x)[1], double (*Ktrans)[1], double (*Q)[1], double (*P)[1],
+				const bool* active, const int* max_it, double tolerance, double handoff,
+				int* p_iterations, int* p_accelerated);
+template void optimize_stepwise<3, CANDIDATE_LANES>(double (*x)[CANDIDATE_LANES], double (*Ktrans)[CANDIDATE_LANES], double (*Q)[CANDIDATE_LANES], double (*P)[CANDIDATE_LANES],
+				const bool* active, const int* max_it, double tolerance, double handoff,
+				int* p_iterations, int* p_accelerated);
+template void optimize_stepwise<4, 1>(double (*x)[1], double (*Ktrans)[1], double (*Q)[1], double (*P)[1],
+				const bool* active, const int* max_it, double tolerance, double handoff,
+				int* p_iterations, int* p_accelerated);
+template void optimize_stepwise<4, CANDIDATE_LANES>(double (*x)[CANDIDATE_LANES], double (*Ktrans)[CANDIDATE_LANES], double (*Q)[CANDIDATE_LANES], double (*P)[CANDIDATE_LANES],
+				const bool* active, const int* max_it, double tolerance, double handoff,
+				int* p_iterations, int* p_accelerated);
+
+template void calculate_trace_single<1, 1>(float (*x)[1], float (*Ktrans)[1], float (*Q)[1], float (*P)[1]);
+template void calculate_trace_single<1, CANDIDATE_LANES>(float (*x)[CANDIDATE_LANES], float (*Ktrans)[CANDIDATE_LANES], float (*Q)[CANDIDATE_LANES], float (*P)[CANDIDATE_LANES]);
+template void calculate_trace_single<2, 1>(float (*x)[1], float (*Ktrans)[1], float (*Q)[1], float (*P)[1]);
+template void calculate_trace_single<2, CANDIDATE_LANES>(float (*x)[CANDIDATE_LANES], float (*Ktrans)[CANDIDATE_LANES], float (*Q)[CANDIDATE_LANES], float (*P)[CANDIDATE_LANES]);
+template void calculate_trace_single<3, 1>(float (*x)[1], float (*Ktrans)[1], float (*Q)[1], float (*P)[1]);
+template void calculate_trace_single<3, CANDIDATE_LANES>(float (*x)[CANDIDATE_LANES], float (*Ktrans)[CANDIDATE_LANES], float (*Q)[CANDIDATE_LANES], float (*P)[CANDIDATE_LANES]);
+template void calculate_trace_single<4, 1>(float (*x)[1], float (*Ktrans)[1], float (*Q)[1], float (*P)[1]);
+template void calculate_trace_single<4, CANDIDATE_LANES>(float (*x)[CANDIDATE_LANES], float (*Ktrans)[CANDIDATE_LANES], float (*Q)[CANDIDATE_LANES], float (*P)[CANDIDATE_LANES]);
+
+template void optimize_stepwise_single<1, 1>(float (*x)[1], float (*Ktrans)[1], float (*Q)[1], float (*P)[1],
+				const bool* active, const int* max_it, float tolerance, float handoff,
+				int* p_iterations, int* p_accelerated);
+template void optimize_stepwise_single<1, CANDIDATE_LANES>(float (*x)[CANDIDATE_LANES], float (*Ktrans)[CANDIDATE_LANES], float (*Q)[CANDIDATE_LANES], float (*P)[CANDIDATE_LANES],
+				const bool* active, const int* max_it, float tolerance, float handoff,
+				int* p_iterations, int* p_accelerated);
+template void optimize_stepwise_single<2, 1>(float (*x)[1], float (*Ktrans)[1], float (*Q)[1], float (*P)[1],
+				const bool* active, const int* max_it, float tolerance, float handoff,
+				int* p_iterations, int* p_accelerated);
+template void optimize_stepwise_single<2, CANDIDATE_LANES>(float (*x)[CANDIDATE_LANES], float (*Ktrans)[CANDIDATE_LANES], float (*Q)[CANDIDATE_LANES], float (*P)[CANDIDATE_LANES],
+				const bool* active, const int* max_it, float tolerance, float handoff,
+				int* p_iterations, int* p_accelerated);
+template void optimize_stepwise_single<3, 1>(float (*x)[1], float (*Ktrans)[1], float (*Q)[1], float (*P)[1],
+				const bool* active, const int* max_it, float tolerance, float handoff,
+				int* p_iterations, int* p_accelerated);
+template void optimize_stepwise_single<3, CANDIDATE_LANES>(float (*x)[CANDIDATE_LANES], float (*Ktrans)[CANDIDATE_LANES], float (*Q)[CANDIDATE_LANES], float (*P)[CANDIDATE_LANES],
+				const bool* active, const int* max_it, float tolerance, float handoff,
+				int* p_iterations, int* p_accelerated);
+template void optimize_stepwise_single<4, 1>(float (*x)[1], float (*Ktrans)[1], float (*Q)[1], float (*P)[1],
+				const bool* active, const int* max_it, float tolerance, float handoff,
+				int* p_iterations, int* p_accelerated);
+template void optimize_stepwise_single<4, CANDIDATE_LANES>(float (*x)[CANDIDATE_LANES], float (*Ktrans)[CANDIDATE_LANES], float (*Q)[CANDIDATE_LANES], float (*P)[CANDIDATE_LANES],
+				const bool* active, const int* max_it, float tolerance, float handoff,
+				int* p_iterations, int* p_accelerated);
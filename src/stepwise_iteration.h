@@ -24,9 +24,36 @@ SOFTWARE.*/
 #ifndef STEPWISE_ITERATION_H
 #define STEPWISE_ITERATION_H
 
-double calculate_trace(int n, double* x, double* Ktrans, double* Q, double* P);
-double stepwise_iteration(int n, double* x, double* Ktrans, double* Q, double* P);
-double optimize_stepwise(int n, double* x, double* Ktrans, double* Q, double* P, int max_it, double tolerance);
+#include "lanes.h"
+
+// The iteration for n template coefficients, instantiated for 1 <= n <= 4, on
+// LANES problems in lock-step, where LANES is 1 or CANDIDATE_LANES.  Each
+// quantity is an array over the lanes: x[i][l] is coefficient i of lane l, and
+// Ktrans[i * 9 + k][l] element k of its transformed template i.
+//
+// optimize_stepwise iterates the active lanes, lane l for at most max_it[l]
+// (at least one) iterations, plus one if the last extrapolated step is
+// rejected, so that x, Q and P come from the same evaluation.  A lane stops
+// when the trace changes by less than tolerance, or when an iterate moves by
+// less than handoff (zero to disable).
+// The iteration and Anderson-accelerated step counts are written to
+// p_iterations and p_accelerated.  Inactive lanes are left unchanged.
+template <int n, int LANES> void calculate_trace(double (*x)[LANES], double (*Ktrans)[LANES],
+							double (*Q)[LANES], double (*P)[LANES]);
+template <int n, int LANES> void optimize_stepwise(double (*x)[LANES], double (*Ktrans)[LANES],
+							double (*Q)[LANES], double (*P)[LANES],
+							const bool* active, const int* max_it,
+							double tolerance, double handoff,
+							int* p_iterations, int* p_accelerated);
+
+// Single-precision versions, used to screen candidate correspondences
+template <int n, int LANES> void calculate_trace_single(float (*x)[LANES], float (*Ktrans)[LANES],
+							float (*Q)[LANES], float (*P)[LANES]);
+template <int n, int LANES> void optimize_stepwise_single(float (*x)[LANES], float (*Ktrans)[LANES],
+							float (*Q)[LANES], float (*P)[LANES],
+							const bool* active, const int* max_it,
+							float tolerance, float handoff,
+							int* p_iterations, int* p_accelerated);
 
 #endif
 
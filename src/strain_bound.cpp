@@ -0,0 +1,315 @@
+/*MIT License
+
+Copyright (c) 2019 P. M. Larsen
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.*/
+
+// The symmetrized cell has strain tensor F = s P, where P^T P = M^T G M for
+// M = L B^{-1} and some template metric G = (sum_j x_j T_j)^T (sum_j x_j T_j).
+// The template metrics span the subspace W = span{T_i^T T_j + T_j^T T_i}, so
+// F^T F lies in M^T W M.  If d is the Frobenius distance of the identity from
+// that subspace, then with E = F - I:
+//
+//	d <= |F^T F - I| = |E + E^T + E^T E| <= 2|E| + |E|^2
+//
+// which gives the bound |E| >= sqrt(1 + d) - 1.
+
+#include <cmath>
+#include <cfloat>
+#include <cstring>
+#include <algorithm>
+#include "constants.h"
+#include "cpu_dispatch.h"
+#include "templates.h"
+#include "matrix_vector.h"
+#include "strain_bound.h"
+
+
+#define SYM_DIM 6
+#define BOUND_LANES 8
+
+// symmetric 3x3 matrix as a vector with the Frobenius inner product
+static void symmetric_to_vector(double* A, double* v)
+{
+	v[0] = A[0];
+	v[1] = A[4];
+	v[2] = A[8];
+	v[3] = sqrt(2) * A[1];
+	v[4] = sqrt(2) * A[2];
+	v[5] = sqrt(2) * A[5];
+}
+
+static void vector_to_symmetric(double* v, double* A)
+{
+	A[0] = v[0];
+	A[4] = v[1];
+	A[8] = v[2];
+	A[1] = A[3] = v[3] / sqrt(2);
+	A[2] = A[6] = v[4] / sqrt(2);
+	A[5] = A[7] = v[5] / sqrt(2);
+}
+
+// orthonormalizes v against the first m rows of U (twice, for stability)
+static double orthogonalize(int m, double (*U)[SYM_DIM], double* v)
+{
+	for (int pass=0;pass<2;pass++)
+	{
+		for (int k=0;k<m;k++)
+		{
+			double dot = vector_dot<SYM_DIM>(U[k], v);
+			for (int l=0;l<SYM_DIM;l++)
+				v[l] -= dot * U[k][l];
+		}
+	}
+
+	return vector_norm<SYM_DIM>(v);
+}
+
+static void lane_norm(double (*v)[BOUND_LANES], double* norm)
+{
+	for (int l=0;l<BOUND_LANES;l++)
+	{
+		double dot = 0;
+		for (int e=0;e<SYM_DIM;e++)
+			dot += v[e][l] * v[e][l];
+		norm[l] = sqrt(dot);
+	}
+}
+
+// orthogonalize, for each lane
+static void orthogonalize_lanes(int m, double (*U)[SYM_DIM][BOUND_LANES], double (*v)[BOUND_LANES])
+{
+	for (int pass=0;pass<2;pass++)
+	{
+		for (int k=0;k<m;k++)
+		{
+			double dot[BOUND_LANES] = {0};
+			for (int e=0;e<SYM_DIM;e++)
+				for (int l=0;l<BOUND_LANES;l++)
+					dot[l] += U[k][e][l] * v[e][l];
+
+			for (int e=0;e<SYM_DIM;e++)
+				for (int l=0;l<BOUND_LANES;l++)
+					v[e][l] -= dot[l] * U[k][e][l];
+		}
+	}
+}
+
+namespace {
+struct MetricBasis
+{
+	int dim[NUM_BRAVAIS_TYPES];
+	double W[NUM_BRAVAIS_TYPES][SYM_DIM][9];
+
+	MetricBasis()
+	{
+		for (int type=0;type<NUM_BRAVAIS_TYPES;type++)
+		{
+			dim[type] = type == TRICLINIC ? SYM_DIM : 0;
+			if (type == TRICLINIC)
+				continue;
+
+			const int n = template_sizes[type];
+			double* T = (double*)templates[type];
+
+			double U[SYM_DIM][SYM_DIM];
+			for (int i=0;i<n;i++)
+			{
+				for (int j=i;j<n;j++)
+				{
+					double TiT[9], TjT[9], A[9], B[9], S[9];
+					memcpy(TiT, &T[i * 9], 9 * sizeof(double));
+					memcpy(TjT, &T[j * 9], 9 * sizeof(double));
+					transpose<3>(TiT);
+					transpose<3>(TjT);
+					matmul<3>(TiT, &T[j * 9], A);
+					matmul<3>(TjT, &T[i * 9], B);
+					for (int k=0;k<9;k++)
+						S[k] = A[k] + B[k];
+
+					int m = dim[type];
+					double v[SYM_DIM];
+					symmetric_to_vector(S, v);
+					double norm = orthogonalize(m, U, v);
+					if (m == SYM_DIM || norm < 1E-9)
+						continue;
+
+					for (int l=0;l<SYM_DIM;l++)
+						U[m][l] = v[l] / norm;
+					vector_to_symmetric(U[m], W[type][m]);
+					dim[type]++;
+				}
+			}
+		}
+	}
+};
+}
+
+static const MetricBasis& get_metric_basis()
+{
+	static const MetricBasis basis;
+	return basis;
+}
+
+// Evaluates the bound for BOUND_LANES candidates in lock-step.  Each quantity
+// is stored as an array over the lanes, so that the loops over lanes vectorize.
+static void bound_lanes(int type, int* L, double* inverse, double* bounds)
+{
+	const MetricBasis& basis = get_metric_basis();
+	const int m = basis.dim[type];
+
+	// M = L B^{-1}
+	double M[9][BOUND_LANES];
+	for (int i=0;i<3;i++)
+	{
+		for (int j=0;j<3;j++)
+		{
+			for (int l=0;l<BOUND_LANES;l++)
+			{
+				double acc = 0;
+				for (int k=0;k<3;k++)
+					acc += L[l * 9 + i * 3 + k] * inverse[k * 3 + j];
+				M[i * 3 + j][l] = acc;
+			}
+		}
+	}
+
+	// orthonormal basis of M^T W M.  Cancellation in the orthogonalization
+	// measures how much rounding error the bound can contain.
+	double cancellation[BOUND_LANES];
+	double U[SYM_DIM][SYM_DIM][BOUND_LANES];
+	for (int l=0;l<BOUND_LANES;l++)
+		cancellation[l] = 1;
+
+	for (int k=0;k<m;k++)
+	{
+		const double* W = basis.W[type][k];
+
+		// A = M^T W
+		double A[9][BOUND_LANES];
+		for (int i=0;i<3;i++)
+		{
+			for (int j=0;j<3;j++)
+			{
+				for (int l=0;l<BOUND_LANES;l++)
+				{
+					double acc = 0;
+					for (int t=0;t<3;t++)
+						acc += M[t * 3 + i][l] * W[t * 3 + j];
+					A[i * 3 + j][l] = acc;
+				}
+			}
+		}
+
+		// upper triangle of A M, as a vector
+		const int rows[SYM_DIM] = {0, 1, 2, 0, 0, 1};
+		const int cols[SYM_DIM] = {0, 1, 2, 1, 2, 2};
+		const double scale[SYM_DIM] = {1, 1, 1, sqrt(2), sqrt(2), sqrt(2)};
+		for (int e=0;e<SYM_DIM;e++)
+		{
+			int i = rows[e], j = cols[e];
+			for (int l=0;l<BOUND_LANES;l++)
+			{
+				double acc = 0;
+				for (int t=0;t<3;t++)
+					acc += A[i * 3 + t][l] * M[t * 3 + j][l];
+				U[k][e][l] = scale[e] * acc;
+			}
+		}
+
+		double before[BOUND_LANES], norm[BOUND_LANES];
+		lane_norm(U[k], before);
+		orthogonalize_lanes(k, U, U[k]);
+		lane_norm(U[k], norm);
+		for (int l=0;l<BOUND_LANES;l++)
+			cancellation[l] = std::max(cancellation[l], before[l] / norm[l]);
+
+		for (int e=0;e<SYM_DIM;e++)
+			for (int l=0;l<BOUND_LANES;l++)
+				U[k][e][l] /= norm[l];
+	}
+
+	double v[SYM_DIM][BOUND_LANES] = {{0}};
+	for (int l=0;l<BOUND_LANES;l++)
+		v[0][l] = v[1][l] = v[2][l] = 1;
+
+	double d[BOUND_LANES];
+	orthogonalize_lanes(m, U, v);
+	lane_norm(v, d);
+
+	for (int l=0;l<BOUND_LANES;l++)
+	{
+		double error = 1E-9 + 1E3 * DBL_EPSILON * cancellation[l];
+		bounds[l] = std::max(0., sqrt(1 + d[l]) - 1 - error);
+	}
+}
+
+static void _strain_lower_bounds(int type, int count, int* L, double* inverse, double* bounds)
+{
+	if (get_metric_basis().dim[type] == SYM_DIM)
+	{
+		for (int i=0;i<count;i++)
+			bounds[i] = 0;
+		return;
+	}
+
+	for (int begin=0;begin<count;begin+=BOUND_LANES)
+	{
+		int size = std::min(BOUND_LANES, count - begin);
+
+		// pad the final block by repeating its last candidate
+		int lanes[BOUND_LANES * 9];
+		double result[BOUND_LANES];
+		for (int l=0;l<BOUND_LANES;l++)
+			memcpy(&lanes[l * 9], &L[(begin + std::min(l, size - 1)) * 9], 9 * sizeof(int));
+
+		bound_lanes(type, lanes, inverse, result);
+		memcpy(&bounds[begin], result, size * sizeof(double));
+	}
+}
+
+typedef void (*bound_kernel)(int type, int count, int* L, double* inverse, double* bounds);
+
+static void bounds_baseline(int type, int count, int* L, double* inverse, double* bounds)
+{
+	_strain_lower_bounds(type, count, L, inverse, bounds);
+}
+
+TARGET_AVX2 static void bounds_avx2(int type, int count, int* L, double* inverse, double* bounds)
+{
+	_strain_lower_bounds(type, count, L, inverse, bounds);
+}
+
+TARGET_AVX512 static void bounds_avx512(int type, int count, int* L, double* inverse, double* bounds)
+{
+	_strain_lower_bounds(type, count, L, inverse, bounds);
+}
+
+void strain_lower_bounds(int type, int count, int* L, double* inverse, double* bounds)
+{
+	static const bound_kernel kernel = select_kernel<bound_kernel>(bounds_baseline, bounds_avx2, bounds_avx512);
+	kernel(type, count, L, inverse, bounds);
+}
+
+double strain_lower_bound(int type, int* L, double* inverse)
+{
+	double bound = 0;
+	strain_lower_bounds(type, 1, L, inverse, &bound);
+	return bound;
+}
@@ -25,20 +25,33 @@ SOFTWARE.*/
 #include <cstdlib>
 #include <cstring>
 #include <cmath>
+#include <climits>
 #include <cassert>
-#include <set>
 #include <vector>
+#include <algorithm>
+#include <functional>
+#include <utility>
 #include "mahalonobis_transform.h"
 #include "matrix_vector.h"
 #include "minkowski_reduction.h"
+#include "neighbourhood_sweep.h"
 #include "quaternion.h"
 #include "sqp_newton_lagrange.h"
 #include "stepwise_iteration.h"
+#include "strain_bound.h"
 #include "unimodular_neighbourhood.h"
 #include "unimodular_functions.h"
 #include "templates.h"
+#include "thread_pool.h"
+#include "two_coefficient_solver.h"
+#include "template_symmetry.h"
 #include "constants.h"
+#include "cpu_dispatch.h"
 #include "parse_string.h"
+#include "symmetrization.h"
+#include "visited_set.h"
+#include "counting_allocator.h"
+#include "lanes.h"
 
 
 static double optimal_scaling_factor(double* P)
@@ -64,75 +77,188 @@ static void get_key_matrix(double* S, double* key)
 	key[12] =       syx - sxy;  key[13] =       szx + sxz;  key[14] =        syz + szy;  key[15] = -sxx -syy + szz;
 }
 
-static double optimize_lattice_basis(int n, double* x, double* T, double* B, double* Q, double* opt)
+// Iteration counts of a candidate optimization
+typedef struct
 {
-	// compute Mahalonobis transform
-	double Ktrans[4 * 9];
-	mahalonobis_transform(n, T, B, Ktrans);
+	int stepwise;
+	int accelerated;
+	int newton;
+	bool restarted;		//a warm start stalled and was repeated from a cold start
+} SolveCounts;
+
+// Optimizes the coefficients x of the transformed templates from an initial
+// guess, for the active lanes of LANES candidates in lock-step.  A warm
+// initial guess is already close to the solution, so it only needs a single
+// stepwise iteration to find the rotation.  On exit Q and P are the polar
+// factors of the solution.  converged[l] is cleared if either stage stopped at
+// its iteration limit.  Inactive lanes are left unchanged, but must hold a
+// valid problem, which idle arithmetic is performed on.
+template <int n, int LANES>
+static void solve_template_coefficients(double (*x)[LANES], double (*Ktrans)[LANES], double (*Q)[LANES], double (*P)[LANES],
+					const bool* active, bool warm, SolveCounts* counts, bool* converged)
+{
+	// lanes which the general method below is applied to
+	bool general[LANES];
+	memcpy(general, active, sizeof(general));
+
+	// two coefficients reduce to a one-dimensional search over an angle,
+	// with the general method below as a fallback
+	if (n == 2)
+	{
+		for (int l=0;l<LANES;l++)
+		{
+			if (!active[l])
+				continue;
+
+			double x_angle[2] = {x[0][l], x[1][l]};
+			double Kl[n * 9], Ql[9], Pl[9];
+			for (int k=0;k<n*9;k++)
+				Kl[k] = Ktrans[k][l];
+
+			int num_iterations = 0;
+			bool angle_converged = optimize_two_coefficients(x_angle, Kl, Ql, Pl, 100, &num_iterations);
+			counts[l].stepwise += num_iterations;
+			if (!angle_converged)
+				continue;
+
+			if (determinant_3x3(Ql) < 0)
+			{
+				for (int i=0;i<9;i++)
+					Ql[i] = -Ql[i];
+				x_angle[0] = -x_angle[0];
+				x_angle[1] = -x_angle[1];
+			}
+
+			for (int i=0;i<9;i++)
+			{
+				Q[i][l] = Ql[i];
+				P[i][l] = Pl[i];
+			}
+			x[0][l] = x_angle[0];
+			x[1][l] = x_angle[1];
+			converged[l] = true;
+			general[l] = false;
+		}
+
+		if (first_lane<LANES>(general) < 0)
+			return;
+	}
 
 	// perform stepwise iteration to get a good initial guess
 	// for cubic templates (those with a single template parameter) the initial guess is optimal
-	double P[9];
 	double tolerance = 1E-5;
-	int max_it = n == 1 ? 1 : 100;	//cubic lattice types need a single iteration only
-	optimize_stepwise(n, x, Ktrans, Q, P, max_it, tolerance);
+	double handoff = 1E-3;
+	int max_it[LANES], num_iterations[LANES], num_accelerated[LANES];
+	for (int l=0;l<LANES;l++)
+		max_it[l] = n == 1 || warm ? 1 : 100;	//cubic lattice types need a single iteration only
+
+	optimize_stepwise<n, LANES>(x, Ktrans, Q, P, general, max_it, tolerance, handoff, num_iterations, num_accelerated);
+	for (int l=0;l<LANES;l++)
+	{
+		if (!general[l])
+			continue;
+
+		counts[l].stepwise += num_iterations[l];
+		counts[l].accelerated += num_accelerated[l];
+		converged[l] = n == 1 || warm || num_iterations[l] < max_it[l];
+	}
 
 	// use Newton's method to get fast convergence from initial guess to optimal solution
 	// (non-cubic templates only)
 	if (n >= 2)
 	{
-		// need rotation in quaternion form for SQP
-		double q[4];
-		rotation_matrix_to_quaternion(Q, q);
+		double args[6 + n][LANES];
+		double key[n][4][4][LANES];
+		for (int l=0;l<LANES;l++)
+		{
+			if (!general[l])
+				continue;
 
-		double key[4][16];
-		for (int i=0;i<n;i++)
-			get_key_matrix(&Ktrans[i * 9], key[i]);
+			// need rotation in quaternion form for SQP
+			double Ql[9], q[4];
+			for (int i=0;i<9;i++)
+				Ql[i] = Q[i][l];
+			rotation_matrix_to_quaternion(Ql, q);
 
-		// calculate initial Lagrange multipliers
-		double keysum[16] = {0};
-		for (int i=0;i<n;i++)
-			for (int j=0;j<16;j++)
-				keysum[j] += x[i] * key[i][j];
+			double keyl[4][16];
+			for (int i=0;i<n;i++)
+			{
+				double Kl[9];
+				for (int j=0;j<9;j++)
+					Kl[j] = Ktrans[i * 9 + j][l];
+				get_key_matrix(Kl, keyl[i]);
+			}
 
-		double temp[4];
-		matvec(4, keysum, q, temp);
-		double v = quat_dot(q, temp);
+			// calculate initial Lagrange multipliers
+			double keysum[16] = {0};
+			for (int i=0;i<n;i++)
+				for (int j=0;j<16;j++)
+					keysum[j] += x[i][l] * keyl[i][j];
 
-		// initialize solution vector
-		double kappa = v / 2;
-		double lambda = v;
-		double args[10] = {kappa, lambda, q[0], q[1], q[2], q[3], 0, 0, 0, 0};
-		for (int i=0;i<n;i++)
-			args[6 + i] = x[i];
+			double temp[4];
+			matvec<4>(keysum, q, temp);
+			double v = quat_dot(q, temp);
+
+			// initialize solution vector
+			args[0][l] = v / 2;	//kappa
+			args[1][l] = v;		//lambda
+			for (int i=0;i<4;i++)
+				args[2 + i][l] = q[i];
+			for (int i=0;i<n;i++)
+				args[6 + i][l] = x[i][l];
+
+			for (int i=0;i<n;i++)
+				for (int j=0;j<16;j++)
+					key[i][j / 4][j % 4][l] = keyl[i][j];
+		}
 
 		// perform sequential quadratic programming
-		for (int it=0;it<100;it++)
+		int num_newton[LANES];
+		bool stationary[LANES];
+		sqp_newton_lagrange<n, LANES>(args, key, general, 100, num_newton, stationary);
+		for (int l=0;l<LANES;l++)
 		{
-			double step[10];
-			double gradient_norm = newton_lagrange_step(n, args, (double (*)[4][4])key, step);
-			for (int i=0;i<6+n;i++)
-				args[i] -= step[i];
+			if (!general[l])
+				continue;
 
-			if (gradient_norm < 1E-14)
-				break;
-		}
+			counts[l].newton += num_newton[l];
+			converged[l] = converged[l] && stationary[l];
 
-		for (int i=0;i<n;i++)
-			x[i] = args[6 + i];
-		normalize_vector(n, x);
+			double xl[n];
+			for (int i=0;i<n;i++)
+				xl[i] = args[6 + i][l];
+			normalize_vector<n>(xl);
+			for (int i=0;i<n;i++)
+				x[i][l] = xl[i];
+		}
 	}
 
 	// ensure that Q, P, and x are consistent, post-optimization
-	calculate_trace(n, x, Ktrans, Q, P);
+	double Qt[9][LANES], Pt[9][LANES];
+	calculate_trace<n, LANES>(x, Ktrans, Qt, Pt);
+	for (int i=0;i<9;i++)
+	{
+		for (int l=0;l<LANES;l++)
+		{
+			Q[i][l] = general[l] ? Qt[i][l] : Q[i][l];
+			P[i][l] = general[l] ? Pt[i][l] : P[i][l];
+		}
+	}
+}
 
+// Computes the symmetrized cell, the template coefficients y and the strain
+// of a solution from its polar factor P
+template <int n>
+static double finish_solution(double* P, double* x, double* B, double* Hinvsqrt, double* opt, double* y)
+{
 	// calculate optimal scaling factor
 	double s = optimal_scaling_factor(P);
 	for (int i=0;i<9;i++)
 		P[i] *= s;
 
 	// post-multiply strain tensor by B to get symmetrized cell (in original frame)
-	matmul(3, P, B, opt);
+	matmul<3>(P, B, opt);
+	matvec<n>(Hinvsqrt, x, y);
 
 	// calculate objective function |P - I|_F
 	double obj = 0;
@@ -147,6 +273,154 @@ static double optimize_lattice_basis(int n, double* x, double* T, double* B, dou
 	return sqrt(obj);
 }
 
+// Optimizes the first `count` of LANES candidates in lock-step, where
+// candidate l has the templates T[l] transformed by its correspondence.  If
+// seeds[l] is not NULL, the optimization starts from the template
+// coefficients of a previous solution, and falls back to the cold initial
+// guess x if that does not converge.  The remaining lanes repeat the last
+// candidate.  The template coefficients of the solutions are written to y.
+template <int n, int LANES>
+static void optimize_lattice_basis(	int count, double (*T)[n * 9], double* B, PreparedBasis* prepared,
+					const double* const* seeds, const double* x, double (*Q)[9],
+					double (*opt)[9], double (*y)[4], double* strain, SolveCounts* counts)
+{
+	// compute Mahalonobis transforms
+	double Ktrans[n * 9][LANES];
+	double Hsqrt[LANES][n * n], Hinvsqrt[LANES][n * n];
+	for (int l=0;l<count;l++)
+	{
+		double Kl[n * 9];
+		mahalonobis_transform<n>(T[l], prepared, Kl, Hsqrt[l], Hinvsqrt[l]);
+		for (int k=0;k<n*9;k++)
+			Ktrans[k][l] = Kl[k];
+	}
+	for (int l=count;l<LANES;l++)
+		copy_lane<n * 9, LANES>(Ktrans, count - 1, l);
+
+	double xs[n][LANES], Qs[9][LANES], Ps[9][LANES];
+	bool warm[LANES], converged[LANES];
+	for (int l=0;l<LANES;l++)
+	{
+		warm[l] = l < count && seeds[l] != NULL && n >= 2;
+		converged[l] = false;
+
+		double x_warm[4];
+		memcpy(x_warm, x, n * sizeof(double));
+		if (warm[l])
+		{
+			matvec<n>(Hsqrt[l], (double*)seeds[l], x_warm);
+			normalize_vector<n>(x_warm);
+		}
+		for (int i=0;i<n;i++)
+			xs[i][l] = x_warm[i];
+	}
+
+	if (first_lane<LANES>(warm) >= 0)
+		solve_template_coefficients<n, LANES>(xs, Ktrans, Qs, Ps, warm, true, counts, converged);
+
+	bool cold[LANES];
+	for (int l=0;l<LANES;l++)
+	{
+		cold[l] = l < count && !converged[l];
+		if (warm[l] && cold[l])
+			counts[l].restarted = true;
+
+		for (int i=0;i<n;i++)
+			xs[i][l] = cold[l] ? x[i] : xs[i][l];
+	}
+
+	if (first_lane<LANES>(cold) >= 0)
+		solve_template_coefficients<n, LANES>(xs, Ktrans, Qs, Ps, cold, false, counts, converged);
+
+	for (int l=0;l<count;l++)
+	{
+		double P[9], xl[n];
+		for (int i=0;i<9;i++)
+		{
+			Q[l][i] = Qs[i][l];
+			P[i] = Ps[i][l];
+		}
+		for (int i=0;i<n;i++)
+			xl[i] = xs[i][l];
+
+		strain[l] = finish_solution<n>(P, xl, B, Hinvsqrt[l], opt[l], y[l]);
+	}
+}
+
+// Single-precision counterpart of optimize_lattice_basis, used to screen
+// candidate correspondences.  The stepwise iteration is run to convergence
+// without the SQP refinement, whose stationarity test is below single
+// precision, so the strain is accurate to a few significant figures only.
+template <int n, int LANES>
+static void screen_lattice_basis(	int count, double (*T)[n * 9], double* B, PreparedBasis* prepared,
+					const double* const* seeds, const double* x, double (*Q)[9],
+					double (*opt)[9], double (*y)[4], double* strain, SolveCounts* counts)
+{
+	float xf[n][LANES] = {{0}}, Kf[n * 9][LANES] = {{0}}, Qf[9][LANES], Pf[9][LANES];
+	double Hinvsqrt[LANES][n * n];
+	for (int l=0;l<count;l++)
+	{
+		double Ktrans[n * 9];
+		double Hsqrt[n * n];
+		mahalonobis_transform<n>(T[l], prepared, Ktrans, Hsqrt, Hinvsqrt[l]);
+
+		double x0[4];
+		memcpy(x0, x, n * sizeof(double));
+		if (seeds[l] != NULL && n >= 2)
+		{
+			matvec<n>(Hsqrt, (double*)seeds[l], x0);
+			normalize_vector<n>(x0);
+		}
+
+		for (int i=0;i<n;i++)
+			xf[i][l] = x0[i];
+		for (int k=0;k<n*9;k++)
+			Kf[k][l] = Ktrans[k];
+	}
+
+	bool active[LANES];
+	int max_it[LANES];
+	for (int l=0;l<LANES;l++)
+	{
+		active[l] = l < count;
+		max_it[l] = n == 1 ? 1 : 100;
+		if (l >= count)
+		{
+			copy_lane<n, LANES>(xf, count - 1, l);
+			copy_lane<n * 9, LANES>(Kf, count - 1, l);
+		}
+	}
+
+	// there is no SQP stage to hand over to, so the iteration runs to convergence
+	int num_iterations[LANES], num_accelerated[LANES];
+	optimize_stepwise_single<n, LANES>(xf, Kf, Qf, Pf, active, max_it, 1E-5, 0, num_iterations, num_accelerated);
+	calculate_trace_single<n, LANES>(xf, Kf, Qf, Pf);
+
+	for (int l=0;l<count;l++)
+	{
+		counts[l].stepwise += num_iterations[l];
+		counts[l].accelerated += num_accelerated[l];
+
+		double P[9], xl[n];
+		for (int i=0;i<9;i++)
+		{
+			Q[l][i] = Qf[i][l];
+			P[i] = Pf[i][l];
+		}
+		for (int i=0;i<n;i++)
+			xl[i] = xf[i][l];
+
+		strain[l] = finish_solution<n>(P, xl, B, Hinvsqrt[l], opt[l], y[l]);
+	}
+}
+
+// Smallest decrease in strain which counts as an improvement.  Screened
+// strains are only accurate to single precision.
+static double improvement_tolerance(const SearchOptions* options)
+{
+	return options->single_precision ? 1E-5 : 1E-10;
+}
+
 static int initialize_lattice_basis(	double* B, bool search_correspondences,
 					double* R, int* path)
 {
@@ -167,26 +441,579 @@ static int initialize_lattice_basis(	double* B, bool search_correspondences,
 	}
 
 	if (determinant_3x3(B) < 0) {
-		flip_matrix(3, R);
-		flip_matrix_i(3, path);
+		flip_matrix<3>(R);
+		flip_matrix<3>(path);
 	}
 
 	return 0;
 }
 
-static int _optimize(	char* name,
-			double* B,	//lattice basis in column-vector format
-			bool search_correspondences,
+typedef struct
+{
+	int L[9];
+	int expansion;		//index of the expansion which generated the candidate
+	double bound;
+	bool evaluated;
+	double strain;
+	double Q[9];
+	double opt[9];
+	double y[4];		//template coefficients of the solution
+	SolveCounts counts;
+} Candidate;
+
+// Minimum over a prefix of values which are set one at a time (Fenwick tree)
+class PrefixMinimum
+{
+public:
+	PrefixMinimum(uint64_t* allocations) : tree(allocations) {}
+
+	void reset(int n) {
+		tree.assign(n + 1, INFINITY);
+	}
+
+	void update(int index, double value) {
+		for (int i=index+1;i<(int)tree.size();i+=i&-i)
+			tree[i] = std::min(tree[i], value);
+	}
+
+	// minimum of the values at positions less than index
+	double query(int index) {
+		double result = INFINITY;
+		for (int i=index;i>0;i-=i&-i)
+			result = std::min(result, tree[i]);
+		return result;
+	}
+
+private:
+	counted_vector<double> tree;
+};
+
+// A correspondence L0 whose neighbourhood is searched
+struct Expansion
+{
+	bool warm;			//whether the neighbours are warm-started from the L0 solution
+	double seed[4];			//template coefficients of the L0 solution
+	int begin, end;			//range of the neighbours in the search order
+	int next;			//position of the next neighbour to be evaluated
+};
+
+// Best solution found so far
+struct SearchState
+{
+	int L[9];
+	double strain;
+	double Q[9];
+	double cell[9];
+	double y[4];		//template coefficients of the solution
+	bool have_parent;	//whether y is known
+};
+
+// Buffers reused across searches to avoid allocating.  They grow to the size
+// of the largest search performed, after which a search makes no allocations.
+struct SearchWorkspace
+{
+	uint64_t allocations;	//heap allocations made by the buffers
+	VisitedSet visited;
+	counted_vector<Candidate> candidates;
+	counted_vector<Expansion> expansions;
+	counted_vector<int> order;
+	counted_vector<std::pair<double, int> > frontier;
+	PrefixMinimum evaluated_minimum;
+	counted_vector<int> wave;
+	counted_vector<uint64_t> keys;
+	counted_vector<uint8_t> too_large;
+	counted_vector<int> Ls;
+	counted_vector<double> bounds;
+
+	SearchWorkspace()
+		: allocations(0), visited(&allocations), candidates(&allocations), expansions(&allocations),
+		  order(&allocations), frontier(&allocations), evaluated_minimum(&allocations),
+		  wave(&allocations), keys(&allocations), too_large(&allocations), Ls(&allocations),
+		  bounds(&allocations)
+	{
+	}
+};
+
+struct EvaluationTask
+{
+	int type;
+	PreparedCell* cell;
+	Candidate* candidates;
+	Expansion* expansions;
+	int* wave;
+	int size;		//number of candidates in the wave
+	bool single_precision;
+};
+
+// cold initial guess for the template coefficients
+template <int n>
+static void initial_coefficients(int type, double* x)
+{
+	for (int i=0;i<4;i++)
+		x[i] = 1;
+	if (type == RHOMBOHEDRAL)
+		x[1] = 0;
+	normalize_vector<n>(x);
+}
+
+// Evaluates the candidates at positions begin to begin + count - 1 of the
+// wave in lock-step
+template <int n, int LANES>
+static void evaluate_candidates(EvaluationTask* task, int begin, int count)
+{
+	const int type = task->type;
+	double* T = (double*)templates[type];
+
+	Candidate* c[LANES];
+	double A[LANES][n * 9];
+	const double* seeds[LANES];
+	for (int l=0;l<count;l++)
+	{
+		c[l] = &task->candidates[task->wave[begin + l]];
+		for (int j=0;j<n;j++)
+			matmul<3>(&T[j * 9], c[l]->L, &A[l][j * 9]);
+
+		Expansion* e = &task->expansions[c[l]->expansion];
+		seeds[l] = e->warm ? e->seed : NULL;
+	}
+
+	double x[4];
+	initial_coefficients<n>(type, x);
+
+	PreparedCell* cell = task->cell;
+	double Q[LANES][9], opt[LANES][9], y[LANES][4], strain[LANES];
+	SolveCounts counts[LANES];
+	memset(counts, 0, sizeof(counts));
+	if (task->single_precision)
+		screen_lattice_basis<n, LANES>(count, A, cell->R, &cell->prepared, seeds, x, Q, opt, y, strain, counts);
+	else
+		optimize_lattice_basis<n, LANES>(count, A, cell->R, &cell->prepared, seeds, x, Q, opt, y, strain, counts);
+
+	for (int l=0;l<count;l++)
+	{
+		c[l]->strain = strain[l];
+		memcpy(c[l]->Q, Q[l], 9 * sizeof(double));
+		memcpy(c[l]->opt, opt[l], 9 * sizeof(double));
+		memcpy(c[l]->y, y[l], n * sizeof(double));
+		c[l]->counts = counts[l];
+		c[l]->evaluated = true;
+	}
+}
+
+// Each task evaluates CANDIDATE_LANES consecutive candidates of the wave, and
+// a lone candidate without the lanes
+template <int n>
+static void evaluate_batch(int index, void* context)
+{
+	EvaluationTask* task = (EvaluationTask*)context;
+	int begin = index * CANDIDATE_LANES;
+	int count = std::min(CANDIDATE_LANES, task->size - begin);
+	if (count == 1)
+		evaluate_candidates<n, 1>(task, begin, count);
+	else
+		evaluate_candidates<n, CANDIDATE_LANES>(task, begin, count);
+}
+
+template <int n>
+static void evaluation_task_baseline(int index, void* context)
+{
+	evaluate_batch<n>(index, context);
+}
+
+template <int n>
+TARGET_AVX2 static void evaluation_task_avx2(int index, void* context)
+{
+	evaluate_batch<n>(index, context);
+}
+
+template <int n>
+TARGET_AVX512 static void evaluation_task_avx512(int index, void* context)
+{
+	evaluate_batch<n>(index, context);
+}
+
+typedef void (*evaluation_kernel)(int, void*);
+
+template <int n>
+static evaluation_kernel evaluation_task()
+{
+	return select_kernel<evaluation_kernel>(evaluation_task_baseline<n>, evaluation_task_avx2<n>,
+						evaluation_task_avx512<n>);
+}
+
+// The candidate optimization is specialized for each template size, so that
+// its loops and buffers have fixed sizes, and for the instruction set of the
+// CPU.  The specialization is chosen once per wave.
+static const evaluation_kernel evaluation_tasks[] = {NULL, evaluation_task<1>(), evaluation_task<2>(),
+							evaluation_task<3>(), evaluation_task<4>()};
+
+// Evaluates the candidates of the current wave, in batches of CANDIDATE_LANES
+// per participating thread
+static void evaluate_wave(	int type, PreparedCell* cell, const SearchOptions* options,
+				SearchWorkspace* ws, SearchInfo* info)
+{
+	EvaluationTask task;
+	task.type = type;
+	task.cell = cell;
+	task.candidates = ws->candidates.data();
+	task.expansions = ws->expansions.data();
+	task.wave = ws->wave.data();
+	task.size = ws->wave.size();
+	task.single_precision = options->single_precision;
+	parallel_for((task.size + CANDIDATE_LANES - 1) / CANDIDATE_LANES, evaluation_tasks[template_sizes[type]], &task);
+
+	for (int i : ws->wave)
+	{
+		Candidate* c = &ws->candidates[i];
+		info->stepwise_iterations += c->counts.stepwise;
+		info->accelerated_steps += c->counts.accelerated;
+		info->newton_iterations += c->counts.newton;
+		info->restarts += c->counts.restarted;
+	}
+	info->evaluated += ws->wave.size();
+}
+
+static void accept_candidate(int n, Candidate* c, SearchState* state)
+{
+	state->strain = c->strain;
+	memcpy(state->L, c->L, 9 * sizeof(int));
+	memcpy(state->Q, c->Q, 9 * sizeof(double));
+	memcpy(state->cell, c->opt, 9 * sizeof(double));
+	memcpy(state->y, c->y, n * sizeof(double));
+	state->have_parent = true;
+}
+
+// Appends the unvisited neighbours of L0 to the candidates, and adds an
+// expansion which orders them by increasing lower bound.
+static void expand(	int type, PreparedCell* cell, int* L0, int radius,
+			bool warm_start, SearchState* state, SearchWorkspace* ws)
+{
+	const int8_t (*neighbourhood)[9] = unimodular_neighbourhood();
+
+	// correspondences related by a template symmetry give identical strains,
+	// so only the first one encountered in each equivalence class is evaluated
+	int num_neighbours = unimodular_neighbourhood_size(radius);
+	ws->keys.resize(num_neighbours);
+	ws->too_large.resize(num_neighbours);
+	sweep_neighbourhood(template_symmetry(type), L0, num_neighbours, ws->keys.data(), ws->too_large.data());
+
+	counted_vector<Candidate>& candidates = ws->candidates;
+	int index = ws->expansions.size();
+	int begin = candidates.size();
+	ws->Ls.clear();
+	for (int i=0;i<num_neighbours;i++)
+	{
+		if (ws->too_large[i] || !ws->visited.insert(ws->keys[i]))
+			continue;
+
+		Candidate c;
+		matmul<3>(L0, neighbourhood[i], c.L);
+		c.expansion = index;
+		c.evaluated = false;
+		candidates.push_back(c);
+		ws->Ls.insert(ws->Ls.end(), c.L, c.L + 9);
+	}
+
+	int end = candidates.size();
+	ws->bounds.resize(end - begin);
+	strain_lower_bounds(type, end - begin, ws->Ls.data(), cell->prepared.inverse, ws->bounds.data());
+	for (int i=begin;i<end;i++)
+		candidates[i].bound = ws->bounds[i - begin];
+
+	ws->order.resize(end);
+	for (int i=begin;i<end;i++)
+		ws->order[i] = i;
+	// ties are broken by position, as a stable sort would, without its buffer
+	std::sort(ws->order.begin() + begin, ws->order.end(), [&candidates](int a, int b) {
+		return candidates[a].bound < candidates[b].bound
+			|| (candidates[a].bound == candidates[b].bound && a < b);
+	});
+
+	Expansion e;
+	// neighbours are seeded with the solution of L0, once one is known
+	e.warm = warm_start && state->have_parent;
+	memcpy(e.seed, state->y, 4 * sizeof(double));
+	e.begin = begin;
+	e.end = end;
+	e.next = begin;
+	ws->expansions.push_back(e);
+}
+
+// Greedy hill-climb: each round re-centres on the best correspondence and
+// moves to its best neighbour.  With the adaptive policy, the search starts
+// in a small neighbourhood which is grown whenever a round fails to improve,
+// and reset after each improvement.  The search ends when a round in the full
+// neighbourhood fails to improve.
+static void hill_climb(	int type, PreparedCell* cell, const SearchOptions* options,
+			int max_radius, int max_rounds, int wave_size,
+			SearchWorkspace* ws, SearchState* state, SearchInfo* info)
+{
+	const int n = template_sizes[type];
+	const double epsilon = improvement_tolerance(options);
+	int min_radius = options->adaptive ? std::min(2, max_radius) : max_radius;
+	int radius = min_radius;
+	int improvements = 0;
+
+	while (improvements < max_rounds)
+	{
+		int L0[9];
+		memcpy(L0, state->L, 9 * sizeof(int));
+		info->rounds++;
+
+		ws->candidates.clear();
+		ws->expansions.clear();
+		expand(type, cell, L0, radius, options->warm_start, state, ws);
+
+		// Evaluate the most promising candidates first.  Candidate i can only
+		// be accepted below if its strain is less than best_strain - epsilon and
+		// less than the strain of every candidate before it, so it is skipped
+		// when its lower bound rules that out.
+		counted_vector<Candidate>& candidates = ws->candidates;
+		int m = candidates.size();
+		ws->evaluated_minimum.reset(m);
+		double best_strain = state->strain;
+
+		// With the prefilter, the round stops after `quota` consecutive
+		// candidates fail to improve on the best strain of the round.  The
+		// result is unverified if the exhaustive search would have optimized
+		// any other candidate.
+		int quota = options->prefilter > 0 ? options->prefilter : m;
+		int num_unimproved = 0;
+		double round_minimum = INFINITY;
+		int next = 0;
+		while (next < m)
+		{
+			ws->wave.clear();
+			while (next < m && (int)ws->wave.size() < wave_size)
+			{
+				int i = ws->order[next];
+				Candidate* c = &candidates[i];
+				if (c->bound >= best_strain - epsilon)
+				{
+					next = m;
+					break;
+				}
+
+				next++;
+				if (c->bound < ws->evaluated_minimum.query(i))
+				{
+					if (num_unimproved == quota)
+					{
+						info->verified = false;
+						next = m;
+						break;
+					}
+
+					ws->wave.push_back(i);
+					num_unimproved++;
+				}
+			}
+
+			evaluate_wave(type, cell, options, ws, info);
+			for (int i : ws->wave)
+			{
+				if (candidates[i].strain < round_minimum - epsilon)
+				{
+					round_minimum = candidates[i].strain;
+					num_unimproved = 0;
+				}
+				ws->evaluated_minimum.update(i, candidates[i].strain);
+			}
+		}
+
+		// accept improvements in neighbourhood order
+		bool found = false;
+		for (int i=0;i<m;i++)
+		{
+			Candidate* c = &candidates[i];
+			if (c->evaluated && c->strain < state->strain - epsilon)
+			{
+				accept_candidate(n, c, state);
+				found = true;
+			}
+		}
+
+		if (found)
+		{
+			info->radius = radius;
+			improvements++;
+			radius = min_radius;
+		}
+		else if (radius < max_radius)
+		{
+			radius = std::min(2 * radius, max_radius);
+		}
+		else
+		{
+			break;
+		}
+	}
+}
+
+// Best-first search.  Every expanded correspondence stays in the frontier,
+// keyed by the lower bound of its next unevaluated neighbour, and the
+// neighbour with the smallest bound over the whole frontier is evaluated
+// next, pruned against the best strain found so far.  The best
+// correspondence is expanded once no neighbour left in the frontier can
+// improve on it, up to max_rounds expansions; expanding each improvement
+// immediately evaluates more candidates.  The search ends when the frontier
+// is exhausted, so that, as for the hill-climb, the result is a local minimum
+// over its neighbourhood unless the expansion limit is reached.
+static void best_first(	int type, PreparedCell* cell, const SearchOptions* options,
+			int radius, int max_rounds, int wave_size,
+			SearchWorkspace* ws, SearchState* state, SearchInfo* info)
+{
+	typedef std::pair<double, int> Entry;
+	const int n = template_sizes[type];
+	const double epsilon = improvement_tolerance(options);
+	counted_vector<Entry>& frontier = ws->frontier;
+	frontier.clear();
+	ws->candidates.clear();
+	ws->expansions.clear();
+
+	// pushes an expansion onto the frontier if it has neighbours left
+	auto push = [ws, &frontier](int index) {
+		Expansion* e = &ws->expansions[index];
+		if (e->next < e->end)
+		{
+			frontier.push_back(Entry(ws->candidates[ws->order[e->next]].bound, index));
+			std::push_heap(frontier.begin(), frontier.end(), std::greater<Entry>());
+		}
+	};
+
+	int L0[9];
+	memcpy(L0, state->L, 9 * sizeof(int));
+	expand(type, cell, L0, radius, options->warm_start, state, ws);
+	info->rounds++;
+	info->radius = radius;
+	push(0);
+	bool pending = false;		//whether the best correspondence is unexpanded
+	int best_index = -1;
+
+	// with the prefilter, the search moves on after `quota` consecutive
+	// candidates fail to improve
+	int quota = options->prefilter > 0 ? options->prefilter : INT_MAX;
+	int num_unimproved = 0;
+
+	while (true)
+	{
+		ws->wave.clear();
+		while (!frontier.empty() && (int)ws->wave.size() < wave_size)
+		{
+			Entry top = frontier.front();
+			if (top.first >= state->strain - epsilon)
+			{
+				// no remaining neighbour can improve
+				frontier.clear();
+				break;
+			}
+
+			if (num_unimproved == quota)
+			{
+				// the prefilter stops as if the frontier were exhausted
+				info->verified = false;
+				frontier.clear();
+				break;
+			}
+
+			std::pop_heap(frontier.begin(), frontier.end(), std::greater<Entry>());
+			frontier.pop_back();
+			Expansion* e = &ws->expansions[top.second];
+			ws->wave.push_back(ws->order[e->next++]);
+			push(top.second);
+			num_unimproved++;
+		}
+
+		if (ws->wave.empty())
+		{
+			if (!pending || info->rounds >= max_rounds)
+				break;
+
+			memcpy(L0, state->L, 9 * sizeof(int));
+			expand(type, cell, L0, radius, options->warm_start, state, ws);
+			info->rounds++;
+			push(ws->expansions.size() - 1);
+			pending = false;
+			num_unimproved = 0;
+			continue;
+		}
+
+		// As in the hill-climb, ties are resolved in favour of the candidate
+		// generated first, which is nearest to the start.  Its neighbourhood
+		// overlaps most with those already visited.  A tie never trades the
+		// accepted strain for a higher one.
+		evaluate_wave(type, cell, options, ws, info);
+		for (int i : ws->wave)
+		{
+			Candidate* c = &ws->candidates[i];
+			bool tie = pending && i < best_index && c->strain <= state->strain;
+			if (c->strain < state->strain - epsilon || tie)
+			{
+				accept_candidate(n, c, state);
+				best_index = i;
+				pending = true;
+				num_unimproved = 0;
+			}
+		}
+	}
+}
+
+// Re-optimizes the result of a single-precision search in double precision,
+// warm-started from its screened template coefficients
+template <int n>
+static void refine_solution(int type, PreparedCell* cell, SearchState* state, SearchInfo* info)
+{
+	double* T = (double*)templates[type];
+
+	double A[n * 9];
+	for (int j=0;j<n;j++)
+		matmul<3>(&T[j * 9], state->L, &A[j * 9]);
+
+	double x[4];
+	initial_coefficients<n>(type, x);
+
+	SolveCounts counts = {0, 0, 0, false};
+	const double* seed = state->y;
+	double y[1][4];
+	optimize_lattice_basis<n, 1>(1, (double (*)[n * 9])A, cell->R, &cell->prepared, &seed, x,
+					(double (*)[9])state->Q, (double (*)[9])state->cell, y, &state->strain, &counts);
+	memcpy(state->y, y[0], n * sizeof(double));
+
+	info->stepwise_iterations += counts.stepwise;
+	info->accelerated_steps += counts.accelerated;
+	info->newton_iterations += counts.newton;
+	info->restarts += counts.restarted;
+}
+
+static void (*const refine_solutions[])(int, PreparedCell*, SearchState*, SearchInfo*) = {
+								NULL, refine_solution<1>, refine_solution<2>,
+								refine_solution<3>, refine_solution<4>};
+
+// The search starts from the correspondence `start` (the identity if NULL),
+// and if `seed` is given, candidates of the first round are warm-started from
+// those template coefficients.  The template coefficients of the result are
+// written to `coefficients` if it is not NULL.
+static int _optimize(	int type,
+			PreparedCell* cell,
+			const SearchOptions* options,
+			const int* start,
+			const double* seed,
 			int* correspondence,
 			double* rotation,
 			double* symmetrized,
-			double* p_strain)
+			double* p_strain,
+			double* coefficients,
+			SearchInfo* info)
 {
-	int type = parse_string(name);
-	assert(type <= 13);
-	if (type < 0)
+	if (type < 0 || type > 13)
 		return INVALID_BRAVAIS_TYPE;
 
+	SearchInfo dummy_info;
+	if (info == NULL)
+		info = &dummy_info;
+	memset(info, 0, sizeof(SearchInfo));
+	info->verified = true;
+
 	// triclinic lattice has trivial solution
 	if (type == TRICLINIC)
 	{
@@ -202,80 +1029,79 @@ static int _optimize(	char* name,
 		rotation[4] = 1;
 		rotation[8] = 1;
 
-		memcpy(symmetrized, B, 9 * sizeof(double));
+		memcpy(symmetrized, cell->B, 9 * sizeof(double));
 		*p_strain = 0;
 		return 0;
 	}
 
-	double R[9] = {0};
-	int path[9] = {0};
-	int ret = initialize_lattice_basis(B, search_correspondences, R, path);
-	if (ret != 0)
-		return ret;
-
-	int Lbest[9] = {1, 0, 0, 0, 1, 0, 0, 0, 1};
-	double best_strain = INFINITY;
-	double best_cell[9] = {0};
-	std::set<uint64_t> visited;
-
-	int num_neighbours = search_correspondences ? NUM_UNIMODULAR_NEIGHBOURS : 1;
-	int max_it = search_correspondences ? 40 : 1;
+	int* path = cell->path;
+	bool search_correspondences = cell->search_correspondences;
 
 	const int n = template_sizes[type];
-	double* T = (double*)templates[type];
+	SearchState state;
+	memset(&state, 0, sizeof(SearchState));
+	state.L[0] = state.L[4] = state.L[8] = 1;
+	state.strain = INFINITY;
+	state.have_parent = seed != NULL;
+	if (start != NULL)
+		memcpy(state.L, start, 9 * sizeof(int));
+	if (seed != NULL)
+		memcpy(state.y, seed, n * sizeof(double));
 
-	for (int it=0;it<max_it;it++)
-	{
-		int L0[9];
-		memcpy(L0, Lbest, 9 * sizeof(int));
-		bool found = false;
+	SearchOptions defaults;
+	default_search_options(&defaults);
+	if (options == NULL)
+		options = &defaults;
 
-		for (int i=0;i<num_neighbours;i++)
-		{
-			int Lcur[9];
-			matmul_int8(3, L0, unimodular_neighborhood[i], Lcur);
-			if (unimodular_too_large(Lcur))
-				continue;
+	// without a workspace, that of the calling thread is reused across calls
+	static thread_local SearchWorkspace local;
+	SearchWorkspace* ws = options->workspace != NULL ? options->workspace : &local;
+	ws->visited.clear();
 
-			uint64_t key = unimodular_hash(Lcur);
-			if (visited.find(key) != visited.end())
-				continue;
-			visited.insert(key);
+	// a wave fills the lanes of each participating thread
+	int wave_size = (options->parallel ? parallel_width() : 1) * CANDIDATE_LANES;
 
-			double A[4 * 9];
-			for (int j=0;j<n;j++)
-				matmul_di(3, &T[j * 9], Lcur, &A[j * 9]);
+	// without a correspondence search only the identity is evaluated
+	int max_radius = search_correspondences ? std::max(0, std::min(options->radius, MAX_NEIGHBOURHOOD_RADIUS)) : 0;
+	int max_rounds = search_correspondences ? options->max_rounds : 1;
+	if (options->strategy == BEST_FIRST)
+		best_first(type, cell, options, max_radius, max_rounds, wave_size, ws, &state, info);
+	else
+		hill_climb(type, cell, options, max_radius, max_rounds, wave_size, ws, &state, info);
 
-			double x[4] = {1, 1, 1, 1};
-			if (type == RHOMBOHEDRAL)
-				x[1] = 0;
-			normalize_vector(n, x);
+	if (options->single_precision)
+		refine_solutions[n](type, cell, &state, info);
 
-			double Q[9], opt[9];
-			double strain = optimize_lattice_basis(n, x, A, R, Q, opt);
-			if (strain < best_strain - 1E-10)
-			{
-				best_strain = strain;
-				memcpy(Lbest, Lcur, 9 * sizeof(int));
-				memcpy(rotation, Q, 9 * sizeof(double));
-				memcpy(best_cell, opt, 9 * sizeof(double));
-				found = true;
-			}
-		}
-
-		if (!found)
-			break;
-	}
+	memcpy(rotation, state.Q, 9 * sizeof(double));
 
 	int Linverse[9] = {0};
 	unimodular_inverse_3x3i(path, Linverse);
-	matmul_di(3, best_cell, Linverse, symmetrized);
+	matmul<3>(state.cell, Linverse, symmetrized);
 
 	int inverseLbest[9] = {0};
-	unimodular_inverse_3x3i(Lbest, inverseLbest);
-	matmuli(3, path, inverseLbest, correspondence);
+	unimodular_inverse_3x3i(state.L, inverseLbest);
+	matmul<3>(path, inverseLbest, correspondence);
+
+	*p_strain = state.strain;
+	if (coefficients != NULL)
+		memcpy(coefficients, state.y, n * sizeof(double));
+
+	if (options->single_precision && options->validate)
+	{
+		// repeat the search in double precision for comparison
+		SearchOptions exact = *options;
+		exact.single_precision = false;
+		exact.validate = false;
+
+		int L[9];
+		double Q[9], cell_exact[9], strain = INFINITY;
+		SearchInfo exact_info;
+		int ret = _optimize(type, cell, &exact, start, seed, L, Q, cell_exact, &strain, NULL, &exact_info);
+		if (ret != 0)
+			return ret;
 
-	*p_strain = best_strain;
+		info->validation_difference = state.strain - strain;
+	}
 	return 0;
 }
 
@@ -283,15 +1109,199 @@ static int _optimize(	char* name,
 extern "C" {
 #endif
 
+void default_search_options(SearchOptions* options)
+{
+	options->parallel = false;
+	options->radius = MAX_NEIGHBOURHOOD_RADIUS;
+	options->adaptive = false;
+	options->max_rounds = 40;
+	options->warm_start = false;
+	options->strategy = HILL_CLIMB;
+	options->prefilter = 0;
+	options->single_precision = false;
+	options->validate = false;
+	options->workspace = NULL;
+}
+
+SearchWorkspace* create_workspace()
+{
+	return new SearchWorkspace;
+}
+
+void destroy_workspace(SearchWorkspace* workspace)
+{
+	delete workspace;
+}
+
+uint64_t workspace_allocations(const SearchWorkspace* workspace)
+{
+	return workspace->allocations;
+}
+
+int prepare_cell(	double* B,	//lattice basis in column-vector format
+			bool search_correspondences,
+			PreparedCell* cell)
+{
+	memcpy(cell->B, B, 9 * sizeof(double));
+	cell->search_correspondences = search_correspondences;
+
+	// the reduction of a singular basis does not terminate meaningfully
+	if (determinant_3x3(B) == 0)
+		return SINGULAR_LATTICE_BASIS;
+
+	int ret = initialize_lattice_basis(B, search_correspondences, cell->R, cell->path);
+	if (ret != 0)
+		return ret;
+
+	if (!prepare_basis(cell->R, &cell->prepared))
+		return SINGULAR_LATTICE_BASIS;
+	return 0;
+}
+
+int optimize_prepared(	int type,
+			PreparedCell* cell,
+			const SearchOptions* options,
+			int* correspondence,
+			double* rotation,
+			double* symmetrized,
+			double* p_strain,
+			SearchInfo* info)
+{
+	return _optimize(type, cell, options, NULL, NULL, correspondence, rotation, symmetrized, p_strain, NULL, info);
+}
+
+int optimize_type(	int type,
+			double* B,	//lattice basis in column-vector format
+			bool search_correspondences,
+			const SearchOptions* options,
+			int* correspondence,
+			double* rotation,
+			double* symmetrized,
+			double* p_strain,
+			SearchInfo* info)
+{
+	if (type < 0 || type > 13)
+		return INVALID_BRAVAIS_TYPE;
+
+	PreparedCell cell;
+	if (type == TRICLINIC)
+	{
+		// no reduction needed
+		memcpy(cell.B, B, 9 * sizeof(double));
+	}
+	else
+	{
+		int ret = prepare_cell(B, search_correspondences, &cell);
+		if (ret != 0)
+			return ret;
+	}
+
+	return _optimize(type, &cell, options, NULL, NULL, correspondence, rotation, symmetrized, p_strain, NULL, info);
+}
+
+void default_tracking_options(TrackingOptions* options)
+{
+	options->radius = 2;
+	options->tolerance = 1E-2;
+}
+
+int optimize_tracked(	int type,
+			PreparedCell* cell,
+			const TrackingOptions* tracking,
+			TrackedSolution* tracked,
+			int* correspondence,
+			double* rotation,
+			double* symmetrized,
+			double* p_strain,
+			SearchInfo* info)
+{
+	if (type < 0 || type > 13)
+		return INVALID_BRAVAIS_TYPE;
+
+	if (type == TRICLINIC)
+		return optimize_prepared(type, cell, NULL, correspondence, rotation, symmetrized, p_strain, info);
+
+	TrackingOptions default_tracking;
+	default_tracking_options(&default_tracking);
+	if (tracking == NULL)
+		tracking = &default_tracking;
+
+	SearchInfo dummy_info;
+	if (info == NULL)
+		info = &dummy_info;
+	memset(info, 0, sizeof(SearchInfo));
+	info->verified = true;
+
+	int ret = 0;
+	double coefficients[4] = {0};
+	bool accepted = false;
+	if (tracked->valid)
+	{
+		// express the previous correspondence relative to the reduced basis
+		// of this frame, which need not be the same as that of the previous
+		// frame
+		int inverse[9], start[9];
+		unimodular_inverse_3x3i(tracked->correspondence, inverse);
+		matmul<3>(inverse, cell->path, start);
+
+		if (determinant_3x3(start) == 1 && !unimodular_too_large(start))
+		{
+			SearchOptions options;
+			default_search_options(&options);
+			options.radius = std::max(0, std::min(tracking->radius, MAX_NEIGHBOURHOOD_RADIUS));
+			options.warm_start = true;
+
+			ret = _optimize(type, cell, &options, start, tracked->coefficients,
+					correspondence, rotation, symmetrized, p_strain, coefficients, info);
+			if (ret != 0)
+				return ret;
+
+			accepted = *p_strain <= tracked->reference_strain + tracking->tolerance;
+		}
+	}
+
+	// fall back to a full search on the first frame, or if the strain has
+	// increased too much
+	if (!accepted)
+	{
+		SearchInfo full_info;
+		ret = _optimize(type, cell, NULL, NULL, NULL, correspondence, rotation, symmetrized,
+				p_strain, coefficients, &full_info);
+		if (ret != 0)
+			return ret;
+
+		info->verified = full_info.verified;
+		info->radius = full_info.radius;
+		info->rounds += full_info.rounds;
+		info->evaluated += full_info.evaluated;
+		info->stepwise_iterations += full_info.stepwise_iterations;
+		info->accelerated_steps += full_info.accelerated_steps;
+		info->newton_iterations += full_info.newton_iterations;
+		info->restarts += full_info.restarts;
+	}
+
+	// the strain is compared with that of the last full search, so that a
+	// gradual drift into a worse local minimum is also caught
+	if (!accepted)
+		tracked->reference_strain = *p_strain;
+	tracked->valid = true;
+	memcpy(tracked->correspondence, correspondence, 9 * sizeof(int));
+	memcpy(tracked->coefficients, coefficients, 4 * sizeof(double));
+	return 0;
+}
+
 int optimize(	char* name,
 		double* B,	//lattice basis in column-vector format
 		bool search_correspondences,
+		const SearchOptions* options,
 		int* correspondence,
 		double* rotation,
 		double* symmetrized,
-		double* p_strain)
+		double* p_strain,
+		SearchInfo* info)
 {
-	return _optimize(name, B, search_correspondences, correspondence, rotation, symmetrized, p_strain);
+	int type = parse_string(name);
+	return optimize_type(type, B, search_correspondences, options, correspondence, rotation, symmetrized, p_strain, info);
 }
 
 #ifdef __cplusplus
@@ -304,7 +1314,7 @@ int optimize(	char* name,
 /*
 overall procedure:
 
-	minkowski reduction
+	minkowski reduction (once per cell, shared by all Bravais types)
 
 	search over correspondences:
 
@@ -24,21 +24,136 @@ SOFTWARE.*/
 #ifndef SYMMETRIZATION_H
 #define SYMMETRIZATION_H
 
+#include <stdbool.h>
+#include <stdint.h>
+#include "mahalonobis_transform.h"
+
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+// Search strategies
+#define HILL_CLIMB	0
+#define BEST_FIRST	1
+
+// Scratch storage for the search.  Its buffers grow to the size of the largest
+// search performed, after which searches make no heap allocations.  A workspace
+// is used by one search at a time; searches which are given none use one that
+// belongs to the calling thread.
+typedef struct SearchWorkspace SearchWorkspace;
+
+SearchWorkspace* create_workspace(void);
+void destroy_workspace(SearchWorkspace* workspace);
+uint64_t workspace_allocations(const SearchWorkspace* workspace);	//heap allocations made so far
+
+// Options controlling the search over lattice correspondences
+typedef struct
+{
+	bool parallel;		//evaluate the candidates of each round on the thread pool
+	int radius;		//neighbourhood radius (squared distance from the identity)
+	bool adaptive;		//grow the neighbourhood from a small radius only when it stops improving
+	int max_rounds;		//maximum number of improving rounds, or of expansions for best-first
+	bool warm_start;	//start each candidate from the solution of the correspondence it neighbours
+	int strategy;		//HILL_CLIMB or BEST_FIRST
+	int prefilter;		//if positive, end each round after this many consecutive candidates fail to improve
+	bool single_precision;	//screen the candidates in single precision and re-optimize the result in double
+	bool validate;		//with single_precision, also run the double-precision search for comparison
+	SearchWorkspace* workspace;	//scratch storage, NULL for that of the calling thread
+} SearchOptions;
+
+void default_search_options(SearchOptions* options);
+
+// Information about a completed search
+typedef struct
+{
+	int radius;		//neighbourhood radius in the round which found the result
+	int rounds;		//number of rounds performed
+	int evaluated;		//number of candidate correspondences optimized
+	int stepwise_iterations;	//total stepwise iterations (angle evaluations for two-coefficient types) over all candidates
+	int accelerated_steps;		//stepwise iterations which were Anderson-accelerated
+	int newton_iterations;		//total SQP steps over all candidates
+	int restarts;		//warm starts which stalled and were repeated from a cold start
+	bool verified;		//whether the prefilter skipped no candidate which the exhaustive search optimizes
+	double validation_difference;	//strain minus that of the double-precision search, if validated
+} SearchInfo;
+
+// Per-cell state shared by the searches for each Bravais type
+typedef struct
+{
+	double B[9];		//input lattice basis in column-vector format
+	double R[9];		//reduced lattice basis
+	int path[9];		//reduction path
+	bool search_correspondences;
+	PreparedBasis prepared;
+} PreparedCell;
+
+int prepare_cell(	double* B,	//lattice basis in column-vector format
+			bool search_correspondences,
+			PreparedCell* cell);
+
+int optimize_prepared(	int type,
+			PreparedCell* cell,
+			const SearchOptions* options,	//NULL for defaults
+			int* correspondence,
+			double* rotation,
+			double* symmetrized,
+			double* p_strain,
+			SearchInfo* info);	//may be NULL
+
 int optimize(	char* name,
 		double* B,	//lattice basis in column-vector format
 		bool search_correspondences,
+		const SearchOptions* options,	//NULL for defaults
 		int* correspondence,
 		double* rotation,
 		double* symmetrized,
-		double* p_strain);
+		double* p_strain,
+		SearchInfo* info);	//may be NULL
+
+int optimize_type(	int type,
+			double* B,	//lattice basis in column-vector format
+			bool search_correspondences,
+			const SearchOptions* options,	//NULL for defaults
+			int* correspondence,
+			double* rotation,
+			double* symmetrized,
+			double* p_strain,
+			SearchInfo* info);	//may be NULL
+
+// Options for tracking solutions along a trajectory
+typedef struct
+{
+	int radius;		//neighbourhood radius searched around the previous solution
+	double tolerance;	//increase in strain over the last full search which triggers another
+} TrackingOptions;
+
+void default_tracking_options(TrackingOptions* options);
+
+// Solution for a single Bravais type, carried from one frame to the next
+typedef struct
+{
+	bool valid;		//false before the first frame
+	int correspondence[9];
+	double coefficients[4];	//template coefficients
+	double reference_strain;	//strain found by the last full search
+} TrackedSolution;
+
+// Like optimize_prepared, but starts the search from the solution of the
+// previous frame and updates it.  A full search is performed on the first
+// frame and whenever the tracked strain exceeds that of the last full search
+// by more than the tolerance.
+int optimize_tracked(	int type,
+			PreparedCell* cell,
+			const TrackingOptions* tracking,	//NULL for defaults
+			TrackedSolution* tracked,
+			int* correspondence,
+			double* rotation,
+			double* symmetrized,
+			double* p_strain,
+			SearchInfo* info);	//may be NULL
 
 #ifdef __cplusplus
 }
 #endif
 
 #endif
-
@@ -0,0 +1,131 @@
+/*MIT License
+
+Copyright (c) 2019 P. M. Larsen
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.*/
+
+#include <cstring>
+#include <cmath>
+#include "constants.h"
+#include "templates.h"
+#include "matrix_vector.h"
+#include "template_symmetry.h"
+
+
+static void template_combination(int n, double* T, double* M)
+{
+	// a generic combination M = sum_j x_j T_j, which is invertible for all templates
+	memset(M, 0, 9 * sizeof(double));
+	for (int j=0;j<n;j++)
+		for (int k=0;k<9;k++)
+			M[k] += T[j * 9 + k] / (j + 1);
+}
+
+static bool is_symmetry(int n, double* T, double* M, double* Minv, int* S)
+{
+	// the only candidate rotation is Q = M S M^{-1}
+	double MS[9], Q[9];
+	matmul<3>(M, S, MS);
+	matmul<3>(MS, Minv, Q);
+
+	const double tolerance = 1E-9;
+
+	// Q must be orthogonal
+	for (int i=0;i<3;i++)
+	{
+		for (int k=0;k<3;k++)
+		{
+			double dot = 0;
+			for (int l=0;l<3;l++)
+				dot += Q[i * 3 + l] * Q[k * 3 + l];
+			if (fabs(dot - (i == k ? 1 : 0)) > tolerance)
+				return false;
+		}
+	}
+
+	// and map every template matrix
+	for (int j=0;j<n;j++)
+	{
+		double TS[9], QT[9];
+		matmul<3>(&T[j * 9], S, TS);
+		matmul<3>(Q, &T[j * 9], QT);
+		for (int k=0;k<9;k++)
+			if (fabs(TS[k] - QT[k]) > tolerance)
+				return false;
+	}
+
+	return true;
+}
+
+static void find_symmetries(int type, TemplateSymmetry* symmetry)
+{
+	int identity[9] = {1, 0, 0, 0, 1, 0, 0, 0, 1};
+	symmetry->num_symmetries = 1;
+	memcpy(symmetry->S[0], identity, 9 * sizeof(int));
+	if (type == TRICLINIC)
+		return;
+
+	const int n = template_sizes[type];
+	double* T = (double*)templates[type];
+
+	double M[9], Minv[9];
+	template_combination(n, T, M);
+	inverse_3x3(M, Minv);
+
+	// the holohedries of the Bravais lattices consist of matrices with entries
+	// in {-1, 0, 1} when expressed in the template bases
+	for (int code=0;code<19683;code++)
+	{
+		int S[9];
+		int c = code;
+		for (int k=0;k<9;k++)
+		{
+			S[k] = c % 3 - 1;
+			c /= 3;
+		}
+
+		int det =	  S[0] * (S[4] * S[8] - S[5] * S[7])
+				- S[1] * (S[3] * S[8] - S[5] * S[6])
+				+ S[2] * (S[3] * S[7] - S[4] * S[6]);
+		if (det != 1 || memcmp(S, identity, 9 * sizeof(int)) == 0)
+			continue;
+
+		if (symmetry->num_symmetries < MAX_TEMPLATE_SYMMETRIES && is_symmetry(n, T, M, Minv, S))
+			memcpy(symmetry->S[symmetry->num_symmetries++], S, 9 * sizeof(int));
+	}
+}
+
+namespace {
+struct SymmetryTable
+{
+	TemplateSymmetry types[NUM_BRAVAIS_TYPES];
+
+	SymmetryTable()
+	{
+		for (int type=0;type<NUM_BRAVAIS_TYPES;type++)
+			find_symmetries(type, &types[type]);
+	}
+};
+}
+
+const TemplateSymmetry* template_symmetry(int type)
+{
+	static const SymmetryTable table;
+	return &table.types[type];
+}
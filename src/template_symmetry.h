@@ -0,0 +1,42 @@
+/*MIT License
+
+Copyright (c) 2019 P. M. Larsen
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.*/
+
+#ifndef TEMPLATE_SYMMETRY_H
+#define TEMPLATE_SYMMETRY_H
+
+#include <stdint.h>
+
+#define MAX_TEMPLATE_SYMMETRIES 24
+
+// Rotational symmetries of a Bravais template, as unimodular matrices S which
+// satisfy T_j S = Q T_j for every template matrix T_j and a common rotation Q.
+// Correspondences L and S L yield the same lattices up to rotation, and hence
+// the same strain.
+typedef struct
+{
+	int num_symmetries;
+	int S[MAX_TEMPLATE_SYMMETRIES][9];
+} TemplateSymmetry;
+
+const TemplateSymmetry* template_symmetry(int type);
+
+#endif
@@ -205,7 +205,7 @@ const double template_fcc[][3][3] =
 
 const int template_sizes[14] = {0, 4, 4, 3, 3, 3, 3, 2, 2, 2, 2, 1, 1, 1};
 
-const double* templates[14] = {
+const double* const templates[14] = {
 	NULL,
 	template_monoclinic[0][0],
 	template_basemonoclinic[0][0],
@@ -0,0 +1,314 @@
+/*MIT License
+
+Copyright (c) 2019 P. M. Larsen
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.*/
+
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <vector>
+#include <stdint.h>
+#ifdef _WIN32
+#include <process.h>
+#define getpid _getpid
+typedef int pid_t;
+#else
+#include <unistd.h>
+#endif
+#include "thread_pool.h"
+
+
+// Each participant owns a range of item indices [begin, end), packed into a
+// single word.  The owner pops items from the front and idle participants
+// steal the back half, both with a single compare-and-swap.
+struct WorkRange
+{
+	std::atomic<uint64_t> range;
+	char padding[64 - sizeof(std::atomic<uint64_t>)];
+};
+
+static uint64_t pack_range(uint32_t begin, uint32_t end)
+{
+	return ((uint64_t)begin << 32) | end;
+}
+
+static bool pop_front(WorkRange* w, uint32_t* index)
+{
+	uint64_t cur = w->range.load();
+	while (true)
+	{
+		uint32_t begin = cur >> 32, end = (uint32_t)cur;
+		if (begin >= end)
+			return false;
+
+		if (w->range.compare_exchange_weak(cur, pack_range(begin + 1, end)))
+		{
+			*index = begin;
+			return true;
+		}
+	}
+}
+
+static bool steal_back(WorkRange* w, uint32_t* p_begin, uint32_t* p_end)
+{
+	uint64_t cur = w->range.load();
+	while (true)
+	{
+		uint32_t begin = cur >> 32, end = (uint32_t)cur;
+		if (begin >= end)
+			return false;
+
+		uint32_t split = end - (end - begin + 1) / 2;
+		if (w->range.compare_exchange_weak(cur, pack_range(begin, split)))
+		{
+			*p_begin = split;
+			*p_end = end;
+			return true;
+		}
+	}
+}
+
+struct Job
+{
+	void (*func)(int, void*);
+	void* context;
+	int num_participants;
+	WorkRange* ranges;
+};
+
+static void participate(Job* job, int id)
+{
+	WorkRange* own = &job->ranges[id];
+	while (true)
+	{
+		uint32_t index;
+		while (pop_front(own, &index))
+			job->func((int)index, job->context);
+
+		bool stolen = false;
+		for (int k=1;k<job->num_participants && !stolen;k++)
+		{
+			uint32_t begin, end;
+			int victim = (id + k) % job->num_participants;
+			if (steal_back(&job->ranges[victim], &begin, &end))
+			{
+				own->range.store(pack_range(begin, end));
+				stolen = true;
+			}
+		}
+
+		if (!stolen)
+			return;
+	}
+}
+
+static thread_local bool in_parallel_region = false;
+
+class ThreadPool
+{
+public:
+	ThreadPool()
+	{
+		unsigned int n = std::thread::hardware_concurrency();
+		num_threads = n == 0 ? 1 : (int)n;
+		job = NULL;
+		generation = 0;
+		active = 0;
+		stop = false;
+		owner = 0;
+		ranges = NULL;
+	}
+
+	~ThreadPool()
+	{
+		shutdown();
+		delete[] ranges;
+	}
+
+	void set_num_threads(int n)
+	{
+		std::lock_guard<std::mutex> job_lock(job_mutex);
+		shutdown();
+		num_threads = n < 1 ? 1 : n;
+	}
+
+	int get_num_threads()
+	{
+		return num_threads.load();
+	}
+
+	int width()
+	{
+		return in_parallel_region ? 1 : num_threads.load();
+	}
+
+	void run(int n, void (*func)(int, void*), void* context)
+	{
+		if (n <= 1 || num_threads.load() <= 1 || in_parallel_region || !job_mutex.try_lock())
+		{
+			for (int i=0;i<n;i++)
+				func(i, context);
+			return;
+		}
+
+		try {
+			start_workers();
+		}
+		catch (...) {
+			// the caller reports the failure; the pool stays usable
+			job_mutex.unlock();
+			throw;
+		}
+
+		int num_participants = (int)workers.size() + 1;
+		for (int i=0;i<num_participants;i++)
+		{
+			uint32_t begin = (uint32_t)((int64_t)n * i / num_participants);
+			uint32_t end = (uint32_t)((int64_t)n * (i + 1) / num_participants);
+			ranges[i].range.store(pack_range(begin, end));
+		}
+
+		Job j = {func, context, num_participants, ranges};
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			job = &j;
+			generation++;
+		}
+		wake.notify_all();
+
+		in_parallel_region = true;
+		participate(&j, 0);
+		in_parallel_region = false;
+
+		{
+			// workers that have not picked up the job by now are not needed
+			std::unique_lock<std::mutex> lock(mutex);
+			job = NULL;
+			done.wait(lock, [this]{ return active == 0; });
+		}
+		job_mutex.unlock();
+	}
+
+private:
+	void start_workers()
+	{
+		if (owner != 0 && owner != getpid())
+		{
+			// After fork() only the forking thread exists in the child,
+			// so the parent's workers (and their locks) are abandoned.
+			new (&workers) std::vector<std::thread>();
+			new (&mutex) std::mutex();
+			new (&wake) std::condition_variable();
+			new (&done) std::condition_variable();
+			active = 0;
+		}
+
+		if ((int)workers.size() == num_threads - 1)
+			return;
+
+		owner = getpid();
+		stop = false;
+		WorkRange* new_ranges = new WorkRange[num_threads];
+		delete[] ranges;
+		ranges = new_ranges;
+		workers.reserve(num_threads - 1);
+		for (int i=(int)workers.size()+1;i<num_threads;i++)
+			workers.push_back(std::thread(&ThreadPool::worker_main, this, i));
+	}
+
+	void shutdown()
+	{
+		if (owner != getpid())
+			return;
+
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			stop = true;
+		}
+		wake.notify_all();
+
+		for (size_t i=0;i<workers.size();i++)
+			workers[i].join();
+		workers.clear();
+	}
+
+	void worker_main(int id)
+	{
+		in_parallel_region = true;
+
+		std::unique_lock<std::mutex> lock(mutex);
+		uint64_t seen = generation;
+		while (true)
+		{
+			wake.wait(lock, [&]{ return stop || (job != NULL && generation != seen); });
+			if (stop)
+				return;
+
+			seen = generation;
+			Job* j = job;
+			active++;
+			lock.unlock();
+
+			participate(j, id);
+
+			lock.lock();
+			if (--active == 0)
+				done.notify_all();
+		}
+	}
+
+	std::atomic<int> num_threads;		//written under job_mutex, read without it
+	std::vector<std::thread> workers;
+	std::mutex job_mutex;		//held while a job is running
+	std::mutex mutex;		//protects the fields below
+	std::condition_variable wake;
+	std::condition_variable done;
+	Job* job;
+	uint64_t generation;
+	int active;
+	bool stop;
+	pid_t owner;
+	WorkRange* ranges;		//one per participant
+};
+
+static ThreadPool pool;
+
+void set_num_threads(int num_threads)
+{
+	pool.set_num_threads(num_threads);
+}
+
+int get_num_threads()
+{
+	return pool.get_num_threads();
+}
+
+int parallel_width()
+{
+	return pool.width();
+}
+
+void parallel_for(int n, void (*func)(int index, void* context), void* context)
+{
+	pool.run(n, func, context);
+}
@@ -0,0 +1,193 @@
+/*MIT License
+
+Copyright (c) 2019 P. M. Larsen
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.*/
+
+
+#include <cmath>
+#include "matrix_vector.h"
+#include "polar_decomposition.h"
+#include "two_coefficient_solver.h"
+
+
+// For two template coefficients on the unit circle, x = (cos t, sin t), the
+// objective is f(t) = tr(P(t)), where M(t) = cos(t) K1 + sin(t) K2 = Q(t) P(t)
+// is a polar decomposition.  Since Q(t) maximizes tr(Q^T M(t)), the first
+// derivative is f' = tr(Q^T M').  Writing Q' = Q W for a skew-symmetric W
+// with axial vector w, and A = Q^T M', the derivative of Q P = M gives
+// (tr(P) I - P) w = a, where a is the axial vector of A - A^T, and the second
+// derivative is f'' = -f + a.w.  Both derivatives therefore follow from a
+// single polar decomposition.
+
+typedef struct
+{
+	double t;
+	double f;		//objective
+	double d;		//first derivative of the objective
+	double h;		//second derivative of the objective
+	double stepwise;	//angle to the stepwise update
+	double Q[9];
+	double P[9];
+} AnglePoint;
+
+static void evaluate(double t, double* Ktrans, AnglePoint* point)
+{
+	double c = cos(t), s = sin(t);
+	double M[9], dM[9];
+	for (int j=0;j<9;j++)
+	{
+		M[j] = c * Ktrans[j] + s * Ktrans[9 + j];
+		dM[j] = -s * Ktrans[j] + c * Ktrans[9 + j];
+	}
+
+	double* Q = point->Q;
+	double* P = point->P;
+	polar_decomposition_3x3(M, true, Q, P);
+
+	double g[2] = {0, 0};
+	for (int i=0;i<2;i++)
+		for (int j=0;j<9;j++)
+			g[i] += Q[j] * Ktrans[i * 9 + j];
+
+	// A = Q^T M'
+	double A[9] = {0};
+	for (int i=0;i<3;i++)
+		for (int j=0;j<3;j++)
+			for (int k=0;k<3;k++)
+				A[i * 3 + j] += Q[k * 3 + i] * dM[k * 3 + j];
+
+	double a[3] = {A[7] - A[5], A[2] - A[6], A[3] - A[1]};
+	double trace = P[0] + P[4] + P[8];
+
+	// solve (tr(P) I - P) w = a by Cramer's rule
+	double G[9];
+	for (int i=0;i<9;i++)
+		G[i] = -P[i];
+	G[0] += trace;
+	G[4] += trace;
+	G[8] += trace;
+
+	double adj[9];
+	adjugate_3x3(G, adj);
+	double det = G[0] * adj[0] + G[1] * adj[3] + G[2] * adj[6];
+
+	double aw = 0;
+	for (int i=0;i<3;i++)
+		for (int j=0;j<3;j++)
+			aw += a[i] * adj[i * 3 + j] * a[j];
+
+	// g is parallel to x at a stationary point, and x.g = f > 0
+	point->t = t;
+	point->f = trace;
+	point->d = A[0] + A[4] + A[8];
+	point->h = det > 0 ? -trace + aw / det : INFINITY;
+	point->stepwise = atan((c * g[1] - s * g[0]) / (c * g[0] + s * g[1]));
+}
+
+bool optimize_two_coefficients(double* x, double* Ktrans, double* Q, double* P, int max_it, int* p_iterations)
+{
+	const double tolerance = 1E-11;
+	const double newton_tolerance = 2E-5;	//error after a Newton step is below 0.2 step^2
+	const double max_step = 1.5707963267948966;	//pi / 2, the objective has period pi
+
+	// The search moves uphill from the initial guess until the derivative
+	// changes sign, which brackets a maximum, and then locates the maximum
+	// with Newton steps, safeguarded by bisection.  A stepwise iteration is
+	// used for the first step, and to extend the bracket where the curvature
+	// does not give a useful step.
+	AnglePoint current, next;
+	evaluate(atan2(x[1], x[0]), Ktrans, &current);
+
+	double lo = current.t, hi = current.t;		//d(lo) > 0 > d(hi) once bracketed
+	bool bracketed = false;
+	double previous = 0;
+	int it = 1;
+	bool converged = false;
+	while (it < max_it)
+	{
+		if (fabs(current.stepwise) < tolerance || (bracketed && fabs(hi - lo) < tolerance))
+		{
+			converged = true;
+			break;
+		}
+
+		double newton = current.h < 0 ? -current.d / current.h : INFINITY;
+		double step;
+		bool is_newton = false;
+		if (!bracketed)
+		{
+			// never less than the stepwise step, and growing geometrically
+			// where the objective is convex
+			step = current.stepwise;
+			if (fabs(newton) > fabs(step) && fabs(newton) < max_step)
+			{
+				step = newton;
+				is_newton = true;
+			}
+			else if (current.h >= 0 && fabs(2 * previous) > fabs(step) && previous * step > 0)
+			{
+				step = 2 * previous;
+			}
+		}
+		else
+		{
+			double target = current.t + newton;
+			is_newton = fabs(newton) < max_step && (target - lo) * (target - hi) < 0;
+			step = is_newton ? newton : (lo + hi) / 2 - current.t;
+		}
+
+		evaluate(current.t + step, Ktrans, &next);
+		it++;
+		previous = step;
+
+		if (!bracketed && next.d * current.d <= 0)
+		{
+			bracketed = true;
+			lo = current.d > 0 ? current.t : next.t;
+			hi = current.d > 0 ? next.t : current.t;
+		}
+		else if (bracketed)
+		{
+			if (next.d > 0)
+				lo = next.t;
+			else
+				hi = next.t;
+		}
+		current = next;
+
+		// the error after a short Newton step is of the order of its square
+		if (is_newton && fabs(step) < newton_tolerance)
+		{
+			converged = true;
+			break;
+		}
+	}
+
+	x[0] = cos(current.t);
+	x[1] = sin(current.t);
+	for (int i=0;i<9;i++)
+	{
+		Q[i] = current.Q[i];
+		P[i] = current.P[i];
+	}
+
+	*p_iterations = it;
+	return converged;
+}
@@ -25,23 +25,6 @@ SOFTWARE.*/
 #include <cstdlib>
 
 
-static uint64_t ipow(uint64_t base, int exp)
-{
-	uint64_t result = 1;
-	for (;;)
-	{
-		if (exp & 1)
-			result *= base;
-		exp >>= 1;
-
-		if (!exp)
-			break;
-		base *= base;
-	}
-
-	return result;
-}
-
 bool unimodular_too_large(int* L)
 {
 	for (int i=0;i<9;i++)
@@ -50,20 +33,26 @@ bool unimodular_too_large(int* L)
 	return false;
 }
 
+uint64_t unimodular_hash_weight(int i)
+{
+	uint64_t w = 1;
+	for (int k=i;k<8;k++)
+		w *= 137;
+	return w;
+}
+
 uint64_t unimodular_hash(int* L)
 {
 	//absolute values must be less than or equal to 68
-	//log2(sum([137**i for i in range(1, 10)])) = 63.892857988354926
-	//this fits in 64 bits
+	//the entries are digits of a base-137 number, which is unique and fits in
+	//64 bits: log2(137**9) = 63.88
+	//
+	//the hash is the linear function sum_i w_i (L[i] + 68), with weights
+	//w_i = 137**(8 - i), which allows it to be updated incrementally
 
 	uint64_t hash = 0;
 	for (int i=0;i<9;i++)
-	{
-		uint64_t base = L[i] + 68;
-		uint64_t r = ipow(base, i + 1);
-		hash += r;
-	}
+		hash = 137 * hash + (uint64_t)(L[i] + 68);
 
 	return hash;
 }
-
@@ -29,6 +29,7 @@ SOFTWARE.*/
 
 bool unimodular_too_large(int* L);
 uint64_t unimodular_hash(int* L);
+uint64_t unimodular_hash_weight(int i);
 
 #endif
 
@@ -0,0 +1,120 @@
+/*MIT License
+
+Copyright (c) 2019 P. M. Larsen
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.*/
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+#include "unimodular_neighbourhood.h"
+
+
+namespace {
+struct Neighbour
+{
+	int distance;
+	int8_t N[9];
+
+	bool operator<(const Neighbour& other) const
+	{
+		if (distance != other.distance)
+			return distance < other.distance;
+		return std::lexicographical_compare(N, N + 9, other.N, other.N + 9);
+	}
+};
+
+struct Neighbourhood
+{
+	std::vector<Neighbour> neighbours;
+	std::vector<int8_t> table;
+	std::vector<int8_t> columns;
+	int sizes[MAX_NEIGHBOURHOOD_RADIUS + 1];
+
+	Neighbourhood()
+	{
+		for (int code=0;code<19683;code++)
+		{
+			Neighbour n;
+			int c = code;
+			for (int k=8;k>=0;k--)
+			{
+				n.N[k] = c % 3 - 1;
+				c /= 3;
+			}
+
+			int8_t* N = n.N;
+			int det =	  N[0] * (N[4] * N[8] - N[5] * N[7])
+					- N[1] * (N[3] * N[8] - N[5] * N[6])
+					+ N[2] * (N[3] * N[7] - N[4] * N[6]);
+			if (det != 1)
+				continue;
+
+			n.distance = 0;
+			for (int k=0;k<9;k++)
+			{
+				int d = N[k] - (k % 4 == 0 ? 1 : 0);
+				n.distance += d * d;
+			}
+			neighbours.push_back(n);
+		}
+
+		std::sort(neighbours.begin(), neighbours.end());
+
+		size_t count = neighbours.size();
+		table.resize(9 * count);
+		columns.resize(9 * count);
+		for (size_t i=0;i<count;i++)
+		{
+			memcpy(&table[9 * i], neighbours[i].N, 9 * sizeof(int8_t));
+			for (int k=0;k<9;k++)
+				columns[k * count + i] = neighbours[i].N[k];
+		}
+
+		for (int r=0;r<=MAX_NEIGHBOURHOOD_RADIUS;r++)
+		{
+			sizes[r] = 0;
+			while (sizes[r] < (int)neighbours.size() && neighbours[sizes[r]].distance <= r)
+				sizes[r]++;
+		}
+	}
+};
+
+const Neighbourhood& get_neighbourhood()
+{
+	static const Neighbourhood neighbourhood;
+	return neighbourhood;
+}
+}
+
+const int8_t (*unimodular_neighbourhood())[9]
+{
+	return (const int8_t (*)[9])get_neighbourhood().table.data();
+}
+
+const int8_t* unimodular_neighbourhood_columns()
+{
+	return get_neighbourhood().columns.data();
+}
+
+int unimodular_neighbourhood_size(int radius)
+{
+	radius = std::max(0, std::min(radius, MAX_NEIGHBOURHOOD_RADIUS));
+	return get_neighbourhood().sizes[radius];
+}
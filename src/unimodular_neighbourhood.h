@@ -20,3494 +20,25 @@ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
 OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 SOFTWARE.*/
 
-
 #ifndef UNIMODULAR_NEIGHBOURHOOD_H
 #define UNIMODULAR_NEIGHBOURHOOD_H
 
-#define NUM_UNIMODULAR_NEIGHBOURS 3480
+#include <stdint.h>
 
-int8_t unimodular_neighborhood[NUM_UNIMODULAR_NEIGHBOURS][9] = {
-{ 1, 0, 0, 0, 1, 0, 0, 0, 1},
-{ 1,-1, 0, 0, 1, 0, 0, 0, 1},
-{ 1, 0,-1, 0, 1, 0, 0, 0, 1},
-{ 1, 0, 0,-1, 1, 0, 0, 0, 1},
-{ 1, 0, 0, 0, 1,-1, 0, 0, 1},
-{ 1, 0, 0, 0, 1, 0,-1, 0, 1},
-{ 1, 0, 0, 0, 1, 0, 0,-1, 1},
-{ 1, 0, 0, 0, 1, 0, 0, 1, 1},
-{ 1, 0, 0, 0, 1, 0, 1, 0, 1},
-{ 1, 0, 0, 0, 1, 1, 0, 0, 1},
-{ 1, 0, 0, 1, 1, 0, 0, 0, 1},
-{ 1, 0, 1, 0, 1, 0, 0, 0, 1},
-{ 1, 1, 0, 0, 1, 0, 0, 0, 1},
-{ 1,-1,-1, 0, 1, 0, 0, 0, 1},
-{ 1,-1, 0, 0, 1,-1, 0, 0, 1},
-{ 1,-1, 0, 0, 1, 0,-1, 0, 1},
-{ 1,-1, 0, 0, 1, 0, 0,-1, 1},
-{ 1,-1, 0, 0, 1, 0, 0, 1, 1},
-{ 1,-1, 0, 0, 1, 0, 1, 0, 1},
-{ 1,-1, 0, 0, 1, 1, 0, 0, 1},
-{ 1,-1, 1, 0, 1, 0, 0, 0, 1},
-{ 1, 0,-1,-1, 1, 0, 0, 0, 1},
-{ 1, 0,-1, 0, 1,-1, 0, 0, 1},
-{ 1, 0,-1, 0, 1, 0, 0,-1, 1},
-{ 1, 0,-1, 0, 1, 0, 0, 1, 1},
-{ 1, 0,-1, 0, 1, 1, 0, 0, 1},
-{ 1, 0,-1, 1, 1, 0, 0, 0, 1},
-{ 1, 0, 0,-1, 1,-1, 0, 0, 1},
-{ 1, 0, 0,-1, 1, 0,-1, 0, 1},
-{ 1, 0, 0,-1, 1, 0, 0,-1, 1},
-{ 1, 0, 0,-1, 1, 0, 0, 1, 1},
-{ 1, 0, 0,-1, 1, 0, 1, 0, 1},
-{ 1, 0, 0,-1, 1, 1, 0, 0, 1},
-{ 1, 0, 0, 0, 1,-1,-1, 0, 1},
-{ 1, 0, 0, 0, 1,-1, 1, 0, 1},
-{ 1, 0, 0, 0, 1, 0,-1,-1, 1},
-{ 1, 0, 0, 0, 1, 0,-1, 1, 1},
-{ 1, 0, 0, 0, 1, 0, 1,-1, 1},
-{ 1, 0, 0, 0, 1, 0, 1, 1, 1},
-{ 1, 0, 0, 0, 1, 1,-1, 0, 1},
-{ 1, 0, 0, 0, 1, 1, 1, 0, 1},
-{ 1, 0, 0, 1, 1,-1, 0, 0, 1},
-{ 1, 0, 0, 1, 1, 0,-1, 0, 1},
-{ 1, 0, 0, 1, 1, 0, 0,-1, 1},
-{ 1, 0, 0, 1, 1, 0, 0, 1, 1},
-{ 1, 0, 0, 1, 1, 0, 1, 0, 1},
-{ 1, 0, 0, 1, 1, 1, 0, 0, 1},
-{ 1, 0, 1,-1, 1, 0, 0, 0, 1},
-{ 1, 0, 1, 0, 1,-1, 0, 0, 1},
-{ 1, 0, 1, 0, 1, 0, 0,-1, 1},
-{ 1, 0, 1, 0, 1, 0, 0, 1, 1},
-{ 1, 0, 1, 0, 1, 1, 0, 0, 1},
-{ 1, 0, 1, 1, 1, 0, 0, 0, 1},
-{ 1, 1,-1, 0, 1, 0, 0, 0, 1},
-{ 1, 1, 0, 0, 1,-1, 0, 0, 1},
-{ 1, 1, 0, 0, 1, 0,-1, 0, 1},
-{ 1, 1, 0, 0, 1, 0, 0,-1, 1},
-{ 1, 1, 0, 0, 1, 0, 0, 1, 1},
-{ 1, 1, 0, 0, 1, 0, 1, 0, 1},
-{ 1, 1, 0, 0, 1, 1, 0, 0, 1},
-{ 1, 1, 1, 0, 1, 0, 0, 0, 1},
-{ 0,-1, 0, 1, 1, 0, 0, 0, 1},
-{ 0, 0,-1, 0, 1, 0, 1, 0, 1},
-{ 0, 0, 1, 0, 1, 0,-1, 0, 1},
-{ 0, 1, 0,-1, 1, 0, 0, 0, 1},
-{ 1,-1,-1, 0, 1,-1, 0, 0, 1},
-{ 1,-1,-1, 0, 1, 0, 0,-1, 1},
-{ 1,-1,-1, 0, 1, 0, 0, 1, 1},
-{ 1,-1,-1, 0, 1, 1, 0, 0, 1},
-{ 1,-1, 0, 0, 1, 0,-1,-1, 1},
-{ 1,-1, 0, 0, 1, 0,-1, 1, 1},
-{ 1,-1, 0, 0, 1, 0, 1,-1, 1},
-{ 1,-1, 0, 0, 1, 0, 1, 1, 1},
-{ 1,-1, 0, 1, 0, 0, 0, 0, 1},
-{ 1,-1, 1, 0, 1,-1, 0, 0, 1},
-{ 1,-1, 1, 0, 1, 0, 0,-1, 1},
-{ 1,-1, 1, 0, 1, 0, 0, 1, 1},
-{ 1,-1, 1, 0, 1, 1, 0, 0, 1},
-{ 1, 0,-1,-1, 1,-1, 0, 0, 1},
-{ 1, 0,-1,-1, 1, 1, 0, 0, 1},
-{ 1, 0,-1, 0, 1, 0, 1, 0, 0},
-{ 1, 0,-1, 1, 1,-1, 0, 0, 1},
-{ 1, 0,-1, 1, 1, 1, 0, 0, 1},
-{ 1, 0, 0,-1, 1,-1,-1, 0, 1},
-{ 1, 0, 0,-1, 1,-1, 1, 0, 1},
-{ 1, 0, 0,-1, 1, 0,-1,-1, 1},
-{ 1, 0, 0,-1, 1, 0,-1, 1, 1},
-{ 1, 0, 0,-1, 1, 0, 1,-1, 1},
-{ 1, 0, 0,-1, 1, 0, 1, 1, 1},
-{ 1, 0, 0,-1, 1, 1,-1, 0, 1},
-{ 1, 0, 0,-1, 1, 1, 1, 0, 1},
-{ 1, 0, 0, 0, 0,-1, 0, 1, 1},
-{ 1, 0, 0, 0, 0, 1, 0,-1, 1},
-{ 1, 0, 0, 0, 1,-1, 0, 1, 0},
-{ 1, 0, 0, 0, 1, 1, 0,-1, 0},
-{ 1, 0, 0, 1, 1,-1,-1, 0, 1},
-{ 1, 0, 0, 1, 1,-1, 1, 0, 1},
-{ 1, 0, 0, 1, 1, 0,-1,-1, 1},
-{ 1, 0, 0, 1, 1, 0,-1, 1, 1},
-{ 1, 0, 0, 1, 1, 0, 1,-1, 1},
-{ 1, 0, 0, 1, 1, 0, 1, 1, 1},
-{ 1, 0, 0, 1, 1, 1,-1, 0, 1},
-{ 1, 0, 0, 1, 1, 1, 1, 0, 1},
-{ 1, 0, 1,-1, 1,-1, 0, 0, 1},
-{ 1, 0, 1,-1, 1, 1, 0, 0, 1},
-{ 1, 0, 1, 0, 1, 0,-1, 0, 0},
-{ 1, 0, 1, 1, 1,-1, 0, 0, 1},
-{ 1, 0, 1, 1, 1, 1, 0, 0, 1},
-{ 1, 1,-1, 0, 1,-1, 0, 0, 1},
-{ 1, 1,-1, 0, 1, 0, 0,-1, 1},
-{ 1, 1,-1, 0, 1, 0, 0, 1, 1},
-{ 1, 1,-1, 0, 1, 1, 0, 0, 1},
-{ 1, 1, 0,-1, 0, 0, 0, 0, 1},
-{ 1, 1, 0, 0, 1, 0,-1,-1, 1},
-{ 1, 1, 0, 0, 1, 0,-1, 1, 1},
-{ 1, 1, 0, 0, 1, 0, 1,-1, 1},
-{ 1, 1, 0, 0, 1, 0, 1, 1, 1},
-{ 1, 1, 1, 0, 1,-1, 0, 0, 1},
-{ 1, 1, 1, 0, 1, 0, 0,-1, 1},
-{ 1, 1, 1, 0, 1, 0, 0, 1, 1},
-{ 1, 1, 1, 0, 1, 1, 0, 0, 1},
-{ 0,-1,-1, 0, 1, 0, 1, 0, 1},
-{ 0,-1,-1, 1, 1, 0, 0, 0, 1},
-{ 0,-1, 0, 0, 1,-1, 1, 0, 1},
-{ 0,-1, 0, 0, 1, 1,-1, 0, 1},
-{ 0,-1, 0, 1, 0, 0, 0, 0, 1},
-{ 0,-1, 0, 1, 1,-1, 0, 0, 1},
-{ 0,-1, 0, 1, 1, 0,-1, 0, 1},
-{ 0,-1, 0, 1, 1, 0, 0,-1, 1},
-{ 0,-1, 0, 1, 1, 0, 0, 1, 1},
-{ 0,-1, 0, 1, 1, 0, 1, 0, 1},
-{ 0,-1, 0, 1, 1, 1, 0, 0, 1},
-{ 0,-1, 1, 0, 1, 0,-1, 0, 1},
-{ 0,-1, 1, 1, 1, 0, 0, 0, 1},
-{ 0, 0,-1,-1, 1, 0, 0, 1, 1},
-{ 0, 0,-1,-1, 1, 0, 1, 0, 1},
-{ 0, 0,-1, 0, 1,-1, 1, 0, 1},
-{ 0, 0,-1, 0, 1, 0, 1,-1, 1},
-{ 0, 0,-1, 0, 1, 0, 1, 0, 0},
-{ 0, 0,-1, 0, 1, 0, 1, 1, 1},
-{ 0, 0,-1, 0, 1, 1, 1, 0, 1},
-{ 0, 0,-1, 1, 1, 0, 0,-1, 1},
-{ 0, 0,-1, 1, 1, 0, 1, 0, 1},
-{ 0, 0, 1,-1, 1, 0,-1, 0, 1},
-{ 0, 0, 1,-1, 1, 0, 0,-1, 1},
-{ 0, 0, 1, 0, 1,-1,-1, 0, 1},
-{ 0, 0, 1, 0, 1, 0,-1,-1, 1},
-{ 0, 0, 1, 0, 1, 0,-1, 0, 0},
-{ 0, 0, 1, 0, 1, 0,-1, 1, 1},
-{ 0, 0, 1, 0, 1, 1,-1, 0, 1},
-{ 0, 0, 1, 1, 1, 0,-1, 0, 1},
-{ 0, 0, 1, 1, 1, 0, 0, 1, 1},
-{ 0, 1,-1,-1, 1, 0, 0, 0, 1},
-{ 0, 1,-1, 0, 1, 0, 1, 0, 1},
-{ 0, 1, 0,-1, 0, 0, 0, 0, 1},
-{ 0, 1, 0,-1, 1,-1, 0, 0, 1},
-{ 0, 1, 0,-1, 1, 0,-1, 0, 1},
-{ 0, 1, 0,-1, 1, 0, 0,-1, 1},
-{ 0, 1, 0,-1, 1, 0, 0, 1, 1},
-{ 0, 1, 0,-1, 1, 0, 1, 0, 1},
-{ 0, 1, 0,-1, 1, 1, 0, 0, 1},
-{ 0, 1, 0, 0, 1,-1,-1, 0, 1},
-{ 0, 1, 0, 0, 1, 1, 1, 0, 1},
-{ 0, 1, 1,-1, 1, 0, 0, 0, 1},
-{ 0, 1, 1, 0, 1, 0,-1, 0, 1},
-{ 1,-1,-1,-1, 1, 0, 0, 1, 1},
-{ 1,-1,-1,-1, 1, 0, 1, 0, 1},
-{ 1,-1,-1, 0, 1, 0, 1, 0, 0},
-{ 1,-1,-1, 0, 1, 1,-1, 0, 1},
-{ 1,-1,-1, 0, 1, 1, 1, 0, 1},
-{ 1,-1,-1, 1, 0, 0, 0, 0, 1},
-{ 1,-1,-1, 1, 1, 0,-1, 0, 1},
-{ 1,-1,-1, 1, 1, 0, 0, 1, 1},
-{ 1,-1, 0,-1, 1,-1, 0, 1, 1},
-{ 1,-1, 0,-1, 1,-1, 1, 0, 1},
-{ 1,-1, 0,-1, 1, 1,-1, 0, 1},
-{ 1,-1, 0,-1, 1, 1, 0,-1, 1},
-{ 1,-1, 0, 0, 0,-1, 0, 1, 1},
-{ 1,-1, 0, 0, 0,-1, 1, 0, 1},
-{ 1,-1, 0, 0, 0, 1,-1, 0, 1},
-{ 1,-1, 0, 0, 0, 1, 0,-1, 1},
-{ 1,-1, 0, 0, 1,-1,-1, 1, 1},
-{ 1,-1, 0, 0, 1,-1, 0, 1, 0},
-{ 1,-1, 0, 0, 1,-1, 1,-1, 1},
-{ 1,-1, 0, 0, 1,-1, 1, 0, 0},
-{ 1,-1, 0, 0, 1, 1,-1, 0, 0},
-{ 1,-1, 0, 0, 1, 1,-1, 1, 1},
-{ 1,-1, 0, 0, 1, 1, 0,-1, 0},
-{ 1,-1, 0, 0, 1, 1, 1,-1, 1},
-{ 1,-1, 0, 1, 0,-1, 0, 0, 1},
-{ 1,-1, 0, 1, 0, 0,-1, 0, 1},
-{ 1,-1, 0, 1, 0, 0, 0,-1, 1},
-{ 1,-1, 0, 1, 0, 0, 0, 1, 1},
-{ 1,-1, 0, 1, 0, 0, 1, 0, 1},
-{ 1,-1, 0, 1, 0, 1, 0, 0, 1},
-{ 1,-1, 0, 1, 1,-1,-1, 0, 1},
-{ 1,-1, 0, 1, 1,-1, 0,-1, 1},
-{ 1,-1, 0, 1, 1, 1, 0, 1, 1},
-{ 1,-1, 0, 1, 1, 1, 1, 0, 1},
-{ 1,-1, 1,-1, 1, 0,-1, 0, 1},
-{ 1,-1, 1,-1, 1, 0, 0,-1, 1},
-{ 1,-1, 1, 0, 1,-1,-1, 0, 1},
-{ 1,-1, 1, 0, 1,-1, 1, 0, 1},
-{ 1,-1, 1, 0, 1, 0,-1, 0, 0},
-{ 1,-1, 1, 1, 0, 0, 0, 0, 1},
-{ 1,-1, 1, 1, 1, 0, 0,-1, 1},
-{ 1,-1, 1, 1, 1, 0, 1, 0, 1},
-{ 1, 0,-1,-1, 0, 0, 0, 1, 1},
-{ 1, 0,-1,-1, 1, 0,-1, 1, 1},
-{ 1, 0,-1,-1, 1, 0, 0, 1, 0},
-{ 1, 0,-1,-1, 1, 0, 1,-1, 1},
-{ 1, 0,-1,-1, 1, 0, 1, 0, 0},
-{ 1, 0,-1,-1, 1, 1, 0,-1, 1},
-{ 1, 0,-1,-1, 1, 1, 0, 1, 1},
-{ 1, 0,-1, 0, 0,-1, 0, 1, 1},
-{ 1, 0,-1, 0, 0, 1, 0,-1, 1},
-{ 1, 0,-1, 0, 1,-1,-1, 1, 1},
-{ 1, 0,-1, 0, 1,-1, 0, 1, 0},
-{ 1, 0,-1, 0, 1,-1, 1,-1, 1},
-{ 1, 0,-1, 0, 1,-1, 1, 0, 0},
-{ 1, 0,-1, 0, 1, 0, 1,-1, 0},
-{ 1, 0,-1, 0, 1, 0, 1, 1, 0},
-{ 1, 0,-1, 0, 1, 1,-1,-1, 1},
-{ 1, 0,-1, 0, 1, 1, 0,-1, 0},
-{ 1, 0,-1, 0, 1, 1, 1, 0, 0},
-{ 1, 0,-1, 0, 1, 1, 1, 1, 1},
-{ 1, 0,-1, 1, 0, 0, 0,-1, 1},
-{ 1, 0,-1, 1, 1,-1, 0,-1, 1},
-{ 1, 0,-1, 1, 1,-1, 0, 1, 1},
-{ 1, 0,-1, 1, 1, 0,-1,-1, 1},
-{ 1, 0,-1, 1, 1, 0, 0,-1, 0},
-{ 1, 0,-1, 1, 1, 0, 1, 0, 0},
-{ 1, 0,-1, 1, 1, 0, 1, 1, 1},
-{ 1, 0, 0,-1, 0,-1, 0, 1, 1},
-{ 1, 0, 0,-1, 0, 1, 0,-1, 1},
-{ 1, 0, 0,-1, 1,-1, 0, 1, 0},
-{ 1, 0, 0,-1, 1, 1, 0,-1, 0},
-{ 1, 0, 0, 0, 0,-1,-1, 1, 1},
-{ 1, 0, 0, 0, 0,-1, 0, 1, 0},
-{ 1, 0, 0, 0, 0,-1, 1, 1, 1},
-{ 1, 0, 0, 0, 0, 1,-1,-1, 1},
-{ 1, 0, 0, 0, 0, 1, 0,-1, 0},
-{ 1, 0, 0, 0, 0, 1, 1,-1, 1},
-{ 1, 0, 0, 0, 1,-1,-1, 1, 0},
-{ 1, 0, 0, 0, 1,-1, 1, 1, 0},
-{ 1, 0, 0, 0, 1, 1,-1,-1, 0},
-{ 1, 0, 0, 0, 1, 1, 1,-1, 0},
-{ 1, 0, 0, 1, 0,-1, 0, 1, 1},
-{ 1, 0, 0, 1, 0, 1, 0,-1, 1},
-{ 1, 0, 0, 1, 1,-1, 0, 1, 0},
-{ 1, 0, 0, 1, 1, 1, 0,-1, 0},
-{ 1, 0, 1,-1, 0, 0, 0,-1, 1},
-{ 1, 0, 1,-1, 1,-1, 0,-1, 1},
-{ 1, 0, 1,-1, 1,-1, 0, 1, 1},
-{ 1, 0, 1,-1, 1, 0,-1, 0, 0},
-{ 1, 0, 1,-1, 1, 0,-1, 1, 1},
-{ 1, 0, 1,-1, 1, 0, 0,-1, 0},
-{ 1, 0, 1,-1, 1, 0, 1,-1, 1},
-{ 1, 0, 1, 0, 0,-1, 0, 1, 1},
-{ 1, 0, 1, 0, 0, 1, 0,-1, 1},
-{ 1, 0, 1, 0, 1,-1,-1,-1, 1},
-{ 1, 0, 1, 0, 1,-1,-1, 0, 0},
-{ 1, 0, 1, 0, 1,-1, 0, 1, 0},
-{ 1, 0, 1, 0, 1,-1, 1, 1, 1},
-{ 1, 0, 1, 0, 1, 0,-1,-1, 0},
-{ 1, 0, 1, 0, 1, 0,-1, 1, 0},
-{ 1, 0, 1, 0, 1, 1,-1, 0, 0},
-{ 1, 0, 1, 0, 1, 1,-1, 1, 1},
-{ 1, 0, 1, 0, 1, 1, 0,-1, 0},
-{ 1, 0, 1, 0, 1, 1, 1,-1, 1},
-{ 1, 0, 1, 1, 0, 0, 0, 1, 1},
-{ 1, 0, 1, 1, 1, 0,-1,-1, 1},
-{ 1, 0, 1, 1, 1, 0,-1, 0, 0},
-{ 1, 0, 1, 1, 1, 0, 0, 1, 0},
-{ 1, 0, 1, 1, 1, 0, 1, 1, 1},
-{ 1, 0, 1, 1, 1, 1, 0,-1, 1},
-{ 1, 0, 1, 1, 1, 1, 0, 1, 1},
-{ 1, 1,-1,-1, 0, 0, 0, 0, 1},
-{ 1, 1,-1,-1, 1, 0,-1, 0, 1},
-{ 1, 1,-1,-1, 1, 0, 0,-1, 1},
-{ 1, 1,-1, 0, 1,-1,-1, 0, 1},
-{ 1, 1,-1, 0, 1,-1, 1, 0, 1},
-{ 1, 1,-1, 0, 1, 0, 1, 0, 0},
-{ 1, 1,-1, 1, 1, 0, 0,-1, 1},
-{ 1, 1,-1, 1, 1, 0, 1, 0, 1},
-{ 1, 1, 0,-1, 0,-1, 0, 0, 1},
-{ 1, 1, 0,-1, 0, 0,-1, 0, 1},
-{ 1, 1, 0,-1, 0, 0, 0,-1, 1},
-{ 1, 1, 0,-1, 0, 0, 0, 1, 1},
-{ 1, 1, 0,-1, 0, 0, 1, 0, 1},
-{ 1, 1, 0,-1, 0, 1, 0, 0, 1},
-{ 1, 1, 0,-1, 1,-1, 0,-1, 1},
-{ 1, 1, 0,-1, 1,-1, 1, 0, 1},
-{ 1, 1, 0,-1, 1, 1,-1, 0, 1},
-{ 1, 1, 0,-1, 1, 1, 0, 1, 1},
-{ 1, 1, 0, 0, 0,-1,-1, 0, 1},
-{ 1, 1, 0, 0, 0,-1, 0, 1, 1},
-{ 1, 1, 0, 0, 0, 1, 0,-1, 1},
-{ 1, 1, 0, 0, 0, 1, 1, 0, 1},
-{ 1, 1, 0, 0, 1,-1,-1,-1, 1},
-{ 1, 1, 0, 0, 1,-1,-1, 0, 0},
-{ 1, 1, 0, 0, 1,-1, 0, 1, 0},
-{ 1, 1, 0, 0, 1,-1, 1, 1, 1},
-{ 1, 1, 0, 0, 1, 1,-1,-1, 1},
-{ 1, 1, 0, 0, 1, 1, 0,-1, 0},
-{ 1, 1, 0, 0, 1, 1, 1, 0, 0},
-{ 1, 1, 0, 0, 1, 1, 1, 1, 1},
-{ 1, 1, 0, 1, 1,-1,-1, 0, 1},
-{ 1, 1, 0, 1, 1,-1, 0, 1, 1},
-{ 1, 1, 0, 1, 1, 1, 0,-1, 1},
-{ 1, 1, 0, 1, 1, 1, 1, 0, 1},
-{ 1, 1, 1,-1, 0, 0, 0, 0, 1},
-{ 1, 1, 1,-1, 1, 0, 0, 1, 1},
-{ 1, 1, 1,-1, 1, 0, 1, 0, 1},
-{ 1, 1, 1, 0, 1, 0,-1, 0, 0},
-{ 1, 1, 1, 0, 1, 1,-1, 0, 1},
-{ 1, 1, 1, 0, 1, 1, 1, 0, 1},
-{ 1, 1, 1, 1, 1, 0,-1, 0, 1},
-{ 1, 1, 1, 1, 1, 0, 0, 1, 1},
-{ 0,-1,-1, 0, 1, 0, 1,-1, 1},
-{ 0,-1,-1, 0, 1, 0, 1, 0, 0},
-{ 0,-1,-1, 0, 1, 0, 1, 1, 1},
-{ 0,-1,-1, 1, 0, 0, 0, 0, 1},
-{ 0,-1,-1, 1, 1,-1, 0, 0, 1},
-{ 0,-1,-1, 1, 1, 1, 0, 0, 1},
-{ 0,-1, 0, 0, 0,-1, 1, 0, 1},
-{ 0,-1, 0, 0, 0, 1,-1, 0, 1},
-{ 0,-1, 0, 0, 1,-1, 1,-1, 1},
-{ 0,-1, 0, 0, 1,-1, 1, 0, 0},
-{ 0,-1, 0, 0, 1,-1, 1, 1, 1},
-{ 0,-1, 0, 0, 1, 1,-1,-1, 1},
-{ 0,-1, 0, 0, 1, 1,-1, 0, 0},
-{ 0,-1, 0, 0, 1, 1,-1, 1, 1},
-{ 0,-1, 0, 1, 0,-1, 0, 0, 1},
-{ 0,-1, 0, 1, 0, 0,-1, 0, 1},
-{ 0,-1, 0, 1, 0, 0, 0,-1, 1},
-{ 0,-1, 0, 1, 0, 0, 0, 1, 1},
-{ 0,-1, 0, 1, 0, 0, 1, 0, 1},
-{ 0,-1, 0, 1, 0, 1, 0, 0, 1},
-{ 0,-1, 0, 1, 1,-1, 0,-1, 1},
-{ 0,-1, 0, 1, 1,-1, 0, 1, 1},
-{ 0,-1, 0, 1, 1, 0,-1,-1, 1},
-{ 0,-1, 0, 1, 1, 0,-1, 1, 1},
-{ 0,-1, 0, 1, 1, 0, 1,-1, 1},
-{ 0,-1, 0, 1, 1, 0, 1, 1, 1},
-{ 0,-1, 0, 1, 1, 1, 0,-1, 1},
-{ 0,-1, 0, 1, 1, 1, 0, 1, 1},
-{ 0,-1, 1, 0, 1, 0,-1,-1, 1},
-{ 0,-1, 1, 0, 1, 0,-1, 0, 0},
-{ 0,-1, 1, 0, 1, 0,-1, 1, 1},
-{ 0,-1, 1, 1, 0, 0, 0, 0, 1},
-{ 0,-1, 1, 1, 1,-1, 0, 0, 1},
-{ 0,-1, 1, 1, 1, 1, 0, 0, 1},
-{ 0, 0,-1,-1, 0, 0, 0, 1, 1},
-{ 0, 0,-1,-1, 1,-1, 0, 1, 1},
-{ 0, 0,-1,-1, 1,-1, 1, 0, 1},
-{ 0, 0,-1,-1, 1, 0, 0, 1, 0},
-{ 0, 0,-1,-1, 1, 0, 1, 0, 0},
-{ 0, 0,-1,-1, 1, 1, 0, 1, 1},
-{ 0, 0,-1,-1, 1, 1, 1, 0, 1},
-{ 0, 0,-1, 0, 1,-1, 1,-1, 1},
-{ 0, 0,-1, 0, 1,-1, 1, 0, 0},
-{ 0, 0,-1, 0, 1,-1, 1, 1, 1},
-{ 0, 0,-1, 0, 1, 0, 1,-1, 0},
-{ 0, 0,-1, 0, 1, 0, 1, 1, 0},
-{ 0, 0,-1, 0, 1, 1, 1,-1, 1},
-{ 0, 0,-1, 0, 1, 1, 1, 0, 0},
-{ 0, 0,-1, 0, 1, 1, 1, 1, 1},
-{ 0, 0,-1, 1, 0, 0, 0,-1, 1},
-{ 0, 0,-1, 1, 1,-1, 0,-1, 1},
-{ 0, 0,-1, 1, 1,-1, 1, 0, 1},
-{ 0, 0,-1, 1, 1, 0, 0,-1, 0},
-{ 0, 0,-1, 1, 1, 0, 1, 0, 0},
-{ 0, 0,-1, 1, 1, 1, 0,-1, 1},
-{ 0, 0,-1, 1, 1, 1, 1, 0, 1},
-{ 0, 0, 1,-1, 0, 0, 0,-1, 1},
-{ 0, 0, 1,-1, 1,-1,-1, 0, 1},
-{ 0, 0, 1,-1, 1,-1, 0,-1, 1},
-{ 0, 0, 1,-1, 1, 0,-1, 0, 0},
-{ 0, 0, 1,-1, 1, 0, 0,-1, 0},
-{ 0, 0, 1,-1, 1, 1,-1, 0, 1},
-{ 0, 0, 1,-1, 1, 1, 0,-1, 1},
-{ 0, 0, 1, 0, 1,-1,-1,-1, 1},
-{ 0, 0, 1, 0, 1,-1,-1, 0, 0},
-{ 0, 0, 1, 0, 1,-1,-1, 1, 1},
-{ 0, 0, 1, 0, 1, 0,-1,-1, 0},
-{ 0, 0, 1, 0, 1, 0,-1, 1, 0},
-{ 0, 0, 1, 0, 1, 1,-1,-1, 1},
-{ 0, 0, 1, 0, 1, 1,-1, 0, 0},
-{ 0, 0, 1, 0, 1, 1,-1, 1, 1},
-{ 0, 0, 1, 1, 0, 0, 0, 1, 1},
-{ 0, 0, 1, 1, 1,-1,-1, 0, 1},
-{ 0, 0, 1, 1, 1,-1, 0, 1, 1},
-{ 0, 0, 1, 1, 1, 0,-1, 0, 0},
-{ 0, 0, 1, 1, 1, 0, 0, 1, 0},
-{ 0, 0, 1, 1, 1, 1,-1, 0, 1},
-{ 0, 0, 1, 1, 1, 1, 0, 1, 1},
-{ 0, 1,-1,-1, 0, 0, 0, 0, 1},
-{ 0, 1,-1,-1, 1,-1, 0, 0, 1},
-{ 0, 1,-1,-1, 1, 1, 0, 0, 1},
-{ 0, 1,-1, 0, 1, 0, 1,-1, 1},
-{ 0, 1,-1, 0, 1, 0, 1, 0, 0},
-{ 0, 1,-1, 0, 1, 0, 1, 1, 1},
-{ 0, 1, 0,-1, 0,-1, 0, 0, 1},
-{ 0, 1, 0,-1, 0, 0,-1, 0, 1},
-{ 0, 1, 0,-1, 0, 0, 0,-1, 1},
-{ 0, 1, 0,-1, 0, 0, 0, 1, 1},
-{ 0, 1, 0,-1, 0, 0, 1, 0, 1},
-{ 0, 1, 0,-1, 0, 1, 0, 0, 1},
-{ 0, 1, 0,-1, 1,-1, 0,-1, 1},
-{ 0, 1, 0,-1, 1,-1, 0, 1, 1},
-{ 0, 1, 0,-1, 1, 0,-1,-1, 1},
-{ 0, 1, 0,-1, 1, 0,-1, 1, 1},
-{ 0, 1, 0,-1, 1, 0, 1,-1, 1},
-{ 0, 1, 0,-1, 1, 0, 1, 1, 1},
-{ 0, 1, 0,-1, 1, 1, 0,-1, 1},
-{ 0, 1, 0,-1, 1, 1, 0, 1, 1},
-{ 0, 1, 0, 0, 0,-1,-1, 0, 1},
-{ 0, 1, 0, 0, 0, 1, 1, 0, 1},
-{ 0, 1, 0, 0, 1,-1,-1,-1, 1},
-{ 0, 1, 0, 0, 1,-1,-1, 0, 0},
-{ 0, 1, 0, 0, 1,-1,-1, 1, 1},
-{ 0, 1, 0, 0, 1, 1, 1,-1, 1},
-{ 0, 1, 0, 0, 1, 1, 1, 0, 0},
-{ 0, 1, 0, 0, 1, 1, 1, 1, 1},
-{ 0, 1, 1,-1, 0, 0, 0, 0, 1},
-{ 0, 1, 1,-1, 1,-1, 0, 0, 1},
-{ 0, 1, 1,-1, 1, 1, 0, 0, 1},
-{ 0, 1, 1, 0, 1, 0,-1,-1, 1},
-{ 0, 1, 1, 0, 1, 0,-1, 0, 0},
-{ 0, 1, 1, 0, 1, 0,-1, 1, 1},
-{ 1,-1,-1,-1, 1, 0, 0, 1, 0},
-{ 1,-1,-1,-1, 1, 0, 1, 0, 0},
-{ 1,-1,-1, 0, 0,-1, 0, 1, 1},
-{ 1,-1,-1, 0, 0,-1, 1, 0, 1},
-{ 1,-1,-1, 0, 0, 1,-1, 0, 1},
-{ 1,-1,-1, 0, 0, 1, 0,-1, 1},
-{ 1,-1,-1, 0, 1,-1, 0, 1, 0},
-{ 1,-1,-1, 0, 1, 0, 1,-1, 0},
-{ 1,-1,-1, 0, 1, 0, 1, 1, 0},
-{ 1,-1,-1, 0, 1, 1, 0,-1, 0},
-{ 1,-1,-1, 1, 0,-1, 0, 0, 1},
-{ 1,-1,-1, 1, 0, 0,-1, 0, 1},
-{ 1,-1,-1, 1, 0, 0, 1, 0, 1},
-{ 1,-1,-1, 1, 0, 1, 0, 0, 1},
-{ 1,-1,-1, 1, 1, 0, 0,-1, 0},
-{ 1,-1,-1, 1, 1, 0, 1, 0, 0},
-{ 1,-1, 0,-1, 1,-1, 0, 1, 0},
-{ 1,-1, 0,-1, 1,-1, 1, 0, 0},
-{ 1,-1, 0,-1, 1, 1,-1, 0, 0},
-{ 1,-1, 0,-1, 1, 1, 0,-1, 0},
-{ 1,-1, 0, 0, 0,-1, 0, 1, 0},
-{ 1,-1, 0, 0, 0,-1, 1, 0, 0},
-{ 1,-1, 0, 0, 0, 1,-1, 0, 0},
-{ 1,-1, 0, 0, 0, 1, 0,-1, 0},
-{ 1,-1, 0, 1, 0, 0,-1,-1, 1},
-{ 1,-1, 0, 1, 0, 0,-1, 1, 1},
-{ 1,-1, 0, 1, 0, 0, 1,-1, 1},
-{ 1,-1, 0, 1, 0, 0, 1, 1, 1},
-{ 1,-1, 0, 1, 1,-1, 0, 1, 0},
-{ 1,-1, 0, 1, 1,-1, 1, 0, 0},
-{ 1,-1, 0, 1, 1, 1,-1, 0, 0},
-{ 1,-1, 0, 1, 1, 1, 0,-1, 0},
-{ 1,-1, 1,-1, 1, 0,-1, 0, 0},
-{ 1,-1, 1,-1, 1, 0, 0,-1, 0},
-{ 1,-1, 1, 0, 0,-1, 0, 1, 1},
-{ 1,-1, 1, 0, 0,-1, 1, 0, 1},
-{ 1,-1, 1, 0, 0, 1,-1, 0, 1},
-{ 1,-1, 1, 0, 0, 1, 0,-1, 1},
-{ 1,-1, 1, 0, 1,-1, 0, 1, 0},
-{ 1,-1, 1, 0, 1, 0,-1,-1, 0},
-{ 1,-1, 1, 0, 1, 0,-1, 1, 0},
-{ 1,-1, 1, 0, 1, 1, 0,-1, 0},
-{ 1,-1, 1, 1, 0,-1, 0, 0, 1},
-{ 1,-1, 1, 1, 0, 0,-1, 0, 1},
-{ 1,-1, 1, 1, 0, 0, 1, 0, 1},
-{ 1,-1, 1, 1, 0, 1, 0, 0, 1},
-{ 1,-1, 1, 1, 1, 0,-1, 0, 0},
-{ 1,-1, 1, 1, 1, 0, 0, 1, 0},
-{ 1, 0,-1,-1, 0, 0,-1, 1, 1},
-{ 1, 0,-1,-1, 0, 0, 0, 1, 0},
-{ 1, 0,-1,-1, 0, 0, 1, 1, 1},
-{ 1, 0,-1,-1, 1,-1, 1, 0, 0},
-{ 1, 0,-1,-1, 1, 1, 1, 0, 0},
-{ 1, 0,-1, 0, 0,-1,-1, 1, 1},
-{ 1, 0,-1, 0, 0,-1, 0, 1, 0},
-{ 1, 0,-1, 0, 0,-1, 1, 1, 1},
-{ 1, 0,-1, 0, 0, 1,-1,-1, 1},
-{ 1, 0,-1, 0, 0, 1, 0,-1, 0},
-{ 1, 0,-1, 0, 0, 1, 1,-1, 1},
-{ 1, 0,-1, 1, 0, 0,-1,-1, 1},
-{ 1, 0,-1, 1, 0, 0, 0,-1, 0},
-{ 1, 0,-1, 1, 0, 0, 1,-1, 1},
-{ 1, 0,-1, 1, 1,-1, 1, 0, 0},
-{ 1, 0,-1, 1, 1, 1, 1, 0, 0},
-{ 1, 0, 0,-1, 0,-1,-1, 1, 1},
-{ 1, 0, 0,-1, 0,-1, 0, 1, 0},
-{ 1, 0, 0,-1, 0,-1, 1, 1, 1},
-{ 1, 0, 0,-1, 0, 1,-1,-1, 1},
-{ 1, 0, 0,-1, 0, 1, 0,-1, 0},
-{ 1, 0, 0,-1, 0, 1, 1,-1, 1},
-{ 1, 0, 0,-1, 1,-1,-1, 1, 0},
-{ 1, 0, 0,-1, 1,-1, 1, 1, 0},
-{ 1, 0, 0,-1, 1, 1,-1,-1, 0},
-{ 1, 0, 0,-1, 1, 1, 1,-1, 0},
-{ 1, 0, 0, 0, 0,-1,-1, 1, 0},
-{ 1, 0, 0, 0, 0,-1, 1, 1, 0},
-{ 1, 0, 0, 0, 0, 1,-1,-1, 0},
-{ 1, 0, 0, 0, 0, 1, 1,-1, 0},
-{ 1, 0, 0, 1, 0,-1,-1, 1, 1},
-{ 1, 0, 0, 1, 0,-1, 0, 1, 0},
-{ 1, 0, 0, 1, 0,-1, 1, 1, 1},
-{ 1, 0, 0, 1, 0, 1,-1,-1, 1},
-{ 1, 0, 0, 1, 0, 1, 0,-1, 0},
-{ 1, 0, 0, 1, 0, 1, 1,-1, 1},
-{ 1, 0, 0, 1, 1,-1,-1, 1, 0},
-{ 1, 0, 0, 1, 1,-1, 1, 1, 0},
-{ 1, 0, 0, 1, 1, 1,-1,-1, 0},
-{ 1, 0, 0, 1, 1, 1, 1,-1, 0},
-{ 1, 0, 1,-1, 0, 0,-1,-1, 1},
-{ 1, 0, 1,-1, 0, 0, 0,-1, 0},
-{ 1, 0, 1,-1, 0, 0, 1,-1, 1},
-{ 1, 0, 1,-1, 1,-1,-1, 0, 0},
-{ 1, 0, 1,-1, 1, 1,-1, 0, 0},
-{ 1, 0, 1, 0, 0,-1,-1, 1, 1},
-{ 1, 0, 1, 0, 0,-1, 0, 1, 0},
-{ 1, 0, 1, 0, 0,-1, 1, 1, 1},
-{ 1, 0, 1, 0, 0, 1,-1,-1, 1},
-{ 1, 0, 1, 0, 0, 1, 0,-1, 0},
-{ 1, 0, 1, 0, 0, 1, 1,-1, 1},
-{ 1, 0, 1, 1, 0, 0,-1, 1, 1},
-{ 1, 0, 1, 1, 0, 0, 0, 1, 0},
-{ 1, 0, 1, 1, 0, 0, 1, 1, 1},
-{ 1, 0, 1, 1, 1,-1,-1, 0, 0},
-{ 1, 0, 1, 1, 1, 1,-1, 0, 0},
-{ 1, 1,-1,-1, 0,-1, 0, 0, 1},
-{ 1, 1,-1,-1, 0, 0,-1, 0, 1},
-{ 1, 1,-1,-1, 0, 0, 1, 0, 1},
-{ 1, 1,-1,-1, 0, 1, 0, 0, 1},
-{ 1, 1,-1,-1, 1, 0, 0, 1, 0},
-{ 1, 1,-1,-1, 1, 0, 1, 0, 0},
-{ 1, 1,-1, 0, 0,-1,-1, 0, 1},
-{ 1, 1,-1, 0, 0,-1, 0, 1, 1},
-{ 1, 1,-1, 0, 0, 1, 0,-1, 1},
-{ 1, 1,-1, 0, 0, 1, 1, 0, 1},
-{ 1, 1,-1, 0, 1,-1, 0, 1, 0},
-{ 1, 1,-1, 0, 1, 0, 1,-1, 0},
-{ 1, 1,-1, 0, 1, 0, 1, 1, 0},
-{ 1, 1,-1, 0, 1, 1, 0,-1, 0},
-{ 1, 1,-1, 1, 1, 0, 0,-1, 0},
-{ 1, 1,-1, 1, 1, 0, 1, 0, 0},
-{ 1, 1, 0,-1, 0, 0,-1,-1, 1},
-{ 1, 1, 0,-1, 0, 0,-1, 1, 1},
-{ 1, 1, 0,-1, 0, 0, 1,-1, 1},
-{ 1, 1, 0,-1, 0, 0, 1, 1, 1},
-{ 1, 1, 0,-1, 1,-1,-1, 0, 0},
-{ 1, 1, 0,-1, 1,-1, 0, 1, 0},
-{ 1, 1, 0,-1, 1, 1, 0,-1, 0},
-{ 1, 1, 0,-1, 1, 1, 1, 0, 0},
-{ 1, 1, 0, 0, 0,-1,-1, 0, 0},
-{ 1, 1, 0, 0, 0,-1, 0, 1, 0},
-{ 1, 1, 0, 0, 0, 1, 0,-1, 0},
-{ 1, 1, 0, 0, 0, 1, 1, 0, 0},
-{ 1, 1, 0, 1, 1,-1,-1, 0, 0},
-{ 1, 1, 0, 1, 1,-1, 0, 1, 0},
-{ 1, 1, 0, 1, 1, 1, 0,-1, 0},
-{ 1, 1, 0, 1, 1, 1, 1, 0, 0},
-{ 1, 1, 1,-1, 0,-1, 0, 0, 1},
-{ 1, 1, 1,-1, 0, 0,-1, 0, 1},
-{ 1, 1, 1,-1, 0, 0, 1, 0, 1},
-{ 1, 1, 1,-1, 0, 1, 0, 0, 1},
-{ 1, 1, 1,-1, 1, 0,-1, 0, 0},
-{ 1, 1, 1,-1, 1, 0, 0,-1, 0},
-{ 1, 1, 1, 0, 0,-1,-1, 0, 1},
-{ 1, 1, 1, 0, 0,-1, 0, 1, 1},
-{ 1, 1, 1, 0, 0, 1, 0,-1, 1},
-{ 1, 1, 1, 0, 0, 1, 1, 0, 1},
-{ 1, 1, 1, 0, 1,-1, 0, 1, 0},
-{ 1, 1, 1, 0, 1, 0,-1,-1, 0},
-{ 1, 1, 1, 0, 1, 0,-1, 1, 0},
-{ 1, 1, 1, 0, 1, 1, 0,-1, 0},
-{ 1, 1, 1, 1, 1, 0,-1, 0, 0},
-{ 1, 1, 1, 1, 1, 0, 0, 1, 0},
-{ 0,-1,-1,-1, 1,-1, 1, 0, 1},
-{ 0,-1,-1,-1, 1, 0, 0, 1, 0},
-{ 0,-1,-1,-1, 1, 0, 1, 0, 0},
-{ 0,-1,-1,-1, 1, 0, 1, 1, 1},
-{ 0,-1,-1, 0, 0,-1, 1, 0, 1},
-{ 0,-1,-1, 0, 0, 1,-1, 0, 1},
-{ 0,-1,-1, 0, 1, 0, 1,-1, 0},
-{ 0,-1,-1, 0, 1, 0, 1, 1, 0},
-{ 0,-1,-1, 1, 0,-1, 0, 0, 1},
-{ 0,-1,-1, 1, 0, 0,-1, 0, 1},
-{ 0,-1,-1, 1, 0, 0, 1, 0, 1},
-{ 0,-1,-1, 1, 0, 1, 0, 0, 1},
-{ 0,-1,-1, 1, 1, 0,-1,-1, 1},
-{ 0,-1,-1, 1, 1, 0, 0,-1, 0},
-{ 0,-1,-1, 1, 1, 0, 1, 0, 0},
-{ 0,-1,-1, 1, 1, 0, 1, 1, 1},
-{ 0,-1,-1, 1, 1, 1,-1, 0, 1},
-{ 0,-1,-1, 1, 1, 1, 1, 0, 1},
-{ 0,-1, 0,-1, 1,-1, 1, 0, 0},
-{ 0,-1, 0,-1, 1, 1,-1, 0, 0},
-{ 0,-1, 0, 0, 0,-1, 1,-1, 1},
-{ 0,-1, 0, 0, 0,-1, 1, 0, 0},
-{ 0,-1, 0, 0, 0,-1, 1, 1, 1},
-{ 0,-1, 0, 0, 0, 1,-1,-1, 1},
-{ 0,-1, 0, 0, 0, 1,-1, 0, 0},
-{ 0,-1, 0, 0, 0, 1,-1, 1, 1},
-{ 0,-1, 0, 0, 1,-1, 1,-1, 0},
-{ 0,-1, 0, 0, 1,-1, 1, 1, 0},
-{ 0,-1, 0, 0, 1, 1,-1,-1, 0},
-{ 0,-1, 0, 0, 1, 1,-1, 1, 0},
-{ 0,-1, 0, 1, 0,-1, 0,-1, 1},
-{ 0,-1, 0, 1, 0,-1, 0, 1, 1},
-{ 0,-1, 0, 1, 0, 0,-1,-1, 1},
-{ 0,-1, 0, 1, 0, 0,-1, 1, 1},
-{ 0,-1, 0, 1, 0, 0, 1,-1, 1},
-{ 0,-1, 0, 1, 0, 0, 1, 1, 1},
-{ 0,-1, 0, 1, 0, 1, 0,-1, 1},
-{ 0,-1, 0, 1, 0, 1, 0, 1, 1},
-{ 0,-1, 0, 1, 1,-1, 1, 0, 0},
-{ 0,-1, 0, 1, 1, 1,-1, 0, 0},
-{ 0,-1, 1,-1, 1, 0,-1,-1, 1},
-{ 0,-1, 1,-1, 1, 0,-1, 0, 0},
-{ 0,-1, 1,-1, 1, 0, 0,-1, 0},
-{ 0,-1, 1,-1, 1, 1,-1, 0, 1},
-{ 0,-1, 1, 0, 0,-1, 1, 0, 1},
-{ 0,-1, 1, 0, 0, 1,-1, 0, 1},
-{ 0,-1, 1, 0, 1, 0,-1,-1, 0},
-{ 0,-1, 1, 0, 1, 0,-1, 1, 0},
-{ 0,-1, 1, 1, 0,-1, 0, 0, 1},
-{ 0,-1, 1, 1, 0, 0,-1, 0, 1},
-{ 0,-1, 1, 1, 0, 0, 1, 0, 1},
-{ 0,-1, 1, 1, 0, 1, 0, 0, 1},
-{ 0,-1, 1, 1, 1,-1,-1, 0, 1},
-{ 0,-1, 1, 1, 1,-1, 1, 0, 1},
-{ 0,-1, 1, 1, 1, 0,-1,-1, 1},
-{ 0,-1, 1, 1, 1, 0,-1, 0, 0},
-{ 0,-1, 1, 1, 1, 0, 0, 1, 0},
-{ 0,-1, 1, 1, 1, 0, 1, 1, 1},
-{ 0, 0,-1,-1, 0,-1, 0, 1, 1},
-{ 0, 0,-1,-1, 0, 0,-1, 1, 1},
-{ 0, 0,-1,-1, 0, 0, 0, 1, 0},
-{ 0, 0,-1,-1, 0, 0, 1, 1, 1},
-{ 0, 0,-1,-1, 0, 1, 0, 1, 1},
-{ 0, 0,-1,-1, 1,-1, 0, 1, 0},
-{ 0, 0,-1,-1, 1,-1, 1, 0, 0},
-{ 0, 0,-1,-1, 1, 1, 0, 1, 0},
-{ 0, 0,-1,-1, 1, 1, 1, 0, 0},
-{ 0, 0,-1, 0, 1,-1, 1,-1, 0},
-{ 0, 0,-1, 0, 1,-1, 1, 1, 0},
-{ 0, 0,-1, 0, 1, 1, 1,-1, 0},
-{ 0, 0,-1, 0, 1, 1, 1, 1, 0},
-{ 0, 0,-1, 1, 0,-1, 0,-1, 1},
-{ 0, 0,-1, 1, 0, 0,-1,-1, 1},
-{ 0, 0,-1, 1, 0, 0, 0,-1, 0},
-{ 0, 0,-1, 1, 0, 0, 1,-1, 1},
-{ 0, 0,-1, 1, 0, 1, 0,-1, 1},
-{ 0, 0,-1, 1, 1,-1, 0,-1, 0},
-{ 0, 0,-1, 1, 1,-1, 1, 0, 0},
-{ 0, 0,-1, 1, 1, 1, 0,-1, 0},
-{ 0, 0,-1, 1, 1, 1, 1, 0, 0},
-{ 0, 0, 1,-1, 0,-1, 0,-1, 1},
-{ 0, 0, 1,-1, 0, 0,-1,-1, 1},
-{ 0, 0, 1,-1, 0, 0, 0,-1, 0},
-{ 0, 0, 1,-1, 0, 0, 1,-1, 1},
-{ 0, 0, 1,-1, 0, 1, 0,-1, 1},
-{ 0, 0, 1,-1, 1,-1,-1, 0, 0},
-{ 0, 0, 1,-1, 1,-1, 0,-1, 0},
-{ 0, 0, 1,-1, 1, 1,-1, 0, 0},
-{ 0, 0, 1,-1, 1, 1, 0,-1, 0},
-{ 0, 0, 1, 0, 1,-1,-1,-1, 0},
-{ 0, 0, 1, 0, 1,-1,-1, 1, 0},
-{ 0, 0, 1, 0, 1, 1,-1,-1, 0},
-{ 0, 0, 1, 0, 1, 1,-1, 1, 0},
-{ 0, 0, 1, 1, 0,-1, 0, 1, 1},
-{ 0, 0, 1, 1, 0, 0,-1, 1, 1},
-{ 0, 0, 1, 1, 0, 0, 0, 1, 0},
-{ 0, 0, 1, 1, 0, 0, 1, 1, 1},
-{ 0, 0, 1, 1, 0, 1, 0, 1, 1},
-{ 0, 0, 1, 1, 1,-1,-1, 0, 0},
-{ 0, 0, 1, 1, 1,-1, 0, 1, 0},
-{ 0, 0, 1, 1, 1, 1,-1, 0, 0},
-{ 0, 0, 1, 1, 1, 1, 0, 1, 0},
-{ 0, 1,-1,-1, 0,-1, 0, 0, 1},
-{ 0, 1,-1,-1, 0, 0,-1, 0, 1},
-{ 0, 1,-1,-1, 0, 0, 1, 0, 1},
-{ 0, 1,-1,-1, 0, 1, 0, 0, 1},
-{ 0, 1,-1,-1, 1,-1,-1, 0, 1},
-{ 0, 1,-1,-1, 1,-1, 1, 0, 1},
-{ 0, 1,-1,-1, 1, 0,-1, 1, 1},
-{ 0, 1,-1,-1, 1, 0, 0, 1, 0},
-{ 0, 1,-1,-1, 1, 0, 1,-1, 1},
-{ 0, 1,-1,-1, 1, 0, 1, 0, 0},
-{ 0, 1,-1, 0, 0,-1,-1, 0, 1},
-{ 0, 1,-1, 0, 0, 1, 1, 0, 1},
-{ 0, 1,-1, 0, 1, 0, 1,-1, 0},
-{ 0, 1,-1, 0, 1, 0, 1, 1, 0},
-{ 0, 1,-1, 1, 1, 0, 0,-1, 0},
-{ 0, 1,-1, 1, 1, 0, 1,-1, 1},
-{ 0, 1,-1, 1, 1, 0, 1, 0, 0},
-{ 0, 1,-1, 1, 1, 1, 1, 0, 1},
-{ 0, 1, 0,-1, 0,-1, 0,-1, 1},
-{ 0, 1, 0,-1, 0,-1, 0, 1, 1},
-{ 0, 1, 0,-1, 0, 0,-1,-1, 1},
-{ 0, 1, 0,-1, 0, 0,-1, 1, 1},
-{ 0, 1, 0,-1, 0, 0, 1,-1, 1},
-{ 0, 1, 0,-1, 0, 0, 1, 1, 1},
-{ 0, 1, 0,-1, 0, 1, 0,-1, 1},
-{ 0, 1, 0,-1, 0, 1, 0, 1, 1},
-{ 0, 1, 0,-1, 1,-1,-1, 0, 0},
-{ 0, 1, 0,-1, 1, 1, 1, 0, 0},
-{ 0, 1, 0, 0, 0,-1,-1,-1, 1},
-{ 0, 1, 0, 0, 0,-1,-1, 0, 0},
-{ 0, 1, 0, 0, 0,-1,-1, 1, 1},
-{ 0, 1, 0, 0, 0, 1, 1,-1, 1},
-{ 0, 1, 0, 0, 0, 1, 1, 0, 0},
-{ 0, 1, 0, 0, 0, 1, 1, 1, 1},
-{ 0, 1, 0, 0, 1,-1,-1,-1, 0},
-{ 0, 1, 0, 0, 1,-1,-1, 1, 0},
-{ 0, 1, 0, 0, 1, 1, 1,-1, 0},
-{ 0, 1, 0, 0, 1, 1, 1, 1, 0},
-{ 0, 1, 0, 1, 1,-1,-1, 0, 0},
-{ 0, 1, 0, 1, 1, 1, 1, 0, 0},
-{ 0, 1, 1,-1, 0,-1, 0, 0, 1},
-{ 0, 1, 1,-1, 0, 0,-1, 0, 1},
-{ 0, 1, 1,-1, 0, 0, 1, 0, 1},
-{ 0, 1, 1,-1, 0, 1, 0, 0, 1},
-{ 0, 1, 1,-1, 1, 0,-1, 0, 0},
-{ 0, 1, 1,-1, 1, 0,-1, 1, 1},
-{ 0, 1, 1,-1, 1, 0, 0,-1, 0},
-{ 0, 1, 1,-1, 1, 0, 1,-1, 1},
-{ 0, 1, 1,-1, 1, 1,-1, 0, 1},
-{ 0, 1, 1,-1, 1, 1, 1, 0, 1},
-{ 0, 1, 1, 0, 0,-1,-1, 0, 1},
-{ 0, 1, 1, 0, 0, 1, 1, 0, 1},
-{ 0, 1, 1, 0, 1, 0,-1,-1, 0},
-{ 0, 1, 1, 0, 1, 0,-1, 1, 0},
-{ 0, 1, 1, 1, 1,-1,-1, 0, 1},
-{ 0, 1, 1, 1, 1, 0,-1, 0, 0},
-{ 0, 1, 1, 1, 1, 0,-1, 1, 1},
-{ 0, 1, 1, 1, 1, 0, 0, 1, 0},
-{ 1,-1,-1,-1, 0,-1, 0, 1, 1},
-{ 1,-1,-1,-1, 0, 0, 0, 1, 0},
-{ 1,-1,-1, 0, 0,-1, 0, 1, 0},
-{ 1,-1,-1, 0, 0,-1, 1, 0, 0},
-{ 1,-1,-1, 0, 0, 1,-1, 0, 0},
-{ 1,-1,-1, 0, 0, 1, 0,-1, 0},
-{ 1,-1,-1, 0, 1,-1, 1,-1, 0},
-{ 1,-1,-1, 0, 1, 1,-1,-1, 0},
-{ 1,-1,-1, 0, 1, 1, 1,-1, 0},
-{ 1,-1,-1, 1, 0,-1, 0,-1, 1},
-{ 1,-1,-1, 1, 0,-1, 0, 1, 1},
-{ 1,-1,-1, 1, 0, 0, 0,-1, 0},
-{ 1,-1, 0,-1, 0,-1, 0, 1, 0},
-{ 1,-1, 0,-1, 0,-1, 1, 0, 0},
-{ 1,-1, 0,-1, 0,-1, 1, 1, 1},
-{ 1,-1, 0,-1, 0, 1,-1,-1, 1},
-{ 1,-1, 0,-1, 0, 1,-1, 0, 0},
-{ 1,-1, 0,-1, 0, 1, 0,-1, 0},
-{ 1,-1, 0, 1, 0,-1,-1, 1, 1},
-{ 1,-1, 0, 1, 0,-1, 0, 1, 0},
-{ 1,-1, 0, 1, 0,-1, 1,-1, 1},
-{ 1,-1, 0, 1, 0,-1, 1, 0, 0},
-{ 1,-1, 0, 1, 0, 1,-1, 0, 0},
-{ 1,-1, 0, 1, 0, 1,-1, 1, 1},
-{ 1,-1, 0, 1, 0, 1, 0,-1, 0},
-{ 1,-1, 0, 1, 0, 1, 1,-1, 1},
-{ 1,-1, 1,-1, 0, 0, 0,-1, 0},
-{ 1,-1, 1,-1, 0, 1, 0,-1, 1},
-{ 1,-1, 1, 0, 0,-1, 0, 1, 0},
-{ 1,-1, 1, 0, 0,-1, 1, 0, 0},
-{ 1,-1, 1, 0, 0, 1,-1, 0, 0},
-{ 1,-1, 1, 0, 0, 1, 0,-1, 0},
-{ 1,-1, 1, 0, 1,-1,-1, 1, 0},
-{ 1,-1, 1, 0, 1,-1, 1, 1, 0},
-{ 1,-1, 1, 0, 1, 1,-1, 1, 0},
-{ 1,-1, 1, 1, 0, 0, 0, 1, 0},
-{ 1,-1, 1, 1, 0, 1, 0,-1, 1},
-{ 1,-1, 1, 1, 0, 1, 0, 1, 1},
-{ 1, 0,-1,-1, 0, 0,-1, 1, 0},
-{ 1, 0,-1,-1, 0, 0, 1, 1, 0},
-{ 1, 0,-1,-1, 1,-1,-1, 1, 0},
-{ 1, 0,-1,-1, 1, 1, 1,-1, 0},
-{ 1, 0,-1,-1, 1, 1, 1, 1, 0},
-{ 1, 0,-1, 0, 0,-1,-1, 1, 0},
-{ 1, 0,-1, 0, 0,-1, 1, 1, 0},
-{ 1, 0,-1, 0, 0, 1,-1,-1, 0},
-{ 1, 0,-1, 0, 0, 1, 1,-1, 0},
-{ 1, 0,-1, 1, 0, 0,-1,-1, 0},
-{ 1, 0,-1, 1, 0, 0, 1,-1, 0},
-{ 1, 0,-1, 1, 1,-1, 1,-1, 0},
-{ 1, 0,-1, 1, 1,-1, 1, 1, 0},
-{ 1, 0,-1, 1, 1, 1,-1,-1, 0},
-{ 1, 0, 0,-1, 0,-1,-1, 1, 0},
-{ 1, 0, 0,-1, 0,-1, 1, 1, 0},
-{ 1, 0, 0,-1, 0, 1,-1,-1, 0},
-{ 1, 0, 0,-1, 0, 1, 1,-1, 0},
-{ 1, 0, 0, 1, 0,-1,-1, 1, 0},
-{ 1, 0, 0, 1, 0,-1, 1, 1, 0},
-{ 1, 0, 0, 1, 0, 1,-1,-1, 0},
-{ 1, 0, 0, 1, 0, 1, 1,-1, 0},
-{ 1, 0, 1,-1, 0, 0,-1,-1, 0},
-{ 1, 0, 1,-1, 0, 0, 1,-1, 0},
-{ 1, 0, 1,-1, 1,-1,-1,-1, 0},
-{ 1, 0, 1,-1, 1,-1,-1, 1, 0},
-{ 1, 0, 1,-1, 1, 1, 1,-1, 0},
-{ 1, 0, 1, 0, 0,-1,-1, 1, 0},
-{ 1, 0, 1, 0, 0,-1, 1, 1, 0},
-{ 1, 0, 1, 0, 0, 1,-1,-1, 0},
-{ 1, 0, 1, 0, 0, 1, 1,-1, 0},
-{ 1, 0, 1, 1, 0, 0,-1, 1, 0},
-{ 1, 0, 1, 1, 0, 0, 1, 1, 0},
-{ 1, 0, 1, 1, 1,-1, 1, 1, 0},
-{ 1, 0, 1, 1, 1, 1,-1,-1, 0},
-{ 1, 0, 1, 1, 1, 1,-1, 1, 0},
-{ 1, 1,-1,-1, 0, 0, 0, 1, 0},
-{ 1, 1,-1,-1, 0, 1, 0,-1, 1},
-{ 1, 1,-1,-1, 0, 1, 0, 1, 1},
-{ 1, 1,-1, 0, 0,-1,-1, 0, 0},
-{ 1, 1,-1, 0, 0,-1, 0, 1, 0},
-{ 1, 1,-1, 0, 0, 1, 0,-1, 0},
-{ 1, 1,-1, 0, 0, 1, 1, 0, 0},
-{ 1, 1,-1, 0, 1,-1,-1, 1, 0},
-{ 1, 1,-1, 0, 1,-1, 1, 1, 0},
-{ 1, 1,-1, 0, 1, 1, 1, 1, 0},
-{ 1, 1,-1, 1, 0, 0, 0,-1, 0},
-{ 1, 1,-1, 1, 0, 1, 0,-1, 1},
-{ 1, 1, 0,-1, 0,-1,-1,-1, 1},
-{ 1, 1, 0,-1, 0,-1,-1, 0, 0},
-{ 1, 1, 0,-1, 0,-1, 0, 1, 0},
-{ 1, 1, 0,-1, 0,-1, 1, 1, 1},
-{ 1, 1, 0,-1, 0, 1,-1,-1, 1},
-{ 1, 1, 0,-1, 0, 1, 0,-1, 0},
-{ 1, 1, 0,-1, 0, 1, 1, 0, 0},
-{ 1, 1, 0,-1, 0, 1, 1, 1, 1},
-{ 1, 1, 0, 1, 0,-1,-1, 0, 0},
-{ 1, 1, 0, 1, 0,-1,-1, 1, 1},
-{ 1, 1, 0, 1, 0,-1, 0, 1, 0},
-{ 1, 1, 0, 1, 0, 1, 0,-1, 0},
-{ 1, 1, 0, 1, 0, 1, 1,-1, 1},
-{ 1, 1, 0, 1, 0, 1, 1, 0, 0},
-{ 1, 1, 1,-1, 0,-1, 0,-1, 1},
-{ 1, 1, 1,-1, 0,-1, 0, 1, 1},
-{ 1, 1, 1,-1, 0, 0, 0,-1, 0},
-{ 1, 1, 1, 0, 0,-1,-1, 0, 0},
-{ 1, 1, 1, 0, 0,-1, 0, 1, 0},
-{ 1, 1, 1, 0, 0, 1, 0,-1, 0},
-{ 1, 1, 1, 0, 0, 1, 1, 0, 0},
-{ 1, 1, 1, 0, 1,-1,-1,-1, 0},
-{ 1, 1, 1, 0, 1, 1,-1,-1, 0},
-{ 1, 1, 1, 0, 1, 1, 1,-1, 0},
-{ 1, 1, 1, 1, 0,-1, 0, 1, 1},
-{ 1, 1, 1, 1, 0, 0, 0, 1, 0},
-{-1,-1, 0, 1, 0, 0, 0, 0, 1},
-{-1, 0,-1, 0, 1, 0, 1, 0, 0},
-{-1, 0, 0, 0, 0,-1, 0,-1, 1},
-{-1, 0, 0, 0, 0, 1, 0, 1, 1},
-{-1, 0, 0, 0, 1,-1, 0,-1, 0},
-{-1, 0, 0, 0, 1, 1, 0, 1, 0},
-{-1, 0, 1, 0, 1, 0,-1, 0, 0},
-{-1, 1, 0,-1, 0, 0, 0, 0, 1},
-{ 0,-1,-1,-1, 0, 0, 0, 1, 0},
-{ 0,-1,-1,-1, 1,-1, 0, 1, 0},
-{ 0,-1,-1,-1, 1, 1, 0, 1, 0},
-{ 0,-1,-1, 0, 0,-1, 1,-1, 1},
-{ 0,-1,-1, 0, 0,-1, 1, 0, 0},
-{ 0,-1,-1, 0, 0,-1, 1, 1, 1},
-{ 0,-1,-1, 0, 0, 1,-1,-1, 1},
-{ 0,-1,-1, 0, 0, 1,-1, 0, 0},
-{ 0,-1,-1, 0, 0, 1,-1, 1, 1},
-{ 0,-1,-1, 1, 0, 0, 0,-1, 0},
-{ 0,-1,-1, 1, 1,-1, 0,-1, 0},
-{ 0,-1,-1, 1, 1, 1, 0,-1, 0},
-{ 0,-1, 0,-1, 0,-1, 1, 0, 0},
-{ 0,-1, 0,-1, 0, 1,-1, 0, 0},
-{ 0,-1, 0,-1, 1,-1, 1,-1, 0},
-{ 0,-1, 0,-1, 1,-1, 1, 1, 0},
-{ 0,-1, 0,-1, 1, 0, 0, 0,-1},
-{ 0,-1, 0,-1, 1, 1,-1,-1, 0},
-{ 0,-1, 0,-1, 1, 1,-1, 1, 0},
-{ 0,-1, 0, 0, 0,-1, 1,-1, 0},
-{ 0,-1, 0, 0, 0,-1, 1, 1, 0},
-{ 0,-1, 0, 0, 0, 1,-1,-1, 0},
-{ 0,-1, 0, 0, 0, 1,-1, 1, 0},
-{ 0,-1, 0, 1,-1, 0, 0, 0, 1},
-{ 0,-1, 0, 1, 0,-1, 1, 0, 0},
-{ 0,-1, 0, 1, 0, 1,-1, 0, 0},
-{ 0,-1, 0, 1, 1,-1, 1,-1, 0},
-{ 0,-1, 0, 1, 1,-1, 1, 1, 0},
-{ 0,-1, 0, 1, 1, 1,-1,-1, 0},
-{ 0,-1, 0, 1, 1, 1,-1, 1, 0},
-{ 0,-1, 1,-1, 0, 0, 0,-1, 0},
-{ 0,-1, 1,-1, 1,-1, 0,-1, 0},
-{ 0,-1, 1,-1, 1, 1, 0,-1, 0},
-{ 0,-1, 1, 0, 0,-1, 1,-1, 1},
-{ 0,-1, 1, 0, 0,-1, 1, 0, 0},
-{ 0,-1, 1, 0, 0,-1, 1, 1, 1},
-{ 0,-1, 1, 0, 0, 1,-1,-1, 1},
-{ 0,-1, 1, 0, 0, 1,-1, 0, 0},
-{ 0,-1, 1, 0, 0, 1,-1, 1, 1},
-{ 0,-1, 1, 1, 0, 0, 0, 1, 0},
-{ 0,-1, 1, 1, 1,-1, 0, 1, 0},
-{ 0,-1, 1, 1, 1, 1, 0, 1, 0},
-{ 0, 0,-1,-1, 0,-1,-1, 1, 1},
-{ 0, 0,-1,-1, 0,-1, 0, 1, 0},
-{ 0, 0,-1,-1, 0,-1, 1, 1, 1},
-{ 0, 0,-1,-1, 0, 0,-1, 1, 0},
-{ 0, 0,-1,-1, 0, 0, 1, 1, 0},
-{ 0, 0,-1,-1, 0, 1,-1, 1, 1},
-{ 0, 0,-1,-1, 0, 1, 0, 1, 0},
-{ 0, 0,-1,-1, 0, 1, 1, 1, 1},
-{ 0, 0,-1, 0,-1, 0,-1, 0, 1},
-{ 0, 0,-1, 0, 1, 0, 1, 0,-1},
-{ 0, 0,-1, 1, 0,-1,-1,-1, 1},
-{ 0, 0,-1, 1, 0,-1, 0,-1, 0},
-{ 0, 0,-1, 1, 0,-1, 1,-1, 1},
-{ 0, 0,-1, 1, 0, 0,-1,-1, 0},
-{ 0, 0,-1, 1, 0, 0, 1,-1, 0},
-{ 0, 0,-1, 1, 0, 1,-1,-1, 1},
-{ 0, 0,-1, 1, 0, 1, 0,-1, 0},
-{ 0, 0,-1, 1, 0, 1, 1,-1, 1},
-{ 0, 0, 1,-1, 0,-1,-1,-1, 1},
-{ 0, 0, 1,-1, 0,-1, 0,-1, 0},
-{ 0, 0, 1,-1, 0,-1, 1,-1, 1},
-{ 0, 0, 1,-1, 0, 0,-1,-1, 0},
-{ 0, 0, 1,-1, 0, 0, 1,-1, 0},
-{ 0, 0, 1,-1, 0, 1,-1,-1, 1},
-{ 0, 0, 1,-1, 0, 1, 0,-1, 0},
-{ 0, 0, 1,-1, 0, 1, 1,-1, 1},
-{ 0, 0, 1, 0,-1, 0, 1, 0, 1},
-{ 0, 0, 1, 0, 1, 0,-1, 0,-1},
-{ 0, 0, 1, 1, 0,-1,-1, 1, 1},
-{ 0, 0, 1, 1, 0,-1, 0, 1, 0},
-{ 0, 0, 1, 1, 0,-1, 1, 1, 1},
-{ 0, 0, 1, 1, 0, 0,-1, 1, 0},
-{ 0, 0, 1, 1, 0, 0, 1, 1, 0},
-{ 0, 0, 1, 1, 0, 1,-1, 1, 1},
-{ 0, 0, 1, 1, 0, 1, 0, 1, 0},
-{ 0, 0, 1, 1, 0, 1, 1, 1, 1},
-{ 0, 1,-1,-1, 0, 0, 0, 1, 0},
-{ 0, 1,-1,-1, 1,-1, 0, 1, 0},
-{ 0, 1,-1,-1, 1, 1, 0, 1, 0},
-{ 0, 1,-1, 0, 0,-1,-1,-1, 1},
-{ 0, 1,-1, 0, 0,-1,-1, 0, 0},
-{ 0, 1,-1, 0, 0,-1,-1, 1, 1},
-{ 0, 1,-1, 0, 0, 1, 1,-1, 1},
-{ 0, 1,-1, 0, 0, 1, 1, 0, 0},
-{ 0, 1,-1, 0, 0, 1, 1, 1, 1},
-{ 0, 1,-1, 1, 0, 0, 0,-1, 0},
-{ 0, 1,-1, 1, 1,-1, 0,-1, 0},
-{ 0, 1,-1, 1, 1, 1, 0,-1, 0},
-{ 0, 1, 0,-1,-1, 0, 0, 0, 1},
-{ 0, 1, 0,-1, 0,-1,-1, 0, 0},
-{ 0, 1, 0,-1, 0, 1, 1, 0, 0},
-{ 0, 1, 0,-1, 1,-1,-1,-1, 0},
-{ 0, 1, 0,-1, 1,-1,-1, 1, 0},
-{ 0, 1, 0,-1, 1, 1, 1,-1, 0},
-{ 0, 1, 0,-1, 1, 1, 1, 1, 0},
-{ 0, 1, 0, 0, 0,-1,-1,-1, 0},
-{ 0, 1, 0, 0, 0,-1,-1, 1, 0},
-{ 0, 1, 0, 0, 0, 1, 1,-1, 0},
-{ 0, 1, 0, 0, 0, 1, 1, 1, 0},
-{ 0, 1, 0, 1, 0,-1,-1, 0, 0},
-{ 0, 1, 0, 1, 0, 1, 1, 0, 0},
-{ 0, 1, 0, 1, 1,-1,-1,-1, 0},
-{ 0, 1, 0, 1, 1,-1,-1, 1, 0},
-{ 0, 1, 0, 1, 1, 0, 0, 0,-1},
-{ 0, 1, 0, 1, 1, 1, 1,-1, 0},
-{ 0, 1, 0, 1, 1, 1, 1, 1, 0},
-{ 0, 1, 1,-1, 0, 0, 0,-1, 0},
-{ 0, 1, 1,-1, 1,-1, 0,-1, 0},
-{ 0, 1, 1,-1, 1, 1, 0,-1, 0},
-{ 0, 1, 1, 0, 0,-1,-1,-1, 1},
-{ 0, 1, 1, 0, 0,-1,-1, 0, 0},
-{ 0, 1, 1, 0, 0,-1,-1, 1, 1},
-{ 0, 1, 1, 0, 0, 1, 1,-1, 1},
-{ 0, 1, 1, 0, 0, 1, 1, 0, 0},
-{ 0, 1, 1, 0, 0, 1, 1, 1, 1},
-{ 0, 1, 1, 1, 0, 0, 0, 1, 0},
-{ 0, 1, 1, 1, 1,-1, 0, 1, 0},
-{ 0, 1, 1, 1, 1, 1, 0, 1, 0},
-{ 1,-1,-1,-1, 0,-1, 1, 0, 0},
-{ 1,-1,-1,-1, 0, 0,-1, 1, 0},
-{ 1,-1,-1,-1, 0, 0, 1, 1, 0},
-{ 1,-1,-1,-1, 0, 1,-1, 0, 0},
-{ 1,-1,-1, 1, 0,-1, 1, 0, 0},
-{ 1,-1,-1, 1, 0, 0,-1,-1, 0},
-{ 1,-1,-1, 1, 0, 0, 1,-1, 0},
-{ 1,-1,-1, 1, 0, 1,-1, 0, 0},
-{ 1,-1, 0,-1, 0, 0, 0, 0,-1},
-{ 1,-1, 1,-1, 0,-1, 1, 0, 0},
-{ 1,-1, 1,-1, 0, 0,-1,-1, 0},
-{ 1,-1, 1,-1, 0, 0, 1,-1, 0},
-{ 1,-1, 1,-1, 0, 1,-1, 0, 0},
-{ 1,-1, 1, 1, 0,-1, 1, 0, 0},
-{ 1,-1, 1, 1, 0, 0,-1, 1, 0},
-{ 1,-1, 1, 1, 0, 0, 1, 1, 0},
-{ 1,-1, 1, 1, 0, 1,-1, 0, 0},
-{ 1, 0,-1, 0,-1, 0,-1, 0, 0},
-{ 1, 0, 0, 0,-1,-1, 0, 1, 0},
-{ 1, 0, 0, 0,-1, 1, 0,-1, 0},
-{ 1, 0, 0, 0, 0,-1, 0, 1,-1},
-{ 1, 0, 0, 0, 0, 1, 0,-1,-1},
-{ 1, 0, 1, 0,-1, 0, 1, 0, 0},
-{ 1, 1,-1,-1, 0,-1,-1, 0, 0},
-{ 1, 1,-1,-1, 0, 0,-1, 1, 0},
-{ 1, 1,-1,-1, 0, 0, 1, 1, 0},
-{ 1, 1,-1,-1, 0, 1, 1, 0, 0},
-{ 1, 1,-1, 1, 0,-1,-1, 0, 0},
-{ 1, 1,-1, 1, 0, 0,-1,-1, 0},
-{ 1, 1,-1, 1, 0, 0, 1,-1, 0},
-{ 1, 1,-1, 1, 0, 1, 1, 0, 0},
-{ 1, 1, 0, 1, 0, 0, 0, 0,-1},
-{ 1, 1, 1,-1, 0,-1,-1, 0, 0},
-{ 1, 1, 1,-1, 0, 0,-1,-1, 0},
-{ 1, 1, 1,-1, 0, 0, 1,-1, 0},
-{ 1, 1, 1,-1, 0, 1, 1, 0, 0},
-{ 1, 1, 1, 1, 0,-1,-1, 0, 0},
-{ 1, 1, 1, 1, 0, 0,-1, 1, 0},
-{ 1, 1, 1, 1, 0, 0, 1, 1, 0},
-{ 1, 1, 1, 1, 0, 1, 1, 0, 0},
-{-1,-1,-1, 0, 1,-1, 1, 0, 1},
-{-1,-1,-1, 0, 1, 0, 1, 0, 0},
-{-1,-1,-1, 1, 0, 0, 0, 0, 1},
-{-1,-1,-1, 1, 1, 0, 0,-1, 1},
-{-1,-1,-1, 1, 1, 0, 1, 0, 1},
-{-1,-1, 0, 0, 0,-1, 0,-1, 1},
-{-1,-1, 0, 0, 0,-1, 1, 0, 1},
-{-1,-1, 0, 0, 0, 1,-1, 0, 1},
-{-1,-1, 0, 0, 0, 1, 0, 1, 1},
-{-1,-1, 0, 0, 1,-1, 0,-1, 0},
-{-1,-1, 0, 0, 1,-1, 1,-1, 1},
-{-1,-1, 0, 0, 1,-1, 1, 0, 0},
-{-1,-1, 0, 0, 1, 1,-1, 0, 0},
-{-1,-1, 0, 0, 1, 1,-1, 1, 1},
-{-1,-1, 0, 0, 1, 1, 0, 1, 0},
-{-1,-1, 0, 1, 0,-1, 0, 0, 1},
-{-1,-1, 0, 1, 0, 0,-1, 0, 1},
-{-1,-1, 0, 1, 0, 0, 0,-1, 1},
-{-1,-1, 0, 1, 0, 0, 0, 1, 1},
-{-1,-1, 0, 1, 0, 0, 1, 0, 1},
-{-1,-1, 0, 1, 0, 1, 0, 0, 1},
-{-1,-1, 0, 1, 1,-1, 0,-1, 1},
-{-1,-1, 0, 1, 1,-1, 1, 0, 1},
-{-1,-1, 0, 1, 1, 1,-1, 0, 1},
-{-1,-1, 0, 1, 1, 1, 0, 1, 1},
-{-1,-1, 1, 0, 1, 0,-1, 0, 0},
-{-1,-1, 1, 0, 1, 1,-1, 0, 1},
-{-1,-1, 1, 1, 0, 0, 0, 0, 1},
-{-1,-1, 1, 1, 1, 0,-1, 0, 1},
-{-1,-1, 1, 1, 1, 0, 0, 1, 1},
-{-1, 0,-1,-1, 0, 0, 0, 1, 1},
-{-1, 0,-1,-1, 1, 0, 0, 1, 0},
-{-1, 0,-1,-1, 1, 0, 1, 0, 0},
-{-1, 0,-1,-1, 1, 0, 1, 1, 1},
-{-1, 0,-1,-1, 1, 1, 0, 1, 1},
-{-1, 0,-1, 0, 0,-1, 0,-1, 1},
-{-1, 0,-1, 0, 0, 1, 0, 1, 1},
-{-1, 0,-1, 0, 1,-1, 0,-1, 0},
-{-1, 0,-1, 0, 1,-1, 1,-1, 1},
-{-1, 0,-1, 0, 1,-1, 1, 0, 0},
-{-1, 0,-1, 0, 1, 0, 1,-1, 0},
-{-1, 0,-1, 0, 1, 0, 1, 1, 0},
-{-1, 0,-1, 0, 1, 1, 0, 1, 0},
-{-1, 0,-1, 0, 1, 1, 1, 0, 0},
-{-1, 0,-1, 0, 1, 1, 1, 1, 1},
-{-1, 0,-1, 1, 0, 0, 0,-1, 1},
-{-1, 0,-1, 1, 1,-1, 0,-1, 1},
-{-1, 0,-1, 1, 1, 0, 0,-1, 0},
-{-1, 0,-1, 1, 1, 0, 1,-1, 1},
-{-1, 0,-1, 1, 1, 0, 1, 0, 0},
-{-1, 0, 0,-1, 0,-1, 0,-1, 1},
-{-1, 0, 0,-1, 0, 1, 0, 1, 1},
-{-1, 0, 0,-1, 1,-1, 0,-1, 0},
-{-1, 0, 0,-1, 1, 1, 0, 1, 0},
-{-1, 0, 0, 0,-1, 0, 0, 0, 1},
-{-1, 0, 0, 0, 0,-1,-1,-1, 1},
-{-1, 0, 0, 0, 0,-1, 0,-1, 0},
-{-1, 0, 0, 0, 0,-1, 1,-1, 1},
-{-1, 0, 0, 0, 0, 1,-1, 1, 1},
-{-1, 0, 0, 0, 0, 1, 0, 1, 0},
-{-1, 0, 0, 0, 0, 1, 1, 1, 1},
-{-1, 0, 0, 0, 1,-1,-1,-1, 0},
-{-1, 0, 0, 0, 1,-1, 1,-1, 0},
-{-1, 0, 0, 0, 1, 0, 0, 0,-1},
-{-1, 0, 0, 0, 1, 1,-1, 1, 0},
-{-1, 0, 0, 0, 1, 1, 1, 1, 0},
-{-1, 0, 0, 1, 0,-1, 0,-1, 1},
-{-1, 0, 0, 1, 0, 1, 0, 1, 1},
-{-1, 0, 0, 1, 1,-1, 0,-1, 0},
-{-1, 0, 0, 1, 1, 1, 0, 1, 0},
-{-1, 0, 1,-1, 0, 0, 0,-1, 1},
-{-1, 0, 1,-1, 1,-1, 0,-1, 1},
-{-1, 0, 1,-1, 1, 0,-1,-1, 1},
-{-1, 0, 1,-1, 1, 0,-1, 0, 0},
-{-1, 0, 1,-1, 1, 0, 0,-1, 0},
-{-1, 0, 1, 0, 0,-1, 0,-1, 1},
-{-1, 0, 1, 0, 0, 1, 0, 1, 1},
-{-1, 0, 1, 0, 1,-1,-1,-1, 1},
-{-1, 0, 1, 0, 1,-1,-1, 0, 0},
-{-1, 0, 1, 0, 1,-1, 0,-1, 0},
-{-1, 0, 1, 0, 1, 0,-1,-1, 0},
-{-1, 0, 1, 0, 1, 0,-1, 1, 0},
-{-1, 0, 1, 0, 1, 1,-1, 0, 0},
-{-1, 0, 1, 0, 1, 1,-1, 1, 1},
-{-1, 0, 1, 0, 1, 1, 0, 1, 0},
-{-1, 0, 1, 1, 0, 0, 0, 1, 1},
-{-1, 0, 1, 1, 1, 0,-1, 0, 0},
-{-1, 0, 1, 1, 1, 0,-1, 1, 1},
-{-1, 0, 1, 1, 1, 0, 0, 1, 0},
-{-1, 0, 1, 1, 1, 1, 0, 1, 1},
-{-1, 1,-1,-1, 0, 0, 0, 0, 1},
-{-1, 1,-1,-1, 1, 0, 0, 1, 1},
-{-1, 1,-1,-1, 1, 0, 1, 0, 1},
-{-1, 1,-1, 0, 1, 0, 1, 0, 0},
-{-1, 1,-1, 0, 1, 1, 1, 0, 1},
-{-1, 1, 0,-1, 0,-1, 0, 0, 1},
-{-1, 1, 0,-1, 0, 0,-1, 0, 1},
-{-1, 1, 0,-1, 0, 0, 0,-1, 1},
-{-1, 1, 0,-1, 0, 0, 0, 1, 1},
-{-1, 1, 0,-1, 0, 0, 1, 0, 1},
-{-1, 1, 0,-1, 0, 1, 0, 0, 1},
-{-1, 1, 0,-1, 1,-1,-1, 0, 1},
-{-1, 1, 0,-1, 1,-1, 0,-1, 1},
-{-1, 1, 0,-1, 1, 1, 0, 1, 1},
-{-1, 1, 0,-1, 1, 1, 1, 0, 1},
-{-1, 1, 0, 0, 0,-1,-1, 0, 1},
-{-1, 1, 0, 0, 0,-1, 0,-1, 1},
-{-1, 1, 0, 0, 0, 1, 0, 1, 1},
-{-1, 1, 0, 0, 0, 1, 1, 0, 1},
-{-1, 1, 0, 0, 1,-1,-1,-1, 1},
-{-1, 1, 0, 0, 1,-1,-1, 0, 0},
-{-1, 1, 0, 0, 1,-1, 0,-1, 0},
-{-1, 1, 0, 0, 1, 1, 0, 1, 0},
-{-1, 1, 0, 0, 1, 1, 1, 0, 0},
-{-1, 1, 0, 0, 1, 1, 1, 1, 1},
-{-1, 1, 1,-1, 0, 0, 0, 0, 1},
-{-1, 1, 1,-1, 1, 0,-1, 0, 1},
-{-1, 1, 1,-1, 1, 0, 0,-1, 1},
-{-1, 1, 1, 0, 1,-1,-1, 0, 1},
-{-1, 1, 1, 0, 1, 0,-1, 0, 0},
-{ 0,-1,-1,-1, 0,-1, 0, 1, 0},
-{ 0,-1,-1,-1, 0,-1, 1, 0, 0},
-{ 0,-1,-1,-1, 0,-1, 1, 1, 1},
-{ 0,-1,-1,-1, 0, 0,-1, 1, 0},
-{ 0,-1,-1,-1, 0, 0, 1, 1, 0},
-{ 0,-1,-1,-1, 0, 1,-1, 0, 0},
-{ 0,-1,-1,-1, 0, 1,-1, 1, 1},
-{ 0,-1,-1,-1, 0, 1, 0, 1, 0},
-{ 0,-1,-1,-1, 1,-1, 1,-1, 0},
-{ 0,-1,-1,-1, 1, 0, 0, 0,-1},
-{ 0,-1,-1,-1, 1, 1,-1, 1, 0},
-{ 0,-1,-1,-1, 1, 1, 1, 1, 0},
-{ 0,-1,-1, 0,-1, 0,-1, 0, 1},
-{ 0,-1,-1, 0, 0,-1, 1,-1, 0},
-{ 0,-1,-1, 0, 0,-1, 1, 1, 0},
-{ 0,-1,-1, 0, 0, 1,-1,-1, 0},
-{ 0,-1,-1, 0, 0, 1,-1, 1, 0},
-{ 0,-1,-1, 0, 1, 0, 1, 0,-1},
-{ 0,-1,-1, 1,-1, 0, 0, 0, 1},
-{ 0,-1,-1, 1, 0,-1,-1,-1, 1},
-{ 0,-1,-1, 1, 0,-1, 0,-1, 0},
-{ 0,-1,-1, 1, 0,-1, 1, 0, 0},
-{ 0,-1,-1, 1, 0,-1, 1, 1, 1},
-{ 0,-1,-1, 1, 0, 0,-1,-1, 0},
-{ 0,-1,-1, 1, 0, 0, 1,-1, 0},
-{ 0,-1,-1, 1, 0, 1,-1, 0, 0},
-{ 0,-1,-1, 1, 0, 1,-1, 1, 1},
-{ 0,-1,-1, 1, 0, 1, 0,-1, 0},
-{ 0,-1,-1, 1, 0, 1, 1,-1, 1},
-{ 0,-1,-1, 1, 1,-1, 1, 1, 0},
-{ 0,-1,-1, 1, 1, 1,-1,-1, 0},
-{ 0,-1,-1, 1, 1, 1, 1,-1, 0},
-{ 0,-1, 0,-1, 0,-1, 1,-1, 0},
-{ 0,-1, 0,-1, 0,-1, 1, 1, 0},
-{ 0,-1, 0,-1, 0, 0, 0, 0,-1},
-{ 0,-1, 0,-1, 0, 1,-1,-1, 0},
-{ 0,-1, 0,-1, 0, 1,-1, 1, 0},
-{ 0,-1, 0,-1, 1,-1, 0, 0,-1},
-{ 0,-1, 0,-1, 1, 0,-1, 0,-1},
-{ 0,-1, 0,-1, 1, 0, 0,-1,-1},
-{ 0,-1, 0,-1, 1, 0, 0, 1,-1},
-{ 0,-1, 0,-1, 1, 0, 1, 0,-1},
-{ 0,-1, 0,-1, 1, 1, 0, 0,-1},
-{ 0,-1, 0, 0,-1,-1, 1, 0, 1},
-{ 0,-1, 0, 0,-1, 1,-1, 0, 1},
-{ 0,-1, 0, 0, 1,-1, 1, 0,-1},
-{ 0,-1, 0, 0, 1, 1,-1, 0,-1},
-{ 0,-1, 0, 1,-1,-1, 0, 0, 1},
-{ 0,-1, 0, 1,-1, 0,-1, 0, 1},
-{ 0,-1, 0, 1,-1, 0, 0,-1, 1},
-{ 0,-1, 0, 1,-1, 0, 0, 1, 1},
-{ 0,-1, 0, 1,-1, 0, 1, 0, 1},
-{ 0,-1, 0, 1,-1, 1, 0, 0, 1},
-{ 0,-1, 0, 1, 0,-1, 1,-1, 0},
-{ 0,-1, 0, 1, 0,-1, 1, 1, 0},
-{ 0,-1, 0, 1, 0, 1,-1,-1, 0},
-{ 0,-1, 0, 1, 0, 1,-1, 1, 0},
-{ 0,-1, 1,-1, 0,-1, 0,-1, 0},
-{ 0,-1, 1,-1, 0,-1, 1,-1, 1},
-{ 0,-1, 1,-1, 0,-1, 1, 0, 0},
-{ 0,-1, 1,-1, 0, 0,-1,-1, 0},
-{ 0,-1, 1,-1, 0, 0, 1,-1, 0},
-{ 0,-1, 1,-1, 0, 1,-1,-1, 1},
-{ 0,-1, 1,-1, 0, 1,-1, 0, 0},
-{ 0,-1, 1,-1, 0, 1, 0,-1, 0},
-{ 0,-1, 1,-1, 1,-1,-1,-1, 0},
-{ 0,-1, 1,-1, 1,-1, 1,-1, 0},
-{ 0,-1, 1,-1, 1, 0, 0, 0,-1},
-{ 0,-1, 1,-1, 1, 1,-1, 1, 0},
-{ 0,-1, 1, 0,-1, 0, 1, 0, 1},
-{ 0,-1, 1, 0, 0,-1, 1,-1, 0},
-{ 0,-1, 1, 0, 0,-1, 1, 1, 0},
-{ 0,-1, 1, 0, 0, 1,-1,-1, 0},
-{ 0,-1, 1, 0, 0, 1,-1, 1, 0},
-{ 0,-1, 1, 0, 1, 0,-1, 0,-1},
-{ 0,-1, 1, 1,-1, 0, 0, 0, 1},
-{ 0,-1, 1, 1, 0,-1,-1, 1, 1},
-{ 0,-1, 1, 1, 0,-1, 0, 1, 0},
-{ 0,-1, 1, 1, 0,-1, 1,-1, 1},
-{ 0,-1, 1, 1, 0,-1, 1, 0, 0},
-{ 0,-1, 1, 1, 0, 0,-1, 1, 0},
-{ 0,-1, 1, 1, 0, 0, 1, 1, 0},
-{ 0,-1, 1, 1, 0, 1,-1,-1, 1},
-{ 0,-1, 1, 1, 0, 1,-1, 0, 0},
-{ 0,-1, 1, 1, 0, 1, 0, 1, 0},
-{ 0,-1, 1, 1, 0, 1, 1, 1, 1},
-{ 0,-1, 1, 1, 1,-1,-1, 1, 0},
-{ 0,-1, 1, 1, 1,-1, 1, 1, 0},
-{ 0,-1, 1, 1, 1, 1,-1,-1, 0},
-{ 0, 0,-1,-1,-1, 0,-1, 0, 1},
-{ 0, 0,-1,-1,-1, 0, 0, 1, 1},
-{ 0, 0,-1,-1, 0,-1,-1, 1, 0},
-{ 0, 0,-1,-1, 0,-1, 1, 1, 0},
-{ 0, 0,-1,-1, 0, 1,-1, 1, 0},
-{ 0, 0,-1,-1, 0, 1, 1, 1, 0},
-{ 0, 0,-1,-1, 1, 0, 0, 1,-1},
-{ 0, 0,-1,-1, 1, 0, 1, 0,-1},
-{ 0, 0,-1, 0,-1,-1,-1, 0, 1},
-{ 0, 0,-1, 0,-1, 0,-1,-1, 1},
-{ 0, 0,-1, 0,-1, 0,-1, 0, 0},
-{ 0, 0,-1, 0,-1, 0,-1, 1, 1},
-{ 0, 0,-1, 0,-1, 1,-1, 0, 1},
-{ 0, 0,-1, 0, 1,-1, 1, 0,-1},
-{ 0, 0,-1, 0, 1, 0, 1,-1,-1},
-{ 0, 0,-1, 0, 1, 0, 1, 1,-1},
-{ 0, 0,-1, 0, 1, 1, 1, 0,-1},
-{ 0, 0,-1, 1,-1, 0,-1, 0, 1},
-{ 0, 0,-1, 1,-1, 0, 0,-1, 1},
-{ 0, 0,-1, 1, 0,-1,-1,-1, 0},
-{ 0, 0,-1, 1, 0,-1, 1,-1, 0},
-{ 0, 0,-1, 1, 0, 1,-1,-1, 0},
-{ 0, 0,-1, 1, 0, 1, 1,-1, 0},
-{ 0, 0,-1, 1, 1, 0, 0,-1,-1},
-{ 0, 0,-1, 1, 1, 0, 1, 0,-1},
-{ 0, 0, 1,-1,-1, 0, 0,-1, 1},
-{ 0, 0, 1,-1,-1, 0, 1, 0, 1},
-{ 0, 0, 1,-1, 0,-1,-1,-1, 0},
-{ 0, 0, 1,-1, 0,-1, 1,-1, 0},
-{ 0, 0, 1,-1, 0, 1,-1,-1, 0},
-{ 0, 0, 1,-1, 0, 1, 1,-1, 0},
-{ 0, 0, 1,-1, 1, 0,-1, 0,-1},
-{ 0, 0, 1,-1, 1, 0, 0,-1,-1},
-{ 0, 0, 1, 0,-1,-1, 1, 0, 1},
-{ 0, 0, 1, 0,-1, 0, 1,-1, 1},
-{ 0, 0, 1, 0,-1, 0, 1, 0, 0},
-{ 0, 0, 1, 0,-1, 0, 1, 1, 1},
-{ 0, 0, 1, 0,-1, 1, 1, 0, 1},
-{ 0, 0, 1, 0, 1,-1,-1, 0,-1},
-{ 0, 0, 1, 0, 1, 0,-1,-1,-1},
-{ 0, 0, 1, 0, 1, 0,-1, 1,-1},
-{ 0, 0, 1, 0, 1, 1,-1, 0,-1},
-{ 0, 0, 1, 1,-1, 0, 0, 1, 1},
-{ 0, 0, 1, 1,-1, 0, 1, 0, 1},
-{ 0, 0, 1, 1, 0,-1,-1, 1, 0},
-{ 0, 0, 1, 1, 0,-1, 1, 1, 0},
-{ 0, 0, 1, 1, 0, 1,-1, 1, 0},
-{ 0, 0, 1, 1, 0, 1, 1, 1, 0},
-{ 0, 0, 1, 1, 1, 0,-1, 0,-1},
-{ 0, 0, 1, 1, 1, 0, 0, 1,-1},
-{ 0, 1,-1,-1,-1, 0, 0, 0, 1},
-{ 0, 1,-1,-1, 0,-1,-1,-1, 1},
-{ 0, 1,-1,-1, 0,-1,-1, 0, 0},
-{ 0, 1,-1,-1, 0,-1, 0, 1, 0},
-{ 0, 1,-1,-1, 0,-1, 1, 1, 1},
-{ 0, 1,-1,-1, 0, 0,-1, 1, 0},
-{ 0, 1,-1,-1, 0, 0, 1, 1, 0},
-{ 0, 1,-1,-1, 0, 1,-1, 1, 1},
-{ 0, 1,-1,-1, 0, 1, 0, 1, 0},
-{ 0, 1,-1,-1, 0, 1, 1,-1, 1},
-{ 0, 1,-1,-1, 0, 1, 1, 0, 0},
-{ 0, 1,-1,-1, 1,-1,-1, 1, 0},
-{ 0, 1,-1,-1, 1,-1, 1, 1, 0},
-{ 0, 1,-1,-1, 1, 1, 1,-1, 0},
-{ 0, 1,-1, 0,-1, 0,-1, 0, 1},
-{ 0, 1,-1, 0, 0,-1,-1,-1, 0},
-{ 0, 1,-1, 0, 0,-1,-1, 1, 0},
-{ 0, 1,-1, 0, 0, 1, 1,-1, 0},
-{ 0, 1,-1, 0, 0, 1, 1, 1, 0},
-{ 0, 1,-1, 0, 1, 0, 1, 0,-1},
-{ 0, 1,-1, 1, 0,-1,-1,-1, 1},
-{ 0, 1,-1, 1, 0,-1,-1, 0, 0},
-{ 0, 1,-1, 1, 0,-1, 0,-1, 0},
-{ 0, 1,-1, 1, 0, 0,-1,-1, 0},
-{ 0, 1,-1, 1, 0, 0, 1,-1, 0},
-{ 0, 1,-1, 1, 0, 1, 0,-1, 0},
-{ 0, 1,-1, 1, 0, 1, 1,-1, 1},
-{ 0, 1,-1, 1, 0, 1, 1, 0, 0},
-{ 0, 1,-1, 1, 1,-1,-1,-1, 0},
-{ 0, 1,-1, 1, 1,-1, 1,-1, 0},
-{ 0, 1,-1, 1, 1, 0, 0, 0,-1},
-{ 0, 1,-1, 1, 1, 1, 1, 1, 0},
-{ 0, 1, 0,-1,-1,-1, 0, 0, 1},
-{ 0, 1, 0,-1,-1, 0,-1, 0, 1},
-{ 0, 1, 0,-1,-1, 0, 0,-1, 1},
-{ 0, 1, 0,-1,-1, 0, 0, 1, 1},
-{ 0, 1, 0,-1,-1, 0, 1, 0, 1},
-{ 0, 1, 0,-1,-1, 1, 0, 0, 1},
-{ 0, 1, 0,-1, 0,-1,-1,-1, 0},
-{ 0, 1, 0,-1, 0,-1,-1, 1, 0},
-{ 0, 1, 0,-1, 0, 1, 1,-1, 0},
-{ 0, 1, 0,-1, 0, 1, 1, 1, 0},
-{ 0, 1, 0, 0,-1,-1,-1, 0, 1},
-{ 0, 1, 0, 0,-1, 1, 1, 0, 1},
-{ 0, 1, 0, 0, 1,-1,-1, 0,-1},
-{ 0, 1, 0, 0, 1, 1, 1, 0,-1},
-{ 0, 1, 0, 1, 0,-1,-1,-1, 0},
-{ 0, 1, 0, 1, 0,-1,-1, 1, 0},
-{ 0, 1, 0, 1, 0, 0, 0, 0,-1},
-{ 0, 1, 0, 1, 0, 1, 1,-1, 0},
-{ 0, 1, 0, 1, 0, 1, 1, 1, 0},
-{ 0, 1, 0, 1, 1,-1, 0, 0,-1},
-{ 0, 1, 0, 1, 1, 0,-1, 0,-1},
-{ 0, 1, 0, 1, 1, 0, 0,-1,-1},
-{ 0, 1, 0, 1, 1, 0, 0, 1,-1},
-{ 0, 1, 0, 1, 1, 0, 1, 0,-1},
-{ 0, 1, 0, 1, 1, 1, 0, 0,-1},
-{ 0, 1, 1,-1,-1, 0, 0, 0, 1},
-{ 0, 1, 1,-1, 0,-1,-1, 0, 0},
-{ 0, 1, 1,-1, 0,-1,-1, 1, 1},
-{ 0, 1, 1,-1, 0,-1, 0,-1, 0},
-{ 0, 1, 1,-1, 0,-1, 1,-1, 1},
-{ 0, 1, 1,-1, 0, 0,-1,-1, 0},
-{ 0, 1, 1,-1, 0, 0, 1,-1, 0},
-{ 0, 1, 1,-1, 0, 1,-1,-1, 1},
-{ 0, 1, 1,-1, 0, 1, 0,-1, 0},
-{ 0, 1, 1,-1, 0, 1, 1, 0, 0},
-{ 0, 1, 1,-1, 0, 1, 1, 1, 1},
-{ 0, 1, 1,-1, 1,-1,-1, 1, 0},
-{ 0, 1, 1,-1, 1, 1,-1,-1, 0},
-{ 0, 1, 1,-1, 1, 1, 1,-1, 0},
-{ 0, 1, 1, 0,-1, 0, 1, 0, 1},
-{ 0, 1, 1, 0, 0,-1,-1,-1, 0},
-{ 0, 1, 1, 0, 0,-1,-1, 1, 0},
-{ 0, 1, 1, 0, 0, 1, 1,-1, 0},
-{ 0, 1, 1, 0, 0, 1, 1, 1, 0},
-{ 0, 1, 1, 0, 1, 0,-1, 0,-1},
-{ 0, 1, 1, 1, 0,-1,-1, 0, 0},
-{ 0, 1, 1, 1, 0,-1,-1, 1, 1},
-{ 0, 1, 1, 1, 0,-1, 0, 1, 0},
-{ 0, 1, 1, 1, 0, 0,-1, 1, 0},
-{ 0, 1, 1, 1, 0, 0, 1, 1, 0},
-{ 0, 1, 1, 1, 0, 1, 0, 1, 0},
-{ 0, 1, 1, 1, 0, 1, 1, 0, 0},
-{ 0, 1, 1, 1, 0, 1, 1, 1, 1},
-{ 0, 1, 1, 1, 1,-1,-1,-1, 0},
-{ 0, 1, 1, 1, 1, 0, 0, 0,-1},
-{ 0, 1, 1, 1, 1, 1,-1, 1, 0},
-{ 0, 1, 1, 1, 1, 1, 1, 1, 0},
-{ 1,-1,-1,-1, 0,-1,-1, 1, 0},
-{ 1,-1,-1,-1, 0, 0, 0, 0,-1},
-{ 1,-1,-1,-1, 0, 1,-1,-1, 0},
-{ 1,-1,-1,-1, 0, 1,-1, 1, 0},
-{ 1,-1,-1,-1, 1, 0, 0, 1,-1},
-{ 1,-1,-1,-1, 1, 0, 1, 0,-1},
-{ 1,-1,-1, 0,-1, 0,-1, 0, 0},
-{ 1,-1,-1, 0,-1, 1,-1, 0, 1},
-{ 1,-1,-1, 0, 1,-1, 1, 0,-1},
-{ 1,-1,-1, 1,-1, 0,-1, 0, 1},
-{ 1,-1,-1, 1,-1, 0, 0,-1, 1},
-{ 1,-1,-1, 1, 0,-1, 1,-1, 0},
-{ 1,-1,-1, 1, 0,-1, 1, 1, 0},
-{ 1,-1,-1, 1, 0, 1, 1,-1, 0},
-{ 1,-1, 0,-1, 0,-1, 0, 0,-1},
-{ 1,-1, 0,-1, 0, 0,-1, 0,-1},
-{ 1,-1, 0,-1, 0, 0, 0,-1,-1},
-{ 1,-1, 0,-1, 0, 0, 0, 1,-1},
-{ 1,-1, 0,-1, 0, 0, 1, 0,-1},
-{ 1,-1, 0,-1, 0, 1, 0, 0,-1},
-{ 1,-1, 0,-1, 1,-1, 0, 1,-1},
-{ 1,-1, 0,-1, 1,-1, 1, 0,-1},
-{ 1,-1, 0,-1, 1, 1,-1, 0,-1},
-{ 1,-1, 0,-1, 1, 1, 0,-1,-1},
-{ 1,-1, 0, 0,-1,-1, 0, 1, 0},
-{ 1,-1, 0, 0,-1,-1, 1, 0, 0},
-{ 1,-1, 0, 0,-1,-1, 1, 1, 1},
-{ 1,-1, 0, 0,-1, 1,-1,-1, 1},
-{ 1,-1, 0, 0,-1, 1,-1, 0, 0},
-{ 1,-1, 0, 0,-1, 1, 0,-1, 0},
-{ 1,-1, 0, 0, 0,-1, 0, 1,-1},
-{ 1,-1, 0, 0, 0,-1, 1, 0,-1},
-{ 1,-1, 0, 0, 0, 1,-1, 0,-1},
-{ 1,-1, 0, 0, 0, 1, 0,-1,-1},
-{ 1,-1, 0, 0, 1,-1, 1, 1,-1},
-{ 1,-1, 0, 0, 1, 1,-1,-1,-1},
-{ 1,-1, 0, 1,-1,-1, 0, 1, 1},
-{ 1,-1, 0, 1,-1,-1, 1, 0, 1},
-{ 1,-1, 0, 1,-1, 1,-1, 0, 1},
-{ 1,-1, 0, 1,-1, 1, 0,-1, 1},
-{ 1,-1, 1,-1, 0,-1, 1,-1, 0},
-{ 1,-1, 1,-1, 0,-1, 1, 1, 0},
-{ 1,-1, 1,-1, 0, 0, 0, 0,-1},
-{ 1,-1, 1,-1, 0, 1, 1,-1, 0},
-{ 1,-1, 1,-1, 1, 0,-1, 0,-1},
-{ 1,-1, 1,-1, 1, 0, 0,-1,-1},
-{ 1,-1, 1, 0,-1,-1, 1, 0, 1},
-{ 1,-1, 1, 0,-1, 0, 1, 0, 0},
-{ 1,-1, 1, 0, 1, 1,-1, 0,-1},
-{ 1,-1, 1, 1,-1, 0, 0, 1, 1},
-{ 1,-1, 1, 1,-1, 0, 1, 0, 1},
-{ 1,-1, 1, 1, 0,-1,-1, 1, 0},
-{ 1,-1, 1, 1, 0, 1,-1,-1, 0},
-{ 1,-1, 1, 1, 0, 1,-1, 1, 0},
-{ 1, 0,-1,-1,-1,-1, 0, 1, 1},
-{ 1, 0,-1,-1,-1, 0,-1, 0, 0},
-{ 1, 0,-1,-1,-1, 0,-1, 1, 1},
-{ 1, 0,-1,-1,-1, 0, 0, 1, 0},
-{ 1, 0,-1,-1, 0, 0, 0, 1,-1},
-{ 1, 0,-1,-1, 1,-1, 0, 1,-1},
-{ 1, 0,-1,-1, 1, 0, 1, 1,-1},
-{ 1, 0,-1, 0,-1,-1,-1, 0, 0},
-{ 1, 0,-1, 0,-1,-1,-1, 1, 1},
-{ 1, 0,-1, 0,-1,-1, 0, 1, 0},
-{ 1, 0,-1, 0,-1, 0,-1,-1, 0},
-{ 1, 0,-1, 0,-1, 0,-1, 1, 0},
-{ 1, 0,-1, 0,-1, 1,-1,-1, 1},
-{ 1, 0,-1, 0,-1, 1,-1, 0, 0},
-{ 1, 0,-1, 0,-1, 1, 0,-1, 0},
-{ 1, 0,-1, 0, 0,-1, 0, 1,-1},
-{ 1, 0,-1, 0, 0, 1, 0,-1,-1},
-{ 1, 0,-1, 0, 1,-1, 1, 1,-1},
-{ 1, 0,-1, 0, 1, 1, 1,-1,-1},
-{ 1, 0,-1, 1,-1, 0,-1,-1, 1},
-{ 1, 0,-1, 1,-1, 0,-1, 0, 0},
-{ 1, 0,-1, 1,-1, 0, 0,-1, 0},
-{ 1, 0,-1, 1,-1, 1, 0,-1, 1},
-{ 1, 0,-1, 1, 0, 0, 0,-1,-1},
-{ 1, 0,-1, 1, 1, 0, 1,-1,-1},
-{ 1, 0,-1, 1, 1, 1, 0,-1,-1},
-{ 1, 0, 0,-1,-1,-1, 0, 1, 0},
-{ 1, 0, 0,-1,-1, 1, 0,-1, 0},
-{ 1, 0, 0,-1, 0,-1, 0, 1,-1},
-{ 1, 0, 0,-1, 0, 1, 0,-1,-1},
-{ 1, 0, 0, 0,-1,-1,-1, 1, 0},
-{ 1, 0, 0, 0,-1,-1, 1, 1, 0},
-{ 1, 0, 0, 0,-1, 0, 0, 0,-1},
-{ 1, 0, 0, 0,-1, 1,-1,-1, 0},
-{ 1, 0, 0, 0,-1, 1, 1,-1, 0},
-{ 1, 0, 0, 0, 0,-1,-1, 1,-1},
-{ 1, 0, 0, 0, 0,-1, 1, 1,-1},
-{ 1, 0, 0, 0, 0, 1,-1,-1,-1},
-{ 1, 0, 0, 0, 0, 1, 1,-1,-1},
-{ 1, 0, 0, 1,-1,-1, 0, 1, 0},
-{ 1, 0, 0, 1,-1, 1, 0,-1, 0},
-{ 1, 0, 0, 1, 0,-1, 0, 1,-1},
-{ 1, 0, 0, 1, 0, 1, 0,-1,-1},
-{ 1, 0, 1,-1,-1, 0, 0,-1, 0},
-{ 1, 0, 1,-1,-1, 0, 1,-1, 1},
-{ 1, 0, 1,-1,-1, 0, 1, 0, 0},
-{ 1, 0, 1,-1,-1, 1, 0,-1, 1},
-{ 1, 0, 1,-1, 0, 0, 0,-1,-1},
-{ 1, 0, 1,-1, 1, 0,-1,-1,-1},
-{ 1, 0, 1,-1, 1, 1, 0,-1,-1},
-{ 1, 0, 1, 0,-1,-1, 0, 1, 0},
-{ 1, 0, 1, 0,-1,-1, 1, 0, 0},
-{ 1, 0, 1, 0,-1,-1, 1, 1, 1},
-{ 1, 0, 1, 0,-1, 0, 1,-1, 0},
-{ 1, 0, 1, 0,-1, 0, 1, 1, 0},
-{ 1, 0, 1, 0,-1, 1, 0,-1, 0},
-{ 1, 0, 1, 0,-1, 1, 1,-1, 1},
-{ 1, 0, 1, 0,-1, 1, 1, 0, 0},
-{ 1, 0, 1, 0, 0,-1, 0, 1,-1},
-{ 1, 0, 1, 0, 0, 1, 0,-1,-1},
-{ 1, 0, 1, 0, 1,-1,-1, 1,-1},
-{ 1, 0, 1, 0, 1, 1,-1,-1,-1},
-{ 1, 0, 1, 1,-1,-1, 0, 1, 1},
-{ 1, 0, 1, 1,-1, 0, 0, 1, 0},
-{ 1, 0, 1, 1,-1, 0, 1, 0, 0},
-{ 1, 0, 1, 1,-1, 0, 1, 1, 1},
-{ 1, 0, 1, 1, 0, 0, 0, 1,-1},
-{ 1, 0, 1, 1, 1,-1, 0, 1,-1},
-{ 1, 0, 1, 1, 1, 0,-1, 1,-1},
-{ 1, 1,-1,-1,-1, 0,-1, 0, 1},
-{ 1, 1,-1,-1,-1, 0, 0, 1, 1},
-{ 1, 1,-1,-1, 0,-1, 1, 1, 0},
-{ 1, 1,-1,-1, 0, 1, 1,-1, 0},
-{ 1, 1,-1,-1, 0, 1, 1, 1, 0},
-{ 1, 1,-1, 0,-1,-1,-1, 0, 1},
-{ 1, 1,-1, 0,-1, 0,-1, 0, 0},
-{ 1, 1,-1, 0, 1, 1, 1, 0,-1},
-{ 1, 1,-1, 1, 0,-1,-1,-1, 0},
-{ 1, 1,-1, 1, 0,-1,-1, 1, 0},
-{ 1, 1,-1, 1, 0, 0, 0, 0,-1},
-{ 1, 1,-1, 1, 0, 1,-1,-1, 0},
-{ 1, 1,-1, 1, 1, 0, 0,-1,-1},
-{ 1, 1,-1, 1, 1, 0, 1, 0,-1},
-{ 1, 1, 0,-1,-1,-1,-1, 0, 1},
-{ 1, 1, 0,-1,-1,-1, 0, 1, 1},
-{ 1, 1, 0,-1,-1, 1, 0,-1, 1},
-{ 1, 1, 0,-1,-1, 1, 1, 0, 1},
-{ 1, 1, 0, 0,-1,-1,-1, 0, 0},
-{ 1, 1, 0, 0,-1,-1,-1, 1, 1},
-{ 1, 1, 0, 0,-1,-1, 0, 1, 0},
-{ 1, 1, 0, 0,-1, 1, 0,-1, 0},
-{ 1, 1, 0, 0,-1, 1, 1,-1, 1},
-{ 1, 1, 0, 0,-1, 1, 1, 0, 0},
-{ 1, 1, 0, 0, 0,-1,-1, 0,-1},
-{ 1, 1, 0, 0, 0,-1, 0, 1,-1},
-{ 1, 1, 0, 0, 0, 1, 0,-1,-1},
-{ 1, 1, 0, 0, 0, 1, 1, 0,-1},
-{ 1, 1, 0, 0, 1,-1,-1, 1,-1},
-{ 1, 1, 0, 0, 1, 1, 1,-1,-1},
-{ 1, 1, 0, 1, 0,-1, 0, 0,-1},
-{ 1, 1, 0, 1, 0, 0,-1, 0,-1},
-{ 1, 1, 0, 1, 0, 0, 0,-1,-1},
-{ 1, 1, 0, 1, 0, 0, 0, 1,-1},
-{ 1, 1, 0, 1, 0, 0, 1, 0,-1},
-{ 1, 1, 0, 1, 0, 1, 0, 0,-1},
-{ 1, 1, 0, 1, 1,-1,-1, 0,-1},
-{ 1, 1, 0, 1, 1,-1, 0, 1,-1},
-{ 1, 1, 0, 1, 1, 1, 0,-1,-1},
-{ 1, 1, 0, 1, 1, 1, 1, 0,-1},
-{ 1, 1, 1,-1,-1, 0, 0,-1, 1},
-{ 1, 1, 1,-1,-1, 0, 1, 0, 1},
-{ 1, 1, 1,-1, 0,-1,-1,-1, 0},
-{ 1, 1, 1,-1, 0,-1,-1, 1, 0},
-{ 1, 1, 1,-1, 0, 1,-1,-1, 0},
-{ 1, 1, 1, 0,-1, 0, 1, 0, 0},
-{ 1, 1, 1, 0,-1, 1, 1, 0, 1},
-{ 1, 1, 1, 0, 1,-1,-1, 0,-1},
-{ 1, 1, 1, 1, 0,-1, 1, 1, 0},
-{ 1, 1, 1, 1, 0, 0, 0, 0,-1},
-{ 1, 1, 1, 1, 0, 1, 1,-1, 0},
-{ 1, 1, 1, 1, 0, 1, 1, 1, 0},
-{ 1, 1, 1, 1, 1, 0,-1, 0,-1},
-{ 1, 1, 1, 1, 1, 0, 0, 1,-1},
-{-1,-1,-1,-1, 1, 0, 0, 1, 0},
-{-1,-1,-1,-1, 1, 0, 1, 0, 0},
-{-1,-1,-1, 0, 0,-1, 0,-1, 1},
-{-1,-1,-1, 0, 0,-1, 1, 0, 1},
-{-1,-1,-1, 0, 0, 1,-1, 0, 1},
-{-1,-1,-1, 0, 0, 1, 0, 1, 1},
-{-1,-1,-1, 0, 1,-1, 0,-1, 0},
-{-1,-1,-1, 0, 1, 0, 1,-1, 0},
-{-1,-1,-1, 0, 1, 0, 1, 1, 0},
-{-1,-1,-1, 0, 1, 1, 0, 1, 0},
-{-1,-1,-1, 1, 0,-1, 0, 0, 1},
-{-1,-1,-1, 1, 0, 0,-1, 0, 1},
-{-1,-1,-1, 1, 0, 0, 1, 0, 1},
-{-1,-1,-1, 1, 0, 1, 0, 0, 1},
-{-1,-1,-1, 1, 1, 0, 0,-1, 0},
-{-1,-1,-1, 1, 1, 0, 1, 0, 0},
-{-1,-1, 0,-1, 1,-1, 0,-1, 0},
-{-1,-1, 0,-1, 1,-1, 1, 0, 0},
-{-1,-1, 0,-1, 1, 1,-1, 0, 0},
-{-1,-1, 0,-1, 1, 1, 0, 1, 0},
-{-1,-1, 0, 0,-1, 0, 0, 0, 1},
-{-1,-1, 0, 0, 0,-1, 0,-1, 0},
-{-1,-1, 0, 0, 0,-1, 1, 0, 0},
-{-1,-1, 0, 0, 0, 1,-1, 0, 0},
-{-1,-1, 0, 0, 0, 1, 0, 1, 0},
-{-1,-1, 0, 0, 1, 0, 0, 0,-1},
-{-1,-1, 0, 1, 0, 0,-1,-1, 1},
-{-1,-1, 0, 1, 0, 0,-1, 1, 1},
-{-1,-1, 0, 1, 0, 0, 1,-1, 1},
-{-1,-1, 0, 1, 0, 0, 1, 1, 1},
-{-1,-1, 0, 1, 1,-1, 0,-1, 0},
-{-1,-1, 0, 1, 1,-1, 1, 0, 0},
-{-1,-1, 0, 1, 1, 1,-1, 0, 0},
-{-1,-1, 0, 1, 1, 1, 0, 1, 0},
-{-1,-1, 1,-1, 1, 0,-1, 0, 0},
-{-1,-1, 1,-1, 1, 0, 0,-1, 0},
-{-1,-1, 1, 0, 0,-1, 0,-1, 1},
-{-1,-1, 1, 0, 0,-1, 1, 0, 1},
-{-1,-1, 1, 0, 0, 1,-1, 0, 1},
-{-1,-1, 1, 0, 0, 1, 0, 1, 1},
-{-1,-1, 1, 0, 1,-1, 0,-1, 0},
-{-1,-1, 1, 0, 1, 0,-1,-1, 0},
-{-1,-1, 1, 0, 1, 0,-1, 1, 0},
-{-1,-1, 1, 0, 1, 1, 0, 1, 0},
-{-1,-1, 1, 1, 0,-1, 0, 0, 1},
-{-1,-1, 1, 1, 0, 0,-1, 0, 1},
-{-1,-1, 1, 1, 0, 0, 1, 0, 1},
-{-1,-1, 1, 1, 0, 1, 0, 0, 1},
-{-1,-1, 1, 1, 1, 0,-1, 0, 0},
-{-1,-1, 1, 1, 1, 0, 0, 1, 0},
-{-1, 0,-1,-1, 0, 0,-1, 1, 1},
-{-1, 0,-1,-1, 0, 0, 0, 1, 0},
-{-1, 0,-1,-1, 0, 0, 1, 1, 1},
-{-1, 0,-1,-1, 1,-1, 1, 0, 0},
-{-1, 0,-1,-1, 1, 1, 1, 0, 0},
-{-1, 0,-1, 0,-1, 0, 0, 0, 1},
-{-1, 0,-1, 0, 0,-1,-1,-1, 1},
-{-1, 0,-1, 0, 0,-1, 0,-1, 0},
-{-1, 0,-1, 0, 0,-1, 1,-1, 1},
-{-1, 0,-1, 0, 0, 1,-1, 1, 1},
-{-1, 0,-1, 0, 0, 1, 0, 1, 0},
-{-1, 0,-1, 0, 0, 1, 1, 1, 1},
-{-1, 0,-1, 0, 1, 0, 0, 0,-1},
-{-1, 0,-1, 1, 0, 0,-1,-1, 1},
-{-1, 0,-1, 1, 0, 0, 0,-1, 0},
-{-1, 0,-1, 1, 0, 0, 1,-1, 1},
-{-1, 0,-1, 1, 1,-1, 1, 0, 0},
-{-1, 0,-1, 1, 1, 1, 1, 0, 0},
-{-1, 0, 0,-1,-1, 0, 0, 0, 1},
-{-1, 0, 0,-1, 0,-1,-1,-1, 1},
-{-1, 0, 0,-1, 0,-1, 0,-1, 0},
-{-1, 0, 0,-1, 0,-1, 1,-1, 1},
-{-1, 0, 0,-1, 0, 1,-1, 1, 1},
-{-1, 0, 0,-1, 0, 1, 0, 1, 0},
-{-1, 0, 0,-1, 0, 1, 1, 1, 1},
-{-1, 0, 0,-1, 1,-1,-1,-1, 0},
-{-1, 0, 0,-1, 1,-1, 1,-1, 0},
-{-1, 0, 0,-1, 1, 0, 0, 0,-1},
-{-1, 0, 0,-1, 1, 1,-1, 1, 0},
-{-1, 0, 0,-1, 1, 1, 1, 1, 0},
-{-1, 0, 0, 0,-1,-1, 0, 0, 1},
-{-1, 0, 0, 0,-1, 0,-1, 0, 1},
-{-1, 0, 0, 0,-1, 0, 0,-1, 1},
-{-1, 0, 0, 0,-1, 0, 0, 1, 1},
-{-1, 0, 0, 0,-1, 0, 1, 0, 1},
-{-1, 0, 0, 0,-1, 1, 0, 0, 1},
-{-1, 0, 0, 0, 0,-1,-1,-1, 0},
-{-1, 0, 0, 0, 0,-1, 1,-1, 0},
-{-1, 0, 0, 0, 0, 1,-1, 1, 0},
-{-1, 0, 0, 0, 0, 1, 1, 1, 0},
-{-1, 0, 0, 0, 1,-1, 0, 0,-1},
-{-1, 0, 0, 0, 1, 0,-1, 0,-1},
-{-1, 0, 0, 0, 1, 0, 0,-1,-1},
-{-1, 0, 0, 0, 1, 0, 0, 1,-1},
-{-1, 0, 0, 0, 1, 0, 1, 0,-1},
-{-1, 0, 0, 0, 1, 1, 0, 0,-1},
-{-1, 0, 0, 1,-1, 0, 0, 0, 1},
-{-1, 0, 0, 1, 0,-1,-1,-1, 1},
-{-1, 0, 0, 1, 0,-1, 0,-1, 0},
-{-1, 0, 0, 1, 0,-1, 1,-1, 1},
-{-1, 0, 0, 1, 0, 1,-1, 1, 1},
-{-1, 0, 0, 1, 0, 1, 0, 1, 0},
-{-1, 0, 0, 1, 0, 1, 1, 1, 1},
-{-1, 0, 0, 1, 1,-1,-1,-1, 0},
-{-1, 0, 0, 1, 1,-1, 1,-1, 0},
-{-1, 0, 0, 1, 1, 0, 0, 0,-1},
-{-1, 0, 0, 1, 1, 1,-1, 1, 0},
-{-1, 0, 0, 1, 1, 1, 1, 1, 0},
-{-1, 0, 1,-1, 0, 0,-1,-1, 1},
-{-1, 0, 1,-1, 0, 0, 0,-1, 0},
-{-1, 0, 1,-1, 0, 0, 1,-1, 1},
-{-1, 0, 1,-1, 1,-1,-1, 0, 0},
-{-1, 0, 1,-1, 1, 1,-1, 0, 0},
-{-1, 0, 1, 0,-1, 0, 0, 0, 1},
-{-1, 0, 1, 0, 0,-1,-1,-1, 1},
-{-1, 0, 1, 0, 0,-1, 0,-1, 0},
-{-1, 0, 1, 0, 0,-1, 1,-1, 1},
-{-1, 0, 1, 0, 0, 1,-1, 1, 1},
-{-1, 0, 1, 0, 0, 1, 0, 1, 0},
-{-1, 0, 1, 0, 0, 1, 1, 1, 1},
-{-1, 0, 1, 0, 1, 0, 0, 0,-1},
-{-1, 0, 1, 1, 0, 0,-1, 1, 1},
-{-1, 0, 1, 1, 0, 0, 0, 1, 0},
-{-1, 0, 1, 1, 0, 0, 1, 1, 1},
-{-1, 0, 1, 1, 1,-1,-1, 0, 0},
-{-1, 0, 1, 1, 1, 1,-1, 0, 0},
-{-1, 1,-1,-1, 0,-1, 0, 0, 1},
-{-1, 1,-1,-1, 0, 0,-1, 0, 1},
-{-1, 1,-1,-1, 0, 0, 1, 0, 1},
-{-1, 1,-1,-1, 0, 1, 0, 0, 1},
-{-1, 1,-1,-1, 1, 0, 0, 1, 0},
-{-1, 1,-1,-1, 1, 0, 1, 0, 0},
-{-1, 1,-1, 0, 0,-1,-1, 0, 1},
-{-1, 1,-1, 0, 0,-1, 0,-1, 1},
-{-1, 1,-1, 0, 0, 1, 0, 1, 1},
-{-1, 1,-1, 0, 0, 1, 1, 0, 1},
-{-1, 1,-1, 0, 1,-1, 0,-1, 0},
-{-1, 1,-1, 0, 1, 0, 1,-1, 0},
-{-1, 1,-1, 0, 1, 0, 1, 1, 0},
-{-1, 1,-1, 0, 1, 1, 0, 1, 0},
-{-1, 1,-1, 1, 1, 0, 0,-1, 0},
-{-1, 1,-1, 1, 1, 0, 1, 0, 0},
-{-1, 1, 0,-1, 0, 0,-1,-1, 1},
-{-1, 1, 0,-1, 0, 0,-1, 1, 1},
-{-1, 1, 0,-1, 0, 0, 1,-1, 1},
-{-1, 1, 0,-1, 0, 0, 1, 1, 1},
-{-1, 1, 0,-1, 1,-1,-1, 0, 0},
-{-1, 1, 0,-1, 1,-1, 0,-1, 0},
-{-1, 1, 0,-1, 1, 1, 0, 1, 0},
-{-1, 1, 0,-1, 1, 1, 1, 0, 0},
-{-1, 1, 0, 0,-1, 0, 0, 0, 1},
-{-1, 1, 0, 0, 0,-1,-1, 0, 0},
-{-1, 1, 0, 0, 0,-1, 0,-1, 0},
-{-1, 1, 0, 0, 0, 1, 0, 1, 0},
-{-1, 1, 0, 0, 0, 1, 1, 0, 0},
-{-1, 1, 0, 0, 1, 0, 0, 0,-1},
-{-1, 1, 0, 1, 1,-1,-1, 0, 0},
-{-1, 1, 0, 1, 1,-1, 0,-1, 0},
-{-1, 1, 0, 1, 1, 1, 0, 1, 0},
-{-1, 1, 0, 1, 1, 1, 1, 0, 0},
-{-1, 1, 1,-1, 0,-1, 0, 0, 1},
-{-1, 1, 1,-1, 0, 0,-1, 0, 1},
-{-1, 1, 1,-1, 0, 0, 1, 0, 1},
-{-1, 1, 1,-1, 0, 1, 0, 0, 1},
-{-1, 1, 1,-1, 1, 0,-1, 0, 0},
-{-1, 1, 1,-1, 1, 0, 0,-1, 0},
-{-1, 1, 1, 0, 0,-1,-1, 0, 1},
-{-1, 1, 1, 0, 0,-1, 0,-1, 1},
-{-1, 1, 1, 0, 0, 1, 0, 1, 1},
-{-1, 1, 1, 0, 0, 1, 1, 0, 1},
-{-1, 1, 1, 0, 1,-1, 0,-1, 0},
-{-1, 1, 1, 0, 1, 0,-1,-1, 0},
-{-1, 1, 1, 0, 1, 0,-1, 1, 0},
-{-1, 1, 1, 0, 1, 1, 0, 1, 0},
-{-1, 1, 1, 1, 1, 0,-1, 0, 0},
-{-1, 1, 1, 1, 1, 0, 0, 1, 0},
-{ 0,-1,-1,-1, 0, 0, 0, 0,-1},
-{ 0,-1,-1,-1, 1,-1, 0, 0,-1},
-{ 0,-1,-1,-1, 1, 1, 0, 0,-1},
-{ 0,-1,-1, 0,-1, 0,-1,-1, 1},
-{ 0,-1,-1, 0,-1, 0,-1, 0, 0},
-{ 0,-1,-1, 0,-1, 0,-1, 1, 1},
-{ 0,-1,-1, 0, 1, 0, 1,-1,-1},
-{ 0,-1,-1, 0, 1, 0, 1, 1,-1},
-{ 0,-1,-1, 1,-1,-1, 0, 0, 1},
-{ 0,-1,-1, 1,-1, 1, 0, 0, 1},
-{ 0,-1, 0,-1, 0,-1, 0, 0,-1},
-{ 0,-1, 0,-1, 0, 0,-1, 0,-1},
-{ 0,-1, 0,-1, 0, 0, 0,-1,-1},
-{ 0,-1, 0,-1, 0, 0, 0, 1,-1},
-{ 0,-1, 0,-1, 0, 0, 1, 0,-1},
-{ 0,-1, 0,-1, 0, 1, 0, 0,-1},
-{ 0,-1, 0,-1, 1,-1, 0,-1,-1},
-{ 0,-1, 0,-1, 1,-1, 0, 1,-1},
-{ 0,-1, 0,-1, 1, 0,-1,-1,-1},
-{ 0,-1, 0,-1, 1, 0,-1, 1,-1},
-{ 0,-1, 0,-1, 1, 0, 1,-1,-1},
-{ 0,-1, 0,-1, 1, 0, 1, 1,-1},
-{ 0,-1, 0,-1, 1, 1, 0,-1,-1},
-{ 0,-1, 0,-1, 1, 1, 0, 1,-1},
-{ 0,-1, 0, 0,-1,-1, 1,-1, 1},
-{ 0,-1, 0, 0,-1,-1, 1, 0, 0},
-{ 0,-1, 0, 0,-1,-1, 1, 1, 1},
-{ 0,-1, 0, 0,-1, 1,-1,-1, 1},
-{ 0,-1, 0, 0,-1, 1,-1, 0, 0},
-{ 0,-1, 0, 0,-1, 1,-1, 1, 1},
-{ 0,-1, 0, 0, 0,-1, 1, 0,-1},
-{ 0,-1, 0, 0, 0, 1,-1, 0,-1},
-{ 0,-1, 0, 0, 1,-1, 1,-1,-1},
-{ 0,-1, 0, 0, 1,-1, 1, 1,-1},
-{ 0,-1, 0, 0, 1, 1,-1,-1,-1},
-{ 0,-1, 0, 0, 1, 1,-1, 1,-1},
-{ 0,-1, 0, 1,-1,-1, 0,-1, 1},
-{ 0,-1, 0, 1,-1,-1, 0, 1, 1},
-{ 0,-1, 0, 1,-1, 0,-1,-1, 1},
-{ 0,-1, 0, 1,-1, 0,-1, 1, 1},
-{ 0,-1, 0, 1,-1, 0, 1,-1, 1},
-{ 0,-1, 0, 1,-1, 0, 1, 1, 1},
-{ 0,-1, 0, 1,-1, 1, 0,-1, 1},
-{ 0,-1, 0, 1,-1, 1, 0, 1, 1},
-{ 0,-1, 1,-1, 0, 0, 0, 0,-1},
-{ 0,-1, 1,-1, 1,-1, 0, 0,-1},
-{ 0,-1, 1,-1, 1, 1, 0, 0,-1},
-{ 0,-1, 1, 0,-1, 0, 1,-1, 1},
-{ 0,-1, 1, 0,-1, 0, 1, 0, 0},
-{ 0,-1, 1, 0,-1, 0, 1, 1, 1},
-{ 0,-1, 1, 0, 1, 0,-1,-1,-1},
-{ 0,-1, 1, 0, 1, 0,-1, 1,-1},
-{ 0,-1, 1, 1,-1,-1, 0, 0, 1},
-{ 0,-1, 1, 1,-1, 1, 0, 0, 1},
-{ 0, 0,-1,-1,-1,-1,-1, 0, 1},
-{ 0, 0,-1,-1,-1,-1, 0, 1, 1},
-{ 0, 0,-1,-1,-1, 0,-1, 0, 0},
-{ 0, 0,-1,-1,-1, 0, 0, 1, 0},
-{ 0, 0,-1,-1,-1, 1,-1, 0, 1},
-{ 0, 0,-1,-1,-1, 1, 0, 1, 1},
-{ 0, 0,-1,-1, 0, 0, 0, 1,-1},
-{ 0, 0,-1,-1, 1,-1, 0, 1,-1},
-{ 0, 0,-1,-1, 1,-1, 1, 0,-1},
-{ 0, 0,-1,-1, 1, 1, 0, 1,-1},
-{ 0, 0,-1,-1, 1, 1, 1, 0,-1},
-{ 0, 0,-1, 0,-1,-1,-1,-1, 1},
-{ 0, 0,-1, 0,-1,-1,-1, 0, 0},
-{ 0, 0,-1, 0,-1,-1,-1, 1, 1},
-{ 0, 0,-1, 0,-1, 0,-1,-1, 0},
-{ 0, 0,-1, 0,-1, 0,-1, 1, 0},
-{ 0, 0,-1, 0,-1, 1,-1,-1, 1},
-{ 0, 0,-1, 0,-1, 1,-1, 0, 0},
-{ 0, 0,-1, 0,-1, 1,-1, 1, 1},
-{ 0, 0,-1, 0, 1,-1, 1,-1,-1},
-{ 0, 0,-1, 0, 1,-1, 1, 1,-1},
-{ 0, 0,-1, 0, 1, 1, 1,-1,-1},
-{ 0, 0,-1, 0, 1, 1, 1, 1,-1},
-{ 0, 0,-1, 1,-1,-1,-1, 0, 1},
-{ 0, 0,-1, 1,-1,-1, 0,-1, 1},
-{ 0, 0,-1, 1,-1, 0,-1, 0, 0},
-{ 0, 0,-1, 1,-1, 0, 0,-1, 0},
-{ 0, 0,-1, 1,-1, 1,-1, 0, 1},
-{ 0, 0,-1, 1,-1, 1, 0,-1, 1},
-{ 0, 0,-1, 1, 0, 0, 0,-1,-1},
-{ 0, 0,-1, 1, 1,-1, 0,-1,-1},
-{ 0, 0,-1, 1, 1,-1, 1, 0,-1},
-{ 0, 0,-1, 1, 1, 1, 0,-1,-1},
-{ 0, 0,-1, 1, 1, 1, 1, 0,-1},
-{ 0, 0, 1,-1,-1,-1, 0,-1, 1},
-{ 0, 0, 1,-1,-1,-1, 1, 0, 1},
-{ 0, 0, 1,-1,-1, 0, 0,-1, 0},
-{ 0, 0, 1,-1,-1, 0, 1, 0, 0},
-{ 0, 0, 1,-1,-1, 1, 0,-1, 1},
-{ 0, 0, 1,-1,-1, 1, 1, 0, 1},
-{ 0, 0, 1,-1, 0, 0, 0,-1,-1},
-{ 0, 0, 1,-1, 1,-1,-1, 0,-1},
-{ 0, 0, 1,-1, 1,-1, 0,-1,-1},
-{ 0, 0, 1,-1, 1, 1,-1, 0,-1},
-{ 0, 0, 1,-1, 1, 1, 0,-1,-1},
-{ 0, 0, 1, 0,-1,-1, 1,-1, 1},
-{ 0, 0, 1, 0,-1,-1, 1, 0, 0},
-{ 0, 0, 1, 0,-1,-1, 1, 1, 1},
-{ 0, 0, 1, 0,-1, 0, 1,-1, 0},
-{ 0, 0, 1, 0,-1, 0, 1, 1, 0},
-{ 0, 0, 1, 0,-1, 1, 1,-1, 1},
-{ 0, 0, 1, 0,-1, 1, 1, 0, 0},
-{ 0, 0, 1, 0,-1, 1, 1, 1, 1},
-{ 0, 0, 1, 0, 1,-1,-1,-1,-1},
-{ 0, 0, 1, 0, 1,-1,-1, 1,-1},
-{ 0, 0, 1, 0, 1, 1,-1,-1,-1},
-{ 0, 0, 1, 0, 1, 1,-1, 1,-1},
-{ 0, 0, 1, 1,-1,-1, 0, 1, 1},
-{ 0, 0, 1, 1,-1,-1, 1, 0, 1},
-{ 0, 0, 1, 1,-1, 0, 0, 1, 0},
-{ 0, 0, 1, 1,-1, 0, 1, 0, 0},
-{ 0, 0, 1, 1,-1, 1, 0, 1, 1},
-{ 0, 0, 1, 1,-1, 1, 1, 0, 1},
-{ 0, 0, 1, 1, 0, 0, 0, 1,-1},
-{ 0, 0, 1, 1, 1,-1,-1, 0,-1},
-{ 0, 0, 1, 1, 1,-1, 0, 1,-1},
-{ 0, 0, 1, 1, 1, 1,-1, 0,-1},
-{ 0, 0, 1, 1, 1, 1, 0, 1,-1},
-{ 0, 1,-1,-1,-1,-1, 0, 0, 1},
-{ 0, 1,-1,-1,-1, 1, 0, 0, 1},
-{ 0, 1,-1, 0,-1, 0,-1,-1, 1},
-{ 0, 1,-1, 0,-1, 0,-1, 0, 0},
-{ 0, 1,-1, 0,-1, 0,-1, 1, 1},
-{ 0, 1,-1, 0, 1, 0, 1,-1,-1},
-{ 0, 1,-1, 0, 1, 0, 1, 1,-1},
-{ 0, 1,-1, 1, 0, 0, 0, 0,-1},
-{ 0, 1,-1, 1, 1,-1, 0, 0,-1},
-{ 0, 1,-1, 1, 1, 1, 0, 0,-1},
-{ 0, 1, 0,-1,-1,-1, 0,-1, 1},
-{ 0, 1, 0,-1,-1,-1, 0, 1, 1},
-{ 0, 1, 0,-1,-1, 0,-1,-1, 1},
-{ 0, 1, 0,-1,-1, 0,-1, 1, 1},
-{ 0, 1, 0,-1,-1, 0, 1,-1, 1},
-{ 0, 1, 0,-1,-1, 0, 1, 1, 1},
-{ 0, 1, 0,-1,-1, 1, 0,-1, 1},
-{ 0, 1, 0,-1,-1, 1, 0, 1, 1},
-{ 0, 1, 0, 0,-1,-1,-1,-1, 1},
-{ 0, 1, 0, 0,-1,-1,-1, 0, 0},
-{ 0, 1, 0, 0,-1,-1,-1, 1, 1},
-{ 0, 1, 0, 0,-1, 1, 1,-1, 1},
-{ 0, 1, 0, 0,-1, 1, 1, 0, 0},
-{ 0, 1, 0, 0,-1, 1, 1, 1, 1},
-{ 0, 1, 0, 0, 0,-1,-1, 0,-1},
-{ 0, 1, 0, 0, 0, 1, 1, 0,-1},
-{ 0, 1, 0, 0, 1,-1,-1,-1,-1},
-{ 0, 1, 0, 0, 1,-1,-1, 1,-1},
-{ 0, 1, 0, 0, 1, 1, 1,-1,-1},
-{ 0, 1, 0, 0, 1, 1, 1, 1,-1},
-{ 0, 1, 0, 1, 0,-1, 0, 0,-1},
-{ 0, 1, 0, 1, 0, 0,-1, 0,-1},
-{ 0, 1, 0, 1, 0, 0, 0,-1,-1},
-{ 0, 1, 0, 1, 0, 0, 0, 1,-1},
-{ 0, 1, 0, 1, 0, 0, 1, 0,-1},
-{ 0, 1, 0, 1, 0, 1, 0, 0,-1},
-{ 0, 1, 0, 1, 1,-1, 0,-1,-1},
-{ 0, 1, 0, 1, 1,-1, 0, 1,-1},
-{ 0, 1, 0, 1, 1, 0,-1,-1,-1},
-{ 0, 1, 0, 1, 1, 0,-1, 1,-1},
-{ 0, 1, 0, 1, 1, 0, 1,-1,-1},
-{ 0, 1, 0, 1, 1, 0, 1, 1,-1},
-{ 0, 1, 0, 1, 1, 1, 0,-1,-1},
-{ 0, 1, 0, 1, 1, 1, 0, 1,-1},
-{ 0, 1, 1,-1,-1,-1, 0, 0, 1},
-{ 0, 1, 1,-1,-1, 1, 0, 0, 1},
-{ 0, 1, 1, 0,-1, 0, 1,-1, 1},
-{ 0, 1, 1, 0,-1, 0, 1, 0, 0},
-{ 0, 1, 1, 0,-1, 0, 1, 1, 1},
-{ 0, 1, 1, 0, 1, 0,-1,-1,-1},
-{ 0, 1, 1, 0, 1, 0,-1, 1,-1},
-{ 0, 1, 1, 1, 0, 0, 0, 0,-1},
-{ 0, 1, 1, 1, 1,-1, 0, 0,-1},
-{ 0, 1, 1, 1, 1, 1, 0, 0,-1},
-{ 1,-1,-1,-1,-1, 0,-1, 0, 0},
-{ 1,-1,-1,-1,-1, 0, 0, 1, 0},
-{ 1,-1,-1,-1, 0,-1, 0, 0,-1},
-{ 1,-1,-1,-1, 0, 0,-1, 0,-1},
-{ 1,-1,-1,-1, 0, 0, 1, 0,-1},
-{ 1,-1,-1,-1, 0, 1, 0, 0,-1},
-{ 1,-1,-1, 0,-1,-1, 0, 1, 0},
-{ 1,-1,-1, 0,-1, 0,-1,-1, 0},
-{ 1,-1,-1, 0,-1, 0,-1, 1, 0},
-{ 1,-1,-1, 0,-1, 1, 0,-1, 0},
-{ 1,-1,-1, 0, 0,-1, 0, 1,-1},
-{ 1,-1,-1, 0, 0,-1, 1, 0,-1},
-{ 1,-1,-1, 0, 0, 1,-1, 0,-1},
-{ 1,-1,-1, 0, 0, 1, 0,-1,-1},
-{ 1,-1,-1, 1,-1, 0,-1, 0, 0},
-{ 1,-1,-1, 1,-1, 0, 0,-1, 0},
-{ 1,-1, 0,-1,-1,-1, 0, 1, 0},
-{ 1,-1, 0,-1,-1,-1, 1, 0, 0},
-{ 1,-1, 0,-1,-1, 1,-1, 0, 0},
-{ 1,-1, 0,-1,-1, 1, 0,-1, 0},
-{ 1,-1, 0,-1, 0, 0,-1,-1,-1},
-{ 1,-1, 0,-1, 0, 0,-1, 1,-1},
-{ 1,-1, 0,-1, 0, 0, 1,-1,-1},
-{ 1,-1, 0,-1, 0, 0, 1, 1,-1},
-{ 1,-1, 0, 0,-1, 0, 0, 0,-1},
-{ 1,-1, 0, 1,-1,-1, 0, 1, 0},
-{ 1,-1, 0, 1,-1,-1, 1, 0, 0},
-{ 1,-1, 0, 1,-1, 1,-1, 0, 0},
-{ 1,-1, 0, 1,-1, 1, 0,-1, 0},
-{ 1,-1, 1,-1,-1, 0, 0,-1, 0},
-{ 1,-1, 1,-1,-1, 0, 1, 0, 0},
-{ 1,-1, 1,-1, 0,-1, 0, 0,-1},
-{ 1,-1, 1,-1, 0, 0,-1, 0,-1},
-{ 1,-1, 1,-1, 0, 0, 1, 0,-1},
-{ 1,-1, 1,-1, 0, 1, 0, 0,-1},
-{ 1,-1, 1, 0,-1,-1, 0, 1, 0},
-{ 1,-1, 1, 0,-1, 0, 1,-1, 0},
-{ 1,-1, 1, 0,-1, 0, 1, 1, 0},
-{ 1,-1, 1, 0,-1, 1, 0,-1, 0},
-{ 1,-1, 1, 0, 0,-1, 0, 1,-1},
-{ 1,-1, 1, 0, 0,-1, 1, 0,-1},
-{ 1,-1, 1, 0, 0, 1,-1, 0,-1},
-{ 1,-1, 1, 0, 0, 1, 0,-1,-1},
-{ 1,-1, 1, 1,-1, 0, 0, 1, 0},
-{ 1,-1, 1, 1,-1, 0, 1, 0, 0},
-{ 1, 0,-1,-1,-1,-1,-1, 0, 0},
-{ 1, 0,-1,-1,-1, 1,-1, 0, 0},
-{ 1, 0,-1,-1, 0, 0,-1, 1,-1},
-{ 1, 0,-1,-1, 0, 0, 1, 1,-1},
-{ 1, 0,-1, 0,-1, 0, 0, 0,-1},
-{ 1, 0,-1, 0, 0,-1,-1, 1,-1},
-{ 1, 0,-1, 0, 0,-1, 1, 1,-1},
-{ 1, 0,-1, 0, 0, 1,-1,-1,-1},
-{ 1, 0,-1, 0, 0, 1, 1,-1,-1},
-{ 1, 0,-1, 1,-1,-1,-1, 0, 0},
-{ 1, 0,-1, 1,-1, 1,-1, 0, 0},
-{ 1, 0,-1, 1, 0, 0,-1,-1,-1},
-{ 1, 0,-1, 1, 0, 0, 1,-1,-1},
-{ 1, 0, 0,-1,-1,-1,-1, 1, 0},
-{ 1, 0, 0,-1,-1,-1, 1, 1, 0},
-{ 1, 0, 0,-1,-1, 0, 0, 0,-1},
-{ 1, 0, 0,-1,-1, 1,-1,-1, 0},
-{ 1, 0, 0,-1,-1, 1, 1,-1, 0},
-{ 1, 0, 0,-1, 0,-1,-1, 1,-1},
-{ 1, 0, 0,-1, 0,-1, 1, 1,-1},
-{ 1, 0, 0,-1, 0, 1,-1,-1,-1},
-{ 1, 0, 0,-1, 0, 1, 1,-1,-1},
-{ 1, 0, 0, 0,-1,-1, 0, 0,-1},
-{ 1, 0, 0, 0,-1, 0,-1, 0,-1},
-{ 1, 0, 0, 0,-1, 0, 0,-1,-1},
-{ 1, 0, 0, 0,-1, 0, 0, 1,-1},
-{ 1, 0, 0, 0,-1, 0, 1, 0,-1},
-{ 1, 0, 0, 0,-1, 1, 0, 0,-1},
-{ 1, 0, 0, 1,-1,-1,-1, 1, 0},
-{ 1, 0, 0, 1,-1,-1, 1, 1, 0},
-{ 1, 0, 0, 1,-1, 0, 0, 0,-1},
-{ 1, 0, 0, 1,-1, 1,-1,-1, 0},
-{ 1, 0, 0, 1,-1, 1, 1,-1, 0},
-{ 1, 0, 0, 1, 0,-1,-1, 1,-1},
-{ 1, 0, 0, 1, 0,-1, 1, 1,-1},
-{ 1, 0, 0, 1, 0, 1,-1,-1,-1},
-{ 1, 0, 0, 1, 0, 1, 1,-1,-1},
-{ 1, 0, 1,-1,-1,-1, 1, 0, 0},
-{ 1, 0, 1,-1,-1, 1, 1, 0, 0},
-{ 1, 0, 1,-1, 0, 0,-1,-1,-1},
-{ 1, 0, 1,-1, 0, 0, 1,-1,-1},
-{ 1, 0, 1, 0,-1, 0, 0, 0,-1},
-{ 1, 0, 1, 0, 0,-1,-1, 1,-1},
-{ 1, 0, 1, 0, 0,-1, 1, 1,-1},
-{ 1, 0, 1, 0, 0, 1,-1,-1,-1},
-{ 1, 0, 1, 0, 0, 1, 1,-1,-1},
-{ 1, 0, 1, 1,-1,-1, 1, 0, 0},
-{ 1, 0, 1, 1,-1, 1, 1, 0, 0},
-{ 1, 0, 1, 1, 0, 0,-1, 1,-1},
-{ 1, 0, 1, 1, 0, 0, 1, 1,-1},
-{ 1, 1,-1,-1,-1, 0,-1, 0, 0},
-{ 1, 1,-1,-1,-1, 0, 0, 1, 0},
-{ 1, 1,-1, 0,-1,-1, 0, 1, 0},
-{ 1, 1,-1, 0,-1, 0,-1,-1, 0},
-{ 1, 1,-1, 0,-1, 0,-1, 1, 0},
-{ 1, 1,-1, 0,-1, 1, 0,-1, 0},
-{ 1, 1,-1, 0, 0,-1,-1, 0,-1},
-{ 1, 1,-1, 0, 0,-1, 0, 1,-1},
-{ 1, 1,-1, 0, 0, 1, 0,-1,-1},
-{ 1, 1,-1, 0, 0, 1, 1, 0,-1},
-{ 1, 1,-1, 1,-1, 0,-1, 0, 0},
-{ 1, 1,-1, 1,-1, 0, 0,-1, 0},
-{ 1, 1,-1, 1, 0,-1, 0, 0,-1},
-{ 1, 1,-1, 1, 0, 0,-1, 0,-1},
-{ 1, 1,-1, 1, 0, 0, 1, 0,-1},
-{ 1, 1,-1, 1, 0, 1, 0, 0,-1},
-{ 1, 1, 0,-1,-1,-1,-1, 0, 0},
-{ 1, 1, 0,-1,-1,-1, 0, 1, 0},
-{ 1, 1, 0,-1,-1, 1, 0,-1, 0},
-{ 1, 1, 0,-1,-1, 1, 1, 0, 0},
-{ 1, 1, 0, 0,-1, 0, 0, 0,-1},
-{ 1, 1, 0, 1,-1,-1,-1, 0, 0},
-{ 1, 1, 0, 1,-1,-1, 0, 1, 0},
-{ 1, 1, 0, 1,-1, 1, 0,-1, 0},
-{ 1, 1, 0, 1,-1, 1, 1, 0, 0},
-{ 1, 1, 0, 1, 0, 0,-1,-1,-1},
-{ 1, 1, 0, 1, 0, 0,-1, 1,-1},
-{ 1, 1, 0, 1, 0, 0, 1,-1,-1},
-{ 1, 1, 0, 1, 0, 0, 1, 1,-1},
-{ 1, 1, 1,-1,-1, 0, 0,-1, 0},
-{ 1, 1, 1,-1,-1, 0, 1, 0, 0},
-{ 1, 1, 1, 0,-1,-1, 0, 1, 0},
-{ 1, 1, 1, 0,-1, 0, 1,-1, 0},
-{ 1, 1, 1, 0,-1, 0, 1, 1, 0},
-{ 1, 1, 1, 0,-1, 1, 0,-1, 0},
-{ 1, 1, 1, 0, 0,-1,-1, 0,-1},
-{ 1, 1, 1, 0, 0,-1, 0, 1,-1},
-{ 1, 1, 1, 0, 0, 1, 0,-1,-1},
-{ 1, 1, 1, 0, 0, 1, 1, 0,-1},
-{ 1, 1, 1, 1,-1, 0, 0, 1, 0},
-{ 1, 1, 1, 1,-1, 0, 1, 0, 0},
-{ 1, 1, 1, 1, 0,-1, 0, 0,-1},
-{ 1, 1, 1, 1, 0, 0,-1, 0,-1},
-{ 1, 1, 1, 1, 0, 0, 1, 0,-1},
-{ 1, 1, 1, 1, 0, 1, 0, 0,-1},
-{-1,-1,-1,-1, 0, 0, 0, 1, 0},
-{-1,-1,-1,-1, 0, 1, 0, 1, 1},
-{-1,-1,-1, 0,-1, 0, 0, 0, 1},
-{-1,-1,-1, 0, 0,-1, 0,-1, 0},
-{-1,-1,-1, 0, 0,-1, 1, 0, 0},
-{-1,-1,-1, 0, 0, 1,-1, 0, 0},
-{-1,-1,-1, 0, 0, 1, 0, 1, 0},
-{-1,-1,-1, 0, 1,-1, 1, 1, 0},
-{-1,-1,-1, 0, 1, 0, 0, 0,-1},
-{-1,-1,-1, 0, 1, 1,-1, 1, 0},
-{-1,-1,-1, 0, 1, 1, 1, 1, 0},
-{-1,-1,-1, 1, 0, 0, 0,-1, 0},
-{-1,-1,-1, 1, 0, 1, 0,-1, 1},
-{-1,-1,-1, 1, 0, 1, 0, 1, 1},
-{-1,-1, 0,-1, 0,-1, 0,-1, 0},
-{-1,-1, 0,-1, 0,-1, 1,-1, 1},
-{-1,-1, 0,-1, 0,-1, 1, 0, 0},
-{-1,-1, 0,-1, 0, 1,-1, 0, 0},
-{-1,-1, 0,-1, 0, 1,-1, 1, 1},
-{-1,-1, 0,-1, 0, 1, 0, 1, 0},
-{-1,-1, 0, 0,-1,-1, 0, 0, 1},
-{-1,-1, 0, 0,-1, 0,-1, 0, 1},
-{-1,-1, 0, 0,-1, 0, 0,-1, 1},
-{-1,-1, 0, 0,-1, 0, 0, 1, 1},
-{-1,-1, 0, 0,-1, 0, 1, 0, 1},
-{-1,-1, 0, 0,-1, 1, 0, 0, 1},
-{-1,-1, 0, 0, 1,-1, 0, 0,-1},
-{-1,-1, 0, 0, 1, 0,-1, 0,-1},
-{-1,-1, 0, 0, 1, 0, 0,-1,-1},
-{-1,-1, 0, 0, 1, 0, 0, 1,-1},
-{-1,-1, 0, 0, 1, 0, 1, 0,-1},
-{-1,-1, 0, 0, 1, 1, 0, 0,-1},
-{-1,-1, 0, 1, 0,-1,-1,-1, 1},
-{-1,-1, 0, 1, 0,-1, 0,-1, 0},
-{-1,-1, 0, 1, 0,-1, 1, 0, 0},
-{-1,-1, 0, 1, 0,-1, 1, 1, 1},
-{-1,-1, 0, 1, 0, 1,-1,-1, 1},
-{-1,-1, 0, 1, 0, 1,-1, 0, 0},
-{-1,-1, 0, 1, 0, 1, 0, 1, 0},
-{-1,-1, 0, 1, 0, 1, 1, 1, 1},
-{-1,-1, 1,-1, 0,-1, 0,-1, 1},
-{-1,-1, 1,-1, 0, 0, 0,-1, 0},
-{-1,-1, 1, 0,-1, 0, 0, 0, 1},
-{-1,-1, 1, 0, 0,-1, 0,-1, 0},
-{-1,-1, 1, 0, 0,-1, 1, 0, 0},
-{-1,-1, 1, 0, 0, 1,-1, 0, 0},
-{-1,-1, 1, 0, 0, 1, 0, 1, 0},
-{-1,-1, 1, 0, 1,-1,-1,-1, 0},
-{-1,-1, 1, 0, 1,-1, 1,-1, 0},
-{-1,-1, 1, 0, 1, 0, 0, 0,-1},
-{-1,-1, 1, 0, 1, 1,-1,-1, 0},
-{-1,-1, 1, 1, 0,-1, 0,-1, 1},
-{-1,-1, 1, 1, 0,-1, 0, 1, 1},
-{-1,-1, 1, 1, 0, 0, 0, 1, 0},
-{-1, 0,-1,-1,-1, 0, 0, 0, 1},
-{-1, 0,-1,-1, 0, 0,-1, 1, 0},
-{-1, 0,-1,-1, 0, 0, 1, 1, 0},
-{-1, 0,-1,-1, 1,-1, 1,-1, 0},
-{-1, 0,-1,-1, 1,-1, 1, 1, 0},
-{-1, 0,-1,-1, 1, 0, 0, 0,-1},
-{-1, 0,-1,-1, 1, 1,-1, 1, 0},
-{-1, 0,-1, 0,-1,-1, 0, 0, 1},
-{-1, 0,-1, 0,-1, 0, 0,-1, 1},
-{-1, 0,-1, 0,-1, 0, 0, 1, 1},
-{-1, 0,-1, 0,-1, 1, 0, 0, 1},
-{-1, 0,-1, 0, 0,-1,-1,-1, 0},
-{-1, 0,-1, 0, 0,-1, 1,-1, 0},
-{-1, 0,-1, 0, 0, 1,-1, 1, 0},
-{-1, 0,-1, 0, 0, 1, 1, 1, 0},
-{-1, 0,-1, 0, 1,-1, 0, 0,-1},
-{-1, 0,-1, 0, 1, 0, 0,-1,-1},
-{-1, 0,-1, 0, 1, 0, 0, 1,-1},
-{-1, 0,-1, 0, 1, 1, 0, 0,-1},
-{-1, 0,-1, 1,-1, 0, 0, 0, 1},
-{-1, 0,-1, 1, 0, 0,-1,-1, 0},
-{-1, 0,-1, 1, 0, 0, 1,-1, 0},
-{-1, 0,-1, 1, 1,-1,-1,-1, 0},
-{-1, 0,-1, 1, 1, 0, 0, 0,-1},
-{-1, 0,-1, 1, 1, 1, 1,-1, 0},
-{-1, 0,-1, 1, 1, 1, 1, 1, 0},
-{-1, 0, 0,-1,-1,-1, 0, 0, 1},
-{-1, 0, 0,-1,-1, 0,-1, 0, 1},
-{-1, 0, 0,-1,-1, 0, 0,-1, 1},
-{-1, 0, 0,-1,-1, 0, 0, 1, 1},
-{-1, 0, 0,-1,-1, 0, 1, 0, 1},
-{-1, 0, 0,-1,-1, 1, 0, 0, 1},
-{-1, 0, 0,-1, 0,-1,-1,-1, 0},
-{-1, 0, 0,-1, 0,-1, 1,-1, 0},
-{-1, 0, 0,-1, 0, 1,-1, 1, 0},
-{-1, 0, 0,-1, 0, 1, 1, 1, 0},
-{-1, 0, 0,-1, 1,-1, 0, 0,-1},
-{-1, 0, 0,-1, 1, 0,-1, 0,-1},
-{-1, 0, 0,-1, 1, 0, 0,-1,-1},
-{-1, 0, 0,-1, 1, 0, 0, 1,-1},
-{-1, 0, 0,-1, 1, 0, 1, 0,-1},
-{-1, 0, 0,-1, 1, 1, 0, 0,-1},
-{-1, 0, 0, 0,-1,-1,-1, 0, 1},
-{-1, 0, 0, 0,-1,-1, 1, 0, 1},
-{-1, 0, 0, 0,-1, 0,-1,-1, 1},
-{-1, 0, 0, 0,-1, 0,-1, 1, 1},
-{-1, 0, 0, 0,-1, 0, 1,-1, 1},
-{-1, 0, 0, 0,-1, 0, 1, 1, 1},
-{-1, 0, 0, 0,-1, 1,-1, 0, 1},
-{-1, 0, 0, 0,-1, 1, 1, 0, 1},
-{-1, 0, 0, 0, 1,-1,-1, 0,-1},
-{-1, 0, 0, 0, 1,-1, 1, 0,-1},
-{-1, 0, 0, 0, 1, 0,-1,-1,-1},
-{-1, 0, 0, 0, 1, 0,-1, 1,-1},
-{-1, 0, 0, 0, 1, 0, 1,-1,-1},
-{-1, 0, 0, 0, 1, 0, 1, 1,-1},
-{-1, 0, 0, 0, 1, 1,-1, 0,-1},
-{-1, 0, 0, 0, 1, 1, 1, 0,-1},
-{-1, 0, 0, 1,-1,-1, 0, 0, 1},
-{-1, 0, 0, 1,-1, 0,-1, 0, 1},
-{-1, 0, 0, 1,-1, 0, 0,-1, 1},
-{-1, 0, 0, 1,-1, 0, 0, 1, 1},
-{-1, 0, 0, 1,-1, 0, 1, 0, 1},
-{-1, 0, 0, 1,-1, 1, 0, 0, 1},
-{-1, 0, 0, 1, 0,-1,-1,-1, 0},
-{-1, 0, 0, 1, 0,-1, 1,-1, 0},
-{-1, 0, 0, 1, 0, 1,-1, 1, 0},
-{-1, 0, 0, 1, 0, 1, 1, 1, 0},
-{-1, 0, 0, 1, 1,-1, 0, 0,-1},
-{-1, 0, 0, 1, 1, 0,-1, 0,-1},
-{-1, 0, 0, 1, 1, 0, 0,-1,-1},
-{-1, 0, 0, 1, 1, 0, 0, 1,-1},
-{-1, 0, 0, 1, 1, 0, 1, 0,-1},
-{-1, 0, 0, 1, 1, 1, 0, 0,-1},
-{-1, 0, 1,-1,-1, 0, 0, 0, 1},
-{-1, 0, 1,-1, 0, 0,-1,-1, 0},
-{-1, 0, 1,-1, 0, 0, 1,-1, 0},
-{-1, 0, 1,-1, 1,-1, 1,-1, 0},
-{-1, 0, 1,-1, 1, 0, 0, 0,-1},
-{-1, 0, 1,-1, 1, 1,-1,-1, 0},
-{-1, 0, 1,-1, 1, 1,-1, 1, 0},
-{-1, 0, 1, 0,-1,-1, 0, 0, 1},
-{-1, 0, 1, 0,-1, 0, 0,-1, 1},
-{-1, 0, 1, 0,-1, 0, 0, 1, 1},
-{-1, 0, 1, 0,-1, 1, 0, 0, 1},
-{-1, 0, 1, 0, 0,-1,-1,-1, 0},
-{-1, 0, 1, 0, 0,-1, 1,-1, 0},
-{-1, 0, 1, 0, 0, 1,-1, 1, 0},
-{-1, 0, 1, 0, 0, 1, 1, 1, 0},
-{-1, 0, 1, 0, 1,-1, 0, 0,-1},
-{-1, 0, 1, 0, 1, 0, 0,-1,-1},
-{-1, 0, 1, 0, 1, 0, 0, 1,-1},
-{-1, 0, 1, 0, 1, 1, 0, 0,-1},
-{-1, 0, 1, 1,-1, 0, 0, 0, 1},
-{-1, 0, 1, 1, 0, 0,-1, 1, 0},
-{-1, 0, 1, 1, 0, 0, 1, 1, 0},
-{-1, 0, 1, 1, 1,-1,-1,-1, 0},
-{-1, 0, 1, 1, 1,-1,-1, 1, 0},
-{-1, 0, 1, 1, 1, 0, 0, 0,-1},
-{-1, 0, 1, 1, 1, 1, 1, 1, 0},
-{-1, 1,-1,-1, 0,-1, 0,-1, 1},
-{-1, 1,-1,-1, 0,-1, 0, 1, 1},
-{-1, 1,-1,-1, 0, 0, 0, 1, 0},
-{-1, 1,-1, 0,-1, 0, 0, 0, 1},
-{-1, 1,-1, 0, 0,-1,-1, 0, 0},
-{-1, 1,-1, 0, 0,-1, 0,-1, 0},
-{-1, 1,-1, 0, 0, 1, 0, 1, 0},
-{-1, 1,-1, 0, 0, 1, 1, 0, 0},
-{-1, 1,-1, 0, 1,-1,-1,-1, 0},
-{-1, 1,-1, 0, 1,-1, 1,-1, 0},
-{-1, 1,-1, 0, 1, 0, 0, 0,-1},
-{-1, 1,-1, 0, 1, 1, 1,-1, 0},
-{-1, 1,-1, 1, 0,-1, 0,-1, 1},
-{-1, 1,-1, 1, 0, 0, 0,-1, 0},
-{-1, 1, 0,-1, 0,-1,-1, 0, 0},
-{-1, 1, 0,-1, 0,-1,-1, 1, 1},
-{-1, 1, 0,-1, 0,-1, 0,-1, 0},
-{-1, 1, 0,-1, 0,-1, 1,-1, 1},
-{-1, 1, 0,-1, 0, 1,-1, 1, 1},
-{-1, 1, 0,-1, 0, 1, 0, 1, 0},
-{-1, 1, 0,-1, 0, 1, 1,-1, 1},
-{-1, 1, 0,-1, 0, 1, 1, 0, 0},
-{-1, 1, 0, 0,-1,-1, 0, 0, 1},
-{-1, 1, 0, 0,-1, 0,-1, 0, 1},
-{-1, 1, 0, 0,-1, 0, 0,-1, 1},
-{-1, 1, 0, 0,-1, 0, 0, 1, 1},
-{-1, 1, 0, 0,-1, 0, 1, 0, 1},
-{-1, 1, 0, 0,-1, 1, 0, 0, 1},
-{-1, 1, 0, 0, 1,-1, 0, 0,-1},
-{-1, 1, 0, 0, 1, 0,-1, 0,-1},
-{-1, 1, 0, 0, 1, 0, 0,-1,-1},
-{-1, 1, 0, 0, 1, 0, 0, 1,-1},
-{-1, 1, 0, 0, 1, 0, 1, 0,-1},
-{-1, 1, 0, 0, 1, 1, 0, 0,-1},
-{-1, 1, 0, 1, 0,-1,-1,-1, 1},
-{-1, 1, 0, 1, 0,-1,-1, 0, 0},
-{-1, 1, 0, 1, 0,-1, 0,-1, 0},
-{-1, 1, 0, 1, 0, 1, 0, 1, 0},
-{-1, 1, 0, 1, 0, 1, 1, 0, 0},
-{-1, 1, 0, 1, 0, 1, 1, 1, 1},
-{-1, 1, 1,-1, 0, 0, 0,-1, 0},
-{-1, 1, 1,-1, 0, 1, 0,-1, 1},
-{-1, 1, 1,-1, 0, 1, 0, 1, 1},
-{-1, 1, 1, 0,-1, 0, 0, 0, 1},
-{-1, 1, 1, 0, 0,-1,-1, 0, 0},
-{-1, 1, 1, 0, 0,-1, 0,-1, 0},
-{-1, 1, 1, 0, 0, 1, 0, 1, 0},
-{-1, 1, 1, 0, 0, 1, 1, 0, 0},
-{-1, 1, 1, 0, 1,-1,-1, 1, 0},
-{-1, 1, 1, 0, 1, 0, 0, 0,-1},
-{-1, 1, 1, 0, 1, 1,-1, 1, 0},
-{-1, 1, 1, 0, 1, 1, 1, 1, 0},
-{-1, 1, 1, 1, 0, 0, 0, 1, 0},
-{-1, 1, 1, 1, 0, 1, 0, 1, 1},
-{ 0,-1,-1,-1,-1, 0,-1, 0, 0},
-{ 0,-1,-1,-1,-1, 0,-1, 1, 1},
-{ 0,-1,-1,-1,-1, 0, 0, 1, 0},
-{ 0,-1,-1,-1,-1, 1,-1, 0, 1},
-{ 0,-1,-1,-1, 0,-1, 0, 0,-1},
-{ 0,-1,-1,-1, 0, 0,-1, 0,-1},
-{ 0,-1,-1,-1, 0, 0, 1, 0,-1},
-{ 0,-1,-1,-1, 0, 1, 0, 0,-1},
-{ 0,-1,-1,-1, 1, 0,-1, 1,-1},
-{ 0,-1,-1,-1, 1, 0, 1,-1,-1},
-{ 0,-1,-1,-1, 1, 1,-1, 0,-1},
-{ 0,-1,-1,-1, 1, 1, 1, 0,-1},
-{ 0,-1,-1, 0,-1, 0,-1,-1, 0},
-{ 0,-1,-1, 0,-1, 0,-1, 1, 0},
-{ 0,-1,-1, 0, 0,-1, 1, 0,-1},
-{ 0,-1,-1, 0, 0, 1,-1, 0,-1},
-{ 0,-1,-1, 1,-1,-1,-1, 0, 1},
-{ 0,-1,-1, 1,-1,-1, 1, 0, 1},
-{ 0,-1,-1, 1,-1, 0,-1, 0, 0},
-{ 0,-1,-1, 1,-1, 0,-1, 1, 1},
-{ 0,-1,-1, 1,-1, 0, 0,-1, 0},
-{ 0,-1,-1, 1,-1, 0, 1,-1, 1},
-{ 0,-1,-1, 1, 1,-1, 1, 0,-1},
-{ 0,-1,-1, 1, 1, 0, 1,-1,-1},
-{ 0,-1, 0,-1,-1,-1, 1, 0, 0},
-{ 0,-1, 0,-1,-1, 1,-1, 0, 0},
-{ 0,-1, 0,-1, 0,-1, 0,-1,-1},
-{ 0,-1, 0,-1, 0,-1, 0, 1,-1},
-{ 0,-1, 0,-1, 0, 0,-1,-1,-1},
-{ 0,-1, 0,-1, 0, 0,-1, 1,-1},
-{ 0,-1, 0,-1, 0, 0, 1,-1,-1},
-{ 0,-1, 0,-1, 0, 0, 1, 1,-1},
-{ 0,-1, 0,-1, 0, 1, 0,-1,-1},
-{ 0,-1, 0,-1, 0, 1, 0, 1,-1},
-{ 0,-1, 0, 0,-1,-1, 1,-1, 0},
-{ 0,-1, 0, 0,-1,-1, 1, 1, 0},
-{ 0,-1, 0, 0,-1, 1,-1,-1, 0},
-{ 0,-1, 0, 0,-1, 1,-1, 1, 0},
-{ 0,-1, 0, 0, 0,-1, 1,-1,-1},
-{ 0,-1, 0, 0, 0,-1, 1, 1,-1},
-{ 0,-1, 0, 0, 0, 1,-1,-1,-1},
-{ 0,-1, 0, 0, 0, 1,-1, 1,-1},
-{ 0,-1, 0, 1,-1,-1, 1, 0, 0},
-{ 0,-1, 0, 1,-1, 1,-1, 0, 0},
-{ 0,-1, 1,-1,-1,-1, 1, 0, 1},
-{ 0,-1, 1,-1,-1, 0, 0,-1, 0},
-{ 0,-1, 1,-1,-1, 0, 1,-1, 1},
-{ 0,-1, 1,-1,-1, 0, 1, 0, 0},
-{ 0,-1, 1,-1, 0,-1, 0, 0,-1},
-{ 0,-1, 1,-1, 0, 0,-1, 0,-1},
-{ 0,-1, 1,-1, 0, 0, 1, 0,-1},
-{ 0,-1, 1,-1, 0, 1, 0, 0,-1},
-{ 0,-1, 1,-1, 1,-1,-1, 0,-1},
-{ 0,-1, 1,-1, 1,-1, 1, 0,-1},
-{ 0,-1, 1,-1, 1, 0,-1, 1,-1},
-{ 0,-1, 1,-1, 1, 0, 1,-1,-1},
-{ 0,-1, 1, 0,-1, 0, 1,-1, 0},
-{ 0,-1, 1, 0,-1, 0, 1, 1, 0},
-{ 0,-1, 1, 0, 0,-1, 1, 0,-1},
-{ 0,-1, 1, 0, 0, 1,-1, 0,-1},
-{ 0,-1, 1, 1,-1, 0,-1, 1, 1},
-{ 0,-1, 1, 1,-1, 0, 0, 1, 0},
-{ 0,-1, 1, 1,-1, 0, 1,-1, 1},
-{ 0,-1, 1, 1,-1, 0, 1, 0, 0},
-{ 0,-1, 1, 1,-1, 1,-1, 0, 1},
-{ 0,-1, 1, 1,-1, 1, 1, 0, 1},
-{ 0,-1, 1, 1, 1, 0,-1, 1,-1},
-{ 0,-1, 1, 1, 1, 1,-1, 0,-1},
-{ 0, 0,-1,-1,-1,-1,-1, 0, 0},
-{ 0, 0,-1,-1,-1,-1, 0, 1, 0},
-{ 0, 0,-1,-1,-1, 1,-1, 0, 0},
-{ 0, 0,-1,-1,-1, 1, 0, 1, 0},
-{ 0, 0,-1,-1, 0,-1, 0, 1,-1},
-{ 0, 0,-1,-1, 0, 0,-1, 1,-1},
-{ 0, 0,-1,-1, 0, 0, 1, 1,-1},
-{ 0, 0,-1,-1, 0, 1, 0, 1,-1},
-{ 0, 0,-1, 0,-1,-1,-1,-1, 0},
-{ 0, 0,-1, 0,-1,-1,-1, 1, 0},
-{ 0, 0,-1, 0,-1, 1,-1,-1, 0},
-{ 0, 0,-1, 0,-1, 1,-1, 1, 0},
-{ 0, 0,-1, 1,-1,-1,-1, 0, 0},
-{ 0, 0,-1, 1,-1,-1, 0,-1, 0},
-{ 0, 0,-1, 1,-1, 1,-1, 0, 0},
-{ 0, 0,-1, 1,-1, 1, 0,-1, 0},
-{ 0, 0,-1, 1, 0,-1, 0,-1,-1},
-{ 0, 0,-1, 1, 0, 0,-1,-1,-1},
-{ 0, 0,-1, 1, 0, 0, 1,-1,-1},
-{ 0, 0,-1, 1, 0, 1, 0,-1,-1},
-{ 0, 0, 1,-1,-1,-1, 0,-1, 0},
-{ 0, 0, 1,-1,-1,-1, 1, 0, 0},
-{ 0, 0, 1,-1,-1, 1, 0,-1, 0},
-{ 0, 0, 1,-1,-1, 1, 1, 0, 0},
-{ 0, 0, 1,-1, 0,-1, 0,-1,-1},
-{ 0, 0, 1,-1, 0, 0,-1,-1,-1},
-{ 0, 0, 1,-1, 0, 0, 1,-1,-1},
-{ 0, 0, 1,-1, 0, 1, 0,-1,-1},
-{ 0, 0, 1, 0,-1,-1, 1,-1, 0},
-{ 0, 0, 1, 0,-1,-1, 1, 1, 0},
-{ 0, 0, 1, 0,-1, 1, 1,-1, 0},
-{ 0, 0, 1, 0,-1, 1, 1, 1, 0},
-{ 0, 0, 1, 1,-1,-1, 0, 1, 0},
-{ 0, 0, 1, 1,-1,-1, 1, 0, 0},
-{ 0, 0, 1, 1,-1, 1, 0, 1, 0},
-{ 0, 0, 1, 1,-1, 1, 1, 0, 0},
-{ 0, 0, 1, 1, 0,-1, 0, 1,-1},
-{ 0, 0, 1, 1, 0, 0,-1, 1,-1},
-{ 0, 0, 1, 1, 0, 0, 1, 1,-1},
-{ 0, 0, 1, 1, 0, 1, 0, 1,-1},
-{ 0, 1,-1,-1,-1, 0,-1,-1, 1},
-{ 0, 1,-1,-1,-1, 0,-1, 0, 0},
-{ 0, 1,-1,-1,-1, 0, 0, 1, 0},
-{ 0, 1,-1,-1,-1, 0, 1, 1, 1},
-{ 0, 1,-1,-1,-1, 1,-1, 0, 1},
-{ 0, 1,-1,-1,-1, 1, 1, 0, 1},
-{ 0, 1,-1,-1, 1, 0, 1, 1,-1},
-{ 0, 1,-1,-1, 1, 1, 1, 0,-1},
-{ 0, 1,-1, 0,-1, 0,-1,-1, 0},
-{ 0, 1,-1, 0,-1, 0,-1, 1, 0},
-{ 0, 1,-1, 0, 0,-1,-1, 0,-1},
-{ 0, 1,-1, 0, 0, 1, 1, 0,-1},
-{ 0, 1,-1, 1,-1,-1,-1, 0, 1},
-{ 0, 1,-1, 1,-1, 0,-1,-1, 1},
-{ 0, 1,-1, 1,-1, 0,-1, 0, 0},
-{ 0, 1,-1, 1,-1, 0, 0,-1, 0},
-{ 0, 1,-1, 1, 0,-1, 0, 0,-1},
-{ 0, 1,-1, 1, 0, 0,-1, 0,-1},
-{ 0, 1,-1, 1, 0, 0, 1, 0,-1},
-{ 0, 1,-1, 1, 0, 1, 0, 0,-1},
-{ 0, 1,-1, 1, 1,-1,-1, 0,-1},
-{ 0, 1,-1, 1, 1,-1, 1, 0,-1},
-{ 0, 1,-1, 1, 1, 0,-1,-1,-1},
-{ 0, 1,-1, 1, 1, 0, 1, 1,-1},
-{ 0, 1, 0,-1,-1,-1,-1, 0, 0},
-{ 0, 1, 0,-1,-1, 1, 1, 0, 0},
-{ 0, 1, 0, 0,-1,-1,-1,-1, 0},
-{ 0, 1, 0, 0,-1,-1,-1, 1, 0},
-{ 0, 1, 0, 0,-1, 1, 1,-1, 0},
-{ 0, 1, 0, 0,-1, 1, 1, 1, 0},
-{ 0, 1, 0, 0, 0,-1,-1,-1,-1},
-{ 0, 1, 0, 0, 0,-1,-1, 1,-1},
-{ 0, 1, 0, 0, 0, 1, 1,-1,-1},
-{ 0, 1, 0, 0, 0, 1, 1, 1,-1},
-{ 0, 1, 0, 1,-1,-1,-1, 0, 0},
-{ 0, 1, 0, 1,-1, 1, 1, 0, 0},
-{ 0, 1, 0, 1, 0,-1, 0,-1,-1},
-{ 0, 1, 0, 1, 0,-1, 0, 1,-1},
-{ 0, 1, 0, 1, 0, 0,-1,-1,-1},
-{ 0, 1, 0, 1, 0, 0,-1, 1,-1},
-{ 0, 1, 0, 1, 0, 0, 1,-1,-1},
-{ 0, 1, 0, 1, 0, 0, 1, 1,-1},
-{ 0, 1, 0, 1, 0, 1, 0,-1,-1},
-{ 0, 1, 0, 1, 0, 1, 0, 1,-1},
-{ 0, 1, 1,-1,-1,-1,-1, 0, 1},
-{ 0, 1, 1,-1,-1,-1, 1, 0, 1},
-{ 0, 1, 1,-1,-1, 0,-1,-1, 1},
-{ 0, 1, 1,-1,-1, 0, 0,-1, 0},
-{ 0, 1, 1,-1,-1, 0, 1, 0, 0},
-{ 0, 1, 1,-1,-1, 0, 1, 1, 1},
-{ 0, 1, 1,-1, 1,-1,-1, 0,-1},
-{ 0, 1, 1,-1, 1, 0,-1,-1,-1},
-{ 0, 1, 1, 0,-1, 0, 1,-1, 0},
-{ 0, 1, 1, 0,-1, 0, 1, 1, 0},
-{ 0, 1, 1, 0, 0,-1,-1, 0,-1},
-{ 0, 1, 1, 0, 0, 1, 1, 0,-1},
-{ 0, 1, 1, 1,-1, 0, 0, 1, 0},
-{ 0, 1, 1, 1,-1, 0, 1, 0, 0},
-{ 0, 1, 1, 1,-1, 0, 1, 1, 1},
-{ 0, 1, 1, 1,-1, 1, 1, 0, 1},
-{ 0, 1, 1, 1, 0,-1, 0, 0,-1},
-{ 0, 1, 1, 1, 0, 0,-1, 0,-1},
-{ 0, 1, 1, 1, 0, 0, 1, 0,-1},
-{ 0, 1, 1, 1, 0, 1, 0, 0,-1},
-{ 0, 1, 1, 1, 1, 0,-1,-1,-1},
-{ 0, 1, 1, 1, 1, 0, 1, 1,-1},
-{ 0, 1, 1, 1, 1, 1,-1, 0,-1},
-{ 0, 1, 1, 1, 1, 1, 1, 0,-1},
-{ 1,-1,-1,-1, 0, 1, 0,-1,-1},
-{ 1,-1,-1,-1, 0, 1, 0, 1,-1},
-{ 1,-1,-1, 0,-1,-1,-1, 1, 0},
-{ 1,-1,-1, 0,-1,-1, 1, 1, 0},
-{ 1,-1,-1, 0,-1, 0, 0, 0,-1},
-{ 1,-1,-1, 0,-1, 1,-1, 1, 0},
-{ 1,-1,-1, 1, 0, 1, 0,-1,-1},
-{ 1,-1, 0,-1, 0,-1,-1, 1,-1},
-{ 1,-1, 0,-1, 0,-1, 1,-1,-1},
-{ 1,-1, 0,-1, 0, 1,-1, 1,-1},
-{ 1,-1, 0,-1, 0, 1, 1,-1,-1},
-{ 1,-1, 0, 0,-1,-1, 0, 0,-1},
-{ 1,-1, 0, 0,-1, 0,-1, 0,-1},
-{ 1,-1, 0, 0,-1, 0, 0,-1,-1},
-{ 1,-1, 0, 0,-1, 0, 0, 1,-1},
-{ 1,-1, 0, 0,-1, 0, 1, 0,-1},
-{ 1,-1, 0, 0,-1, 1, 0, 0,-1},
-{ 1,-1, 0, 1, 0,-1, 1, 1,-1},
-{ 1,-1, 0, 1, 0, 1,-1,-1,-1},
-{ 1,-1, 1,-1, 0,-1, 0,-1,-1},
-{ 1,-1, 1,-1, 0,-1, 0, 1,-1},
-{ 1,-1, 1, 0,-1,-1, 1,-1, 0},
-{ 1,-1, 1, 0,-1, 0, 0, 0,-1},
-{ 1,-1, 1, 0,-1, 1,-1,-1, 0},
-{ 1,-1, 1, 0,-1, 1, 1,-1, 0},
-{ 1,-1, 1, 1, 0,-1, 0, 1,-1},
-{ 1, 0,-1,-1,-1,-1, 1, 1, 0},
-{ 1, 0,-1,-1,-1, 0, 0, 0,-1},
-{ 1, 0,-1,-1,-1, 1,-1,-1, 0},
-{ 1, 0,-1,-1,-1, 1,-1, 1, 0},
-{ 1, 0,-1, 0,-1,-1, 0, 0,-1},
-{ 1, 0,-1, 0,-1, 0, 0,-1,-1},
-{ 1, 0,-1, 0,-1, 0, 0, 1,-1},
-{ 1, 0,-1, 0,-1, 1, 0, 0,-1},
-{ 1, 0,-1, 1,-1,-1,-1,-1, 0},
-{ 1, 0,-1, 1,-1,-1,-1, 1, 0},
-{ 1, 0,-1, 1,-1, 0, 0, 0,-1},
-{ 1, 0,-1, 1,-1, 1, 1,-1, 0},
-{ 1, 0, 0,-1,-1,-1, 0, 0,-1},
-{ 1, 0, 0,-1,-1, 0,-1, 0,-1},
-{ 1, 0, 0,-1,-1, 0, 0,-1,-1},
-{ 1, 0, 0,-1,-1, 0, 0, 1,-1},
-{ 1, 0, 0,-1,-1, 0, 1, 0,-1},
-{ 1, 0, 0,-1,-1, 1, 0, 0,-1},
-{ 1, 0, 0, 0,-1,-1,-1, 0,-1},
-{ 1, 0, 0, 0,-1,-1, 1, 0,-1},
-{ 1, 0, 0, 0,-1, 0,-1,-1,-1},
-{ 1, 0, 0, 0,-1, 0,-1, 1,-1},
-{ 1, 0, 0, 0,-1, 0, 1,-1,-1},
-{ 1, 0, 0, 0,-1, 0, 1, 1,-1},
-{ 1, 0, 0, 0,-1, 1,-1, 0,-1},
-{ 1, 0, 0, 0,-1, 1, 1, 0,-1},
-{ 1, 0, 0, 1,-1,-1, 0, 0,-1},
-{ 1, 0, 0, 1,-1, 0,-1, 0,-1},
-{ 1, 0, 0, 1,-1, 0, 0,-1,-1},
-{ 1, 0, 0, 1,-1, 0, 0, 1,-1},
-{ 1, 0, 0, 1,-1, 0, 1, 0,-1},
-{ 1, 0, 0, 1,-1, 1, 0, 0,-1},
-{ 1, 0, 1,-1,-1,-1, 1,-1, 0},
-{ 1, 0, 1,-1,-1,-1, 1, 1, 0},
-{ 1, 0, 1,-1,-1, 0, 0, 0,-1},
-{ 1, 0, 1,-1,-1, 1,-1,-1, 0},
-{ 1, 0, 1, 0,-1,-1, 0, 0,-1},
-{ 1, 0, 1, 0,-1, 0, 0,-1,-1},
-{ 1, 0, 1, 0,-1, 0, 0, 1,-1},
-{ 1, 0, 1, 0,-1, 1, 0, 0,-1},
-{ 1, 0, 1, 1,-1,-1,-1, 1, 0},
-{ 1, 0, 1, 1,-1, 0, 0, 0,-1},
-{ 1, 0, 1, 1,-1, 1, 1,-1, 0},
-{ 1, 0, 1, 1,-1, 1, 1, 1, 0},
-{ 1, 1,-1,-1, 0,-1, 0, 1,-1},
-{ 1, 1,-1, 0,-1,-1,-1,-1, 0},
-{ 1, 1,-1, 0,-1, 0, 0, 0,-1},
-{ 1, 1,-1, 0,-1, 1,-1,-1, 0},
-{ 1, 1,-1, 0,-1, 1, 1,-1, 0},
-{ 1, 1,-1, 1, 0,-1, 0,-1,-1},
-{ 1, 1,-1, 1, 0,-1, 0, 1,-1},
-{ 1, 1, 0,-1, 0,-1,-1, 1,-1},
-{ 1, 1, 0,-1, 0, 1, 1,-1,-1},
-{ 1, 1, 0, 0,-1,-1, 0, 0,-1},
-{ 1, 1, 0, 0,-1, 0,-1, 0,-1},
-{ 1, 1, 0, 0,-1, 0, 0,-1,-1},
-{ 1, 1, 0, 0,-1, 0, 0, 1,-1},
-{ 1, 1, 0, 0,-1, 0, 1, 0,-1},
-{ 1, 1, 0, 0,-1, 1, 0, 0,-1},
-{ 1, 1, 0, 1, 0,-1,-1,-1,-1},
-{ 1, 1, 0, 1, 0,-1, 1, 1,-1},
-{ 1, 1, 0, 1, 0, 1,-1,-1,-1},
-{ 1, 1, 0, 1, 0, 1, 1, 1,-1},
-{ 1, 1, 1,-1, 0, 1, 0,-1,-1},
-{ 1, 1, 1, 0,-1,-1,-1, 1, 0},
-{ 1, 1, 1, 0,-1,-1, 1, 1, 0},
-{ 1, 1, 1, 0,-1, 0, 0, 0,-1},
-{ 1, 1, 1, 0,-1, 1, 1, 1, 0},
-{ 1, 1, 1, 1, 0, 1, 0,-1,-1},
-{ 1, 1, 1, 1, 0, 1, 0, 1,-1},
-{-1,-1,-1,-1, 0,-1, 1, 0, 0},
-{-1,-1,-1,-1, 0, 0,-1, 1, 0},
-{-1,-1,-1,-1, 0, 0, 1, 1, 0},
-{-1,-1,-1,-1, 0, 1,-1, 0, 0},
-{-1,-1,-1, 0,-1,-1, 0, 0, 1},
-{-1,-1,-1, 0,-1, 0, 0,-1, 1},
-{-1,-1,-1, 0,-1, 0, 0, 1, 1},
-{-1,-1,-1, 0,-1, 1, 0, 0, 1},
-{-1,-1,-1, 0, 1,-1, 0, 0,-1},
-{-1,-1,-1, 0, 1, 0, 0,-1,-1},
-{-1,-1,-1, 0, 1, 0, 0, 1,-1},
-{-1,-1,-1, 0, 1, 1, 0, 0,-1},
-{-1,-1,-1, 1, 0,-1, 1, 0, 0},
-{-1,-1,-1, 1, 0, 0,-1,-1, 0},
-{-1,-1,-1, 1, 0, 0, 1,-1, 0},
-{-1,-1,-1, 1, 0, 1,-1, 0, 0},
-{-1,-1, 0,-1, 0, 0, 0, 0,-1},
-{-1,-1, 0, 0,-1, 0,-1,-1, 1},
-{-1,-1, 0, 0,-1, 0,-1, 1, 1},
-{-1,-1, 0, 0,-1, 0, 1,-1, 1},
-{-1,-1, 0, 0,-1, 0, 1, 1, 1},
-{-1,-1, 0, 0, 1, 0,-1,-1,-1},
-{-1,-1, 0, 0, 1, 0,-1, 1,-1},
-{-1,-1, 0, 0, 1, 0, 1,-1,-1},
-{-1,-1, 0, 0, 1, 0, 1, 1,-1},
-{-1,-1, 1,-1, 0,-1, 1, 0, 0},
-{-1,-1, 1,-1, 0, 0,-1,-1, 0},
-{-1,-1, 1,-1, 0, 0, 1,-1, 0},
-{-1,-1, 1,-1, 0, 1,-1, 0, 0},
-{-1,-1, 1, 0,-1,-1, 0, 0, 1},
-{-1,-1, 1, 0,-1, 0, 0,-1, 1},
-{-1,-1, 1, 0,-1, 0, 0, 1, 1},
-{-1,-1, 1, 0,-1, 1, 0, 0, 1},
-{-1,-1, 1, 0, 1,-1, 0, 0,-1},
-{-1,-1, 1, 0, 1, 0, 0,-1,-1},
-{-1,-1, 1, 0, 1, 0, 0, 1,-1},
-{-1,-1, 1, 0, 1, 1, 0, 0,-1},
-{-1,-1, 1, 1, 0,-1, 1, 0, 0},
-{-1,-1, 1, 1, 0, 0,-1, 1, 0},
-{-1,-1, 1, 1, 0, 0, 1, 1, 0},
-{-1,-1, 1, 1, 0, 1,-1, 0, 0},
-{-1, 0,-1,-1,-1,-1, 0, 0, 1},
-{-1, 0,-1,-1,-1, 1, 0, 0, 1},
-{-1, 0,-1,-1, 1,-1, 0, 0,-1},
-{-1, 0,-1,-1, 1, 1, 0, 0,-1},
-{-1, 0,-1, 0,-1, 0,-1, 0, 0},
-{-1, 0,-1, 1,-1,-1, 0, 0, 1},
-{-1, 0,-1, 1,-1, 1, 0, 0, 1},
-{-1, 0,-1, 1, 1,-1, 0, 0,-1},
-{-1, 0,-1, 1, 1, 1, 0, 0,-1},
-{-1, 0, 0,-1,-1,-1,-1, 0, 1},
-{-1, 0, 0,-1,-1,-1, 1, 0, 1},
-{-1, 0, 0,-1,-1, 0,-1,-1, 1},
-{-1, 0, 0,-1,-1, 0,-1, 1, 1},
-{-1, 0, 0,-1,-1, 0, 1,-1, 1},
-{-1, 0, 0,-1,-1, 0, 1, 1, 1},
-{-1, 0, 0,-1,-1, 1,-1, 0, 1},
-{-1, 0, 0,-1,-1, 1, 1, 0, 1},
-{-1, 0, 0,-1, 1,-1,-1, 0,-1},
-{-1, 0, 0,-1, 1,-1, 1, 0,-1},
-{-1, 0, 0,-1, 1, 0,-1,-1,-1},
-{-1, 0, 0,-1, 1, 0,-1, 1,-1},
-{-1, 0, 0,-1, 1, 0, 1,-1,-1},
-{-1, 0, 0,-1, 1, 0, 1, 1,-1},
-{-1, 0, 0,-1, 1, 1,-1, 0,-1},
-{-1, 0, 0,-1, 1, 1, 1, 0,-1},
-{-1, 0, 0, 0,-1,-1, 0,-1, 0},
-{-1, 0, 0, 0,-1, 1, 0, 1, 0},
-{-1, 0, 0, 0, 0,-1, 0,-1,-1},
-{-1, 0, 0, 0, 0, 1, 0, 1,-1},
-{-1, 0, 0, 1,-1,-1,-1, 0, 1},
-{-1, 0, 0, 1,-1,-1, 1, 0, 1},
-{-1, 0, 0, 1,-1, 0,-1,-1, 1},
-{-1, 0, 0, 1,-1, 0,-1, 1, 1},
-{-1, 0, 0, 1,-1, 0, 1,-1, 1},
-{-1, 0, 0, 1,-1, 0, 1, 1, 1},
-{-1, 0, 0, 1,-1, 1,-1, 0, 1},
-{-1, 0, 0, 1,-1, 1, 1, 0, 1},
-{-1, 0, 0, 1, 1,-1,-1, 0,-1},
-{-1, 0, 0, 1, 1,-1, 1, 0,-1},
-{-1, 0, 0, 1, 1, 0,-1,-1,-1},
-{-1, 0, 0, 1, 1, 0,-1, 1,-1},
-{-1, 0, 0, 1, 1, 0, 1,-1,-1},
-{-1, 0, 0, 1, 1, 0, 1, 1,-1},
-{-1, 0, 0, 1, 1, 1,-1, 0,-1},
-{-1, 0, 0, 1, 1, 1, 1, 0,-1},
-{-1, 0, 1,-1,-1,-1, 0, 0, 1},
-{-1, 0, 1,-1,-1, 1, 0, 0, 1},
-{-1, 0, 1,-1, 1,-1, 0, 0,-1},
-{-1, 0, 1,-1, 1, 1, 0, 0,-1},
-{-1, 0, 1, 0,-1, 0, 1, 0, 0},
-{-1, 0, 1, 1,-1,-1, 0, 0, 1},
-{-1, 0, 1, 1,-1, 1, 0, 0, 1},
-{-1, 0, 1, 1, 1,-1, 0, 0,-1},
-{-1, 0, 1, 1, 1, 1, 0, 0,-1},
-{-1, 1,-1,-1, 0,-1,-1, 0, 0},
-{-1, 1,-1,-1, 0, 0,-1, 1, 0},
-{-1, 1,-1,-1, 0, 0, 1, 1, 0},
-{-1, 1,-1,-1, 0, 1, 1, 0, 0},
-{-1, 1,-1, 0,-1,-1, 0, 0, 1},
-{-1, 1,-1, 0,-1, 0, 0,-1, 1},
-{-1, 1,-1, 0,-1, 0, 0, 1, 1},
-{-1, 1,-1, 0,-1, 1, 0, 0, 1},
-{-1, 1,-1, 0, 1,-1, 0, 0,-1},
-{-1, 1,-1, 0, 1, 0, 0,-1,-1},
-{-1, 1,-1, 0, 1, 0, 0, 1,-1},
-{-1, 1,-1, 0, 1, 1, 0, 0,-1},
-{-1, 1,-1, 1, 0,-1,-1, 0, 0},
-{-1, 1,-1, 1, 0, 0,-1,-1, 0},
-{-1, 1,-1, 1, 0, 0, 1,-1, 0},
-{-1, 1,-1, 1, 0, 1, 1, 0, 0},
-{-1, 1, 0, 0,-1, 0,-1,-1, 1},
-{-1, 1, 0, 0,-1, 0,-1, 1, 1},
-{-1, 1, 0, 0,-1, 0, 1,-1, 1},
-{-1, 1, 0, 0,-1, 0, 1, 1, 1},
-{-1, 1, 0, 0, 1, 0,-1,-1,-1},
-{-1, 1, 0, 0, 1, 0,-1, 1,-1},
-{-1, 1, 0, 0, 1, 0, 1,-1,-1},
-{-1, 1, 0, 0, 1, 0, 1, 1,-1},
-{-1, 1, 0, 1, 0, 0, 0, 0,-1},
-{-1, 1, 1,-1, 0,-1,-1, 0, 0},
-{-1, 1, 1,-1, 0, 0,-1,-1, 0},
-{-1, 1, 1,-1, 0, 0, 1,-1, 0},
-{-1, 1, 1,-1, 0, 1, 1, 0, 0},
-{-1, 1, 1, 0,-1,-1, 0, 0, 1},
-{-1, 1, 1, 0,-1, 0, 0,-1, 1},
-{-1, 1, 1, 0,-1, 0, 0, 1, 1},
-{-1, 1, 1, 0,-1, 1, 0, 0, 1},
-{-1, 1, 1, 0, 1,-1, 0, 0,-1},
-{-1, 1, 1, 0, 1, 0, 0,-1,-1},
-{-1, 1, 1, 0, 1, 0, 0, 1,-1},
-{-1, 1, 1, 0, 1, 1, 0, 0,-1},
-{-1, 1, 1, 1, 0,-1,-1, 0, 0},
-{-1, 1, 1, 1, 0, 0,-1, 1, 0},
-{-1, 1, 1, 1, 0, 0, 1, 1, 0},
-{-1, 1, 1, 1, 0, 1, 1, 0, 0},
-{ 0,-1,-1,-1,-1,-1, 0, 1, 0},
-{ 0,-1,-1,-1,-1, 1, 0, 1, 0},
-{ 0,-1,-1, 0, 0,-1, 1,-1,-1},
-{ 0,-1,-1, 0, 0,-1, 1, 1,-1},
-{ 0,-1,-1, 0, 0, 1,-1,-1,-1},
-{ 0,-1,-1, 0, 0, 1,-1, 1,-1},
-{ 0,-1,-1, 1,-1,-1, 0,-1, 0},
-{ 0,-1,-1, 1,-1, 1, 0,-1, 0},
-{ 0,-1, 0,-1,-1,-1, 1,-1, 0},
-{ 0,-1, 0,-1,-1,-1, 1, 1, 0},
-{ 0,-1, 0,-1,-1, 0, 0, 0,-1},
-{ 0,-1, 0,-1,-1, 1,-1,-1, 0},
-{ 0,-1, 0,-1,-1, 1,-1, 1, 0},
-{ 0,-1, 0, 1,-1,-1, 1,-1, 0},
-{ 0,-1, 0, 1,-1,-1, 1, 1, 0},
-{ 0,-1, 0, 1,-1, 1,-1,-1, 0},
-{ 0,-1, 0, 1,-1, 1,-1, 1, 0},
-{ 0,-1, 1,-1,-1,-1, 0,-1, 0},
-{ 0,-1, 1,-1,-1, 1, 0,-1, 0},
-{ 0,-1, 1, 0, 0,-1, 1,-1,-1},
-{ 0,-1, 1, 0, 0,-1, 1, 1,-1},
-{ 0,-1, 1, 0, 0, 1,-1,-1,-1},
-{ 0,-1, 1, 0, 0, 1,-1, 1,-1},
-{ 0,-1, 1, 1,-1,-1, 0, 1, 0},
-{ 0,-1, 1, 1,-1, 1, 0, 1, 0},
-{ 0, 0,-1,-1, 0,-1,-1, 1,-1},
-{ 0, 0,-1,-1, 0,-1, 1, 1,-1},
-{ 0, 0,-1,-1, 0, 1,-1, 1,-1},
-{ 0, 0,-1,-1, 0, 1, 1, 1,-1},
-{ 0, 0,-1, 0,-1, 0,-1, 0,-1},
-{ 0, 0,-1, 1, 0,-1,-1,-1,-1},
-{ 0, 0,-1, 1, 0,-1, 1,-1,-1},
-{ 0, 0,-1, 1, 0, 1,-1,-1,-1},
-{ 0, 0,-1, 1, 0, 1, 1,-1,-1},
-{ 0, 0, 1,-1, 0,-1,-1,-1,-1},
-{ 0, 0, 1,-1, 0,-1, 1,-1,-1},
-{ 0, 0, 1,-1, 0, 1,-1,-1,-1},
-{ 0, 0, 1,-1, 0, 1, 1,-1,-1},
-{ 0, 0, 1, 0,-1, 0, 1, 0,-1},
-{ 0, 0, 1, 1, 0,-1,-1, 1,-1},
-{ 0, 0, 1, 1, 0,-1, 1, 1,-1},
-{ 0, 0, 1, 1, 0, 1,-1, 1,-1},
-{ 0, 0, 1, 1, 0, 1, 1, 1,-1},
-{ 0, 1,-1,-1,-1,-1, 0, 1, 0},
-{ 0, 1,-1,-1,-1, 1, 0, 1, 0},
-{ 0, 1,-1, 0, 0,-1,-1,-1,-1},
-{ 0, 1,-1, 0, 0,-1,-1, 1,-1},
-{ 0, 1,-1, 0, 0, 1, 1,-1,-1},
-{ 0, 1,-1, 0, 0, 1, 1, 1,-1},
-{ 0, 1,-1, 1,-1,-1, 0,-1, 0},
-{ 0, 1,-1, 1,-1, 1, 0,-1, 0},
-{ 0, 1, 0,-1,-1,-1,-1,-1, 0},
-{ 0, 1, 0,-1,-1,-1,-1, 1, 0},
-{ 0, 1, 0,-1,-1, 1, 1,-1, 0},
-{ 0, 1, 0,-1,-1, 1, 1, 1, 0},
-{ 0, 1, 0, 1,-1,-1,-1,-1, 0},
-{ 0, 1, 0, 1,-1,-1,-1, 1, 0},
-{ 0, 1, 0, 1,-1, 0, 0, 0,-1},
-{ 0, 1, 0, 1,-1, 1, 1,-1, 0},
-{ 0, 1, 0, 1,-1, 1, 1, 1, 0},
-{ 0, 1, 1,-1,-1,-1, 0,-1, 0},
-{ 0, 1, 1,-1,-1, 1, 0,-1, 0},
-{ 0, 1, 1, 0, 0,-1,-1,-1,-1},
-{ 0, 1, 1, 0, 0,-1,-1, 1,-1},
-{ 0, 1, 1, 0, 0, 1, 1,-1,-1},
-{ 0, 1, 1, 0, 0, 1, 1, 1,-1},
-{ 0, 1, 1, 1,-1,-1, 0, 1, 0},
-{ 0, 1, 1, 1,-1, 1, 0, 1, 0},
-{ 1,-1,-1, 0,-1,-1, 0, 0,-1},
-{ 1,-1,-1, 0,-1, 0, 0,-1,-1},
-{ 1,-1,-1, 0,-1, 0, 0, 1,-1},
-{ 1,-1,-1, 0,-1, 1, 0, 0,-1},
-{ 1,-1, 0, 0,-1, 0,-1,-1,-1},
-{ 1,-1, 0, 0,-1, 0,-1, 1,-1},
-{ 1,-1, 0, 0,-1, 0, 1,-1,-1},
-{ 1,-1, 0, 0,-1, 0, 1, 1,-1},
-{ 1,-1, 1, 0,-1,-1, 0, 0,-1},
-{ 1,-1, 1, 0,-1, 0, 0,-1,-1},
-{ 1,-1, 1, 0,-1, 0, 0, 1,-1},
-{ 1,-1, 1, 0,-1, 1, 0, 0,-1},
-{ 1, 0,-1,-1,-1,-1, 0, 0,-1},
-{ 1, 0,-1,-1,-1, 1, 0, 0,-1},
-{ 1, 0,-1, 1,-1,-1, 0, 0,-1},
-{ 1, 0,-1, 1,-1, 1, 0, 0,-1},
-{ 1, 0, 0,-1,-1,-1,-1, 0,-1},
-{ 1, 0, 0,-1,-1,-1, 1, 0,-1},
-{ 1, 0, 0,-1,-1, 0,-1,-1,-1},
-{ 1, 0, 0,-1,-1, 0,-1, 1,-1},
-{ 1, 0, 0,-1,-1, 0, 1,-1,-1},
-{ 1, 0, 0,-1,-1, 0, 1, 1,-1},
-{ 1, 0, 0,-1,-1, 1,-1, 0,-1},
-{ 1, 0, 0,-1,-1, 1, 1, 0,-1},
-{ 1, 0, 0, 1,-1,-1,-1, 0,-1},
-{ 1, 0, 0, 1,-1,-1, 1, 0,-1},
-{ 1, 0, 0, 1,-1, 0,-1,-1,-1},
-{ 1, 0, 0, 1,-1, 0,-1, 1,-1},
-{ 1, 0, 0, 1,-1, 0, 1,-1,-1},
-{ 1, 0, 0, 1,-1, 0, 1, 1,-1},
-{ 1, 0, 0, 1,-1, 1,-1, 0,-1},
-{ 1, 0, 0, 1,-1, 1, 1, 0,-1},
-{ 1, 0, 1,-1,-1,-1, 0, 0,-1},
-{ 1, 0, 1,-1,-1, 1, 0, 0,-1},
-{ 1, 0, 1, 1,-1,-1, 0, 0,-1},
-{ 1, 0, 1, 1,-1, 1, 0, 0,-1},
-{ 1, 1,-1, 0,-1,-1, 0, 0,-1},
-{ 1, 1,-1, 0,-1, 0, 0,-1,-1},
-{ 1, 1,-1, 0,-1, 0, 0, 1,-1},
-{ 1, 1,-1, 0,-1, 1, 0, 0,-1},
-{ 1, 1, 0, 0,-1, 0,-1,-1,-1},
-{ 1, 1, 0, 0,-1, 0,-1, 1,-1},
-{ 1, 1, 0, 0,-1, 0, 1,-1,-1},
-{ 1, 1, 0, 0,-1, 0, 1, 1,-1},
-{ 1, 1, 1, 0,-1,-1, 0, 0,-1},
-{ 1, 1, 1, 0,-1, 0, 0,-1,-1},
-{ 1, 1, 1, 0,-1, 0, 0, 1,-1},
-{ 1, 1, 1, 0,-1, 1, 0, 0,-1},
-{-1,-1,-1,-1,-1, 0,-1, 0, 1},
-{-1,-1,-1,-1,-1, 0, 0, 1, 1},
-{-1,-1,-1,-1, 0,-1, 1,-1, 0},
-{-1,-1,-1,-1, 0,-1, 1, 1, 0},
-{-1,-1,-1,-1, 0, 0, 0, 0,-1},
-{-1,-1,-1,-1, 0, 1, 1, 1, 0},
-{-1,-1,-1,-1, 1, 0,-1, 0,-1},
-{-1,-1,-1,-1, 1, 0, 0,-1,-1},
-{-1,-1,-1, 0,-1,-1,-1, 0, 1},
-{-1,-1,-1, 0,-1,-1, 1, 0, 1},
-{-1,-1,-1, 0,-1, 0,-1, 0, 0},
-{-1,-1,-1, 0, 1, 1,-1, 0,-1},
-{-1,-1,-1, 0, 1, 1, 1, 0,-1},
-{-1,-1,-1, 1,-1, 0, 0, 1, 1},
-{-1,-1,-1, 1,-1, 0, 1, 0, 1},
-{-1,-1,-1, 1, 0,-1,-1,-1, 0},
-{-1,-1,-1, 1, 0, 1,-1,-1, 0},
-{-1,-1,-1, 1, 0, 1,-1, 1, 0},
-{-1,-1,-1, 1, 1, 0, 0,-1,-1},
-{-1,-1,-1, 1, 1, 0, 1, 0,-1},
-{-1,-1, 0,-1,-1,-1, 0,-1, 1},
-{-1,-1, 0,-1,-1,-1, 1, 0, 1},
-{-1,-1, 0,-1,-1, 1,-1, 0, 1},
-{-1,-1, 0,-1,-1, 1, 0, 1, 1},
-{-1,-1, 0,-1, 0,-1, 0, 0,-1},
-{-1,-1, 0,-1, 0, 0,-1, 0,-1},
-{-1,-1, 0,-1, 0, 0, 0,-1,-1},
-{-1,-1, 0,-1, 0, 0, 0, 1,-1},
-{-1,-1, 0,-1, 0, 0, 1, 0,-1},
-{-1,-1, 0,-1, 0, 1, 0, 0,-1},
-{-1,-1, 0,-1, 1,-1,-1, 0,-1},
-{-1,-1, 0,-1, 1,-1, 0, 1,-1},
-{-1,-1, 0,-1, 1, 1, 0,-1,-1},
-{-1,-1, 0,-1, 1, 1, 1, 0,-1},
-{-1,-1, 0, 0,-1,-1,-1,-1, 1},
-{-1,-1, 0, 0,-1,-1, 0,-1, 0},
-{-1,-1, 0, 0,-1,-1, 1, 0, 0},
-{-1,-1, 0, 0,-1,-1, 1, 1, 1},
-{-1,-1, 0, 0,-1, 1,-1,-1, 1},
-{-1,-1, 0, 0,-1, 1,-1, 0, 0},
-{-1,-1, 0, 0,-1, 1, 0, 1, 0},
-{-1,-1, 0, 0,-1, 1, 1, 1, 1},
-{-1,-1, 0, 0, 0,-1, 0,-1,-1},
-{-1,-1, 0, 0, 0,-1, 1, 0,-1},
-{-1,-1, 0, 0, 0, 1,-1, 0,-1},
-{-1,-1, 0, 0, 0, 1, 0, 1,-1},
-{-1,-1, 0, 0, 1,-1,-1,-1,-1},
-{-1,-1, 0, 0, 1,-1, 1, 1,-1},
-{-1,-1, 0, 0, 1, 1,-1,-1,-1},
-{-1,-1, 0, 0, 1, 1, 1, 1,-1},
-{-1,-1, 0, 1,-1,-1,-1, 0, 1},
-{-1,-1, 0, 1,-1,-1, 0, 1, 1},
-{-1,-1, 0, 1,-1, 1, 0,-1, 1},
-{-1,-1, 0, 1,-1, 1, 1, 0, 1},
-{-1,-1, 0, 1, 1,-1, 0,-1,-1},
-{-1,-1, 0, 1, 1,-1, 1, 0,-1},
-{-1,-1, 0, 1, 1, 1,-1, 0,-1},
-{-1,-1, 0, 1, 1, 1, 0, 1,-1},
-{-1,-1, 1,-1,-1, 0, 0,-1, 1},
-{-1,-1, 1,-1,-1, 0, 1, 0, 1},
-{-1,-1, 1,-1, 0,-1,-1,-1, 0},
-{-1,-1, 1,-1, 0, 0, 0, 0,-1},
-{-1,-1, 1,-1, 0, 1,-1,-1, 0},
-{-1,-1, 1,-1, 0, 1,-1, 1, 0},
-{-1,-1, 1,-1, 1, 0, 0, 1,-1},
-{-1,-1, 1,-1, 1, 0, 1, 0,-1},
-{-1,-1, 1, 0,-1, 0, 1, 0, 0},
-{-1,-1, 1, 0,-1, 1,-1, 0, 1},
-{-1,-1, 1, 0,-1, 1, 1, 0, 1},
-{-1,-1, 1, 0, 1,-1,-1, 0,-1},
-{-1,-1, 1, 0, 1,-1, 1, 0,-1},
-{-1,-1, 1, 1,-1, 0,-1, 0, 1},
-{-1,-1, 1, 1,-1, 0, 0,-1, 1},
-{-1,-1, 1, 1, 0,-1, 1,-1, 0},
-{-1,-1, 1, 1, 0,-1, 1, 1, 0},
-{-1,-1, 1, 1, 0, 1, 1, 1, 0},
-{-1,-1, 1, 1, 1, 0,-1, 0,-1},
-{-1,-1, 1, 1, 1, 0, 0, 1,-1},
-{-1, 0,-1,-1,-1,-1, 0,-1, 1},
-{-1, 0,-1,-1,-1,-1, 0, 1, 1},
-{-1, 0,-1,-1,-1, 0,-1,-1, 1},
-{-1, 0,-1,-1,-1, 0,-1, 0, 0},
-{-1, 0,-1,-1,-1, 0, 0, 1, 0},
-{-1, 0,-1,-1,-1, 0, 1, 1, 1},
-{-1, 0,-1,-1, 0, 0, 0, 1,-1},
-{-1, 0,-1,-1, 1,-1, 0,-1,-1},
-{-1, 0,-1,-1, 1,-1, 0, 1,-1},
-{-1, 0,-1,-1, 1, 0,-1, 1,-1},
-{-1, 0,-1,-1, 1, 0, 1,-1,-1},
-{-1, 0,-1, 0,-1,-1,-1, 0, 0},
-{-1, 0,-1, 0,-1,-1,-1, 1, 1},
-{-1, 0,-1, 0,-1,-1, 0,-1, 0},
-{-1, 0,-1, 0,-1,-1, 1,-1, 1},
-{-1, 0,-1, 0,-1, 0,-1,-1, 0},
-{-1, 0,-1, 0,-1, 0,-1, 1, 0},
-{-1, 0,-1, 0,-1, 1,-1,-1, 1},
-{-1, 0,-1, 0,-1, 1,-1, 0, 0},
-{-1, 0,-1, 0,-1, 1, 0, 1, 0},
-{-1, 0,-1, 0,-1, 1, 1, 1, 1},
-{-1, 0,-1, 0, 0,-1, 0,-1,-1},
-{-1, 0,-1, 0, 0, 1, 0, 1,-1},
-{-1, 0,-1, 0, 1,-1,-1,-1,-1},
-{-1, 0,-1, 0, 1,-1, 1, 1,-1},
-{-1, 0,-1, 0, 1, 1,-1, 1,-1},
-{-1, 0,-1, 0, 1, 1, 1,-1,-1},
-{-1, 0,-1, 1,-1, 0,-1, 0, 0},
-{-1, 0,-1, 1,-1, 0,-1, 1, 1},
-{-1, 0,-1, 1,-1, 0, 0,-1, 0},
-{-1, 0,-1, 1,-1, 0, 1,-1, 1},
-{-1, 0,-1, 1,-1, 1, 0,-1, 1},
-{-1, 0,-1, 1,-1, 1, 0, 1, 1},
-{-1, 0,-1, 1, 0, 0, 0,-1,-1},
-{-1, 0,-1, 1, 1, 0,-1,-1,-1},
-{-1, 0,-1, 1, 1, 0, 1, 1,-1},
-{-1, 0,-1, 1, 1, 1, 0,-1,-1},
-{-1, 0,-1, 1, 1, 1, 0, 1,-1},
-{-1, 0, 0,-1,-1,-1, 0,-1, 0},
-{-1, 0, 0,-1,-1, 1, 0, 1, 0},
-{-1, 0, 0,-1, 0,-1, 0,-1,-1},
-{-1, 0, 0,-1, 0, 1, 0, 1,-1},
-{-1, 0, 0, 0,-1,-1,-1,-1, 0},
-{-1, 0, 0, 0,-1,-1, 1,-1, 0},
-{-1, 0, 0, 0,-1, 1,-1, 1, 0},
-{-1, 0, 0, 0,-1, 1, 1, 1, 0},
-{-1, 0, 0, 0, 0,-1,-1,-1,-1},
-{-1, 0, 0, 0, 0,-1, 1,-1,-1},
-{-1, 0, 0, 0, 0, 1,-1, 1,-1},
-{-1, 0, 0, 0, 0, 1, 1, 1,-1},
-{-1, 0, 0, 1,-1,-1, 0,-1, 0},
-{-1, 0, 0, 1,-1, 1, 0, 1, 0},
-{-1, 0, 0, 1, 0,-1, 0,-1,-1},
-{-1, 0, 0, 1, 0, 1, 0, 1,-1},
-{-1, 0, 1,-1,-1, 0,-1,-1, 1},
-{-1, 0, 1,-1,-1, 0, 0,-1, 0},
-{-1, 0, 1,-1,-1, 0, 1, 0, 0},
-{-1, 0, 1,-1,-1, 0, 1, 1, 1},
-{-1, 0, 1,-1,-1, 1, 0,-1, 1},
-{-1, 0, 1,-1,-1, 1, 0, 1, 1},
-{-1, 0, 1,-1, 0, 0, 0,-1,-1},
-{-1, 0, 1,-1, 1, 0,-1, 1,-1},
-{-1, 0, 1,-1, 1, 0, 1,-1,-1},
-{-1, 0, 1,-1, 1, 1, 0,-1,-1},
-{-1, 0, 1,-1, 1, 1, 0, 1,-1},
-{-1, 0, 1, 0,-1,-1,-1,-1, 1},
-{-1, 0, 1, 0,-1,-1, 0,-1, 0},
-{-1, 0, 1, 0,-1,-1, 1, 0, 0},
-{-1, 0, 1, 0,-1,-1, 1, 1, 1},
-{-1, 0, 1, 0,-1, 0, 1,-1, 0},
-{-1, 0, 1, 0,-1, 0, 1, 1, 0},
-{-1, 0, 1, 0,-1, 1,-1, 1, 1},
-{-1, 0, 1, 0,-1, 1, 0, 1, 0},
-{-1, 0, 1, 0,-1, 1, 1,-1, 1},
-{-1, 0, 1, 0,-1, 1, 1, 0, 0},
-{-1, 0, 1, 0, 0,-1, 0,-1,-1},
-{-1, 0, 1, 0, 0, 1, 0, 1,-1},
-{-1, 0, 1, 0, 1,-1,-1, 1,-1},
-{-1, 0, 1, 0, 1,-1, 1,-1,-1},
-{-1, 0, 1, 0, 1, 1,-1,-1,-1},
-{-1, 0, 1, 0, 1, 1, 1, 1,-1},
-{-1, 0, 1, 1,-1,-1, 0,-1, 1},
-{-1, 0, 1, 1,-1,-1, 0, 1, 1},
-{-1, 0, 1, 1,-1, 0,-1, 1, 1},
-{-1, 0, 1, 1,-1, 0, 0, 1, 0},
-{-1, 0, 1, 1,-1, 0, 1,-1, 1},
-{-1, 0, 1, 1,-1, 0, 1, 0, 0},
-{-1, 0, 1, 1, 0, 0, 0, 1,-1},
-{-1, 0, 1, 1, 1,-1, 0,-1,-1},
-{-1, 0, 1, 1, 1,-1, 0, 1,-1},
-{-1, 0, 1, 1, 1, 0,-1,-1,-1},
-{-1, 0, 1, 1, 1, 0, 1, 1,-1},
-{-1, 1,-1,-1,-1, 0, 0,-1, 1},
-{-1, 1,-1,-1,-1, 0, 1, 0, 1},
-{-1, 1,-1,-1, 0,-1,-1,-1, 0},
-{-1, 1,-1,-1, 0,-1,-1, 1, 0},
-{-1, 1,-1,-1, 0, 1,-1, 1, 0},
-{-1, 1,-1,-1, 1, 0, 0, 1,-1},
-{-1, 1,-1,-1, 1, 0, 1, 0,-1},
-{-1, 1,-1, 0,-1, 0,-1, 0, 0},
-{-1, 1,-1, 0,-1, 1,-1, 0, 1},
-{-1, 1,-1, 0,-1, 1, 1, 0, 1},
-{-1, 1,-1, 0, 1,-1,-1, 0,-1},
-{-1, 1,-1, 0, 1,-1, 1, 0,-1},
-{-1, 1,-1, 1,-1, 0,-1, 0, 1},
-{-1, 1,-1, 1,-1, 0, 0,-1, 1},
-{-1, 1,-1, 1, 0,-1, 1,-1, 0},
-{-1, 1,-1, 1, 0, 0, 0, 0,-1},
-{-1, 1,-1, 1, 0, 1, 1,-1, 0},
-{-1, 1,-1, 1, 0, 1, 1, 1, 0},
-{-1, 1,-1, 1, 1, 0,-1, 0,-1},
-{-1, 1,-1, 1, 1, 0, 0, 1,-1},
-{-1, 1, 0,-1,-1,-1, 0, 1, 1},
-{-1, 1, 0,-1,-1,-1, 1, 0, 1},
-{-1, 1, 0,-1,-1, 1,-1, 0, 1},
-{-1, 1, 0,-1,-1, 1, 0,-1, 1},
-{-1, 1, 0,-1, 1,-1,-1, 0,-1},
-{-1, 1, 0,-1, 1,-1, 0,-1,-1},
-{-1, 1, 0,-1, 1, 1, 0, 1,-1},
-{-1, 1, 0,-1, 1, 1, 1, 0,-1},
-{-1, 1, 0, 0,-1,-1,-1, 0, 0},
-{-1, 1, 0, 0,-1,-1,-1, 1, 1},
-{-1, 1, 0, 0,-1,-1, 0,-1, 0},
-{-1, 1, 0, 0,-1,-1, 1,-1, 1},
-{-1, 1, 0, 0,-1, 1,-1, 1, 1},
-{-1, 1, 0, 0,-1, 1, 0, 1, 0},
-{-1, 1, 0, 0,-1, 1, 1,-1, 1},
-{-1, 1, 0, 0,-1, 1, 1, 0, 0},
-{-1, 1, 0, 0, 0,-1,-1, 0,-1},
-{-1, 1, 0, 0, 0,-1, 0,-1,-1},
-{-1, 1, 0, 0, 0, 1, 0, 1,-1},
-{-1, 1, 0, 0, 0, 1, 1, 0,-1},
-{-1, 1, 0, 0, 1,-1,-1, 1,-1},
-{-1, 1, 0, 0, 1,-1, 1,-1,-1},
-{-1, 1, 0, 0, 1, 1,-1, 1,-1},
-{-1, 1, 0, 0, 1, 1, 1,-1,-1},
-{-1, 1, 0, 1,-1,-1,-1, 0, 1},
-{-1, 1, 0, 1,-1,-1, 0,-1, 1},
-{-1, 1, 0, 1,-1, 1, 0, 1, 1},
-{-1, 1, 0, 1,-1, 1, 1, 0, 1},
-{-1, 1, 0, 1, 0,-1, 0, 0,-1},
-{-1, 1, 0, 1, 0, 0,-1, 0,-1},
-{-1, 1, 0, 1, 0, 0, 0,-1,-1},
-{-1, 1, 0, 1, 0, 0, 0, 1,-1},
-{-1, 1, 0, 1, 0, 0, 1, 0,-1},
-{-1, 1, 0, 1, 0, 1, 0, 0,-1},
-{-1, 1, 0, 1, 1,-1, 0, 1,-1},
-{-1, 1, 0, 1, 1,-1, 1, 0,-1},
-{-1, 1, 0, 1, 1, 1,-1, 0,-1},
-{-1, 1, 0, 1, 1, 1, 0,-1,-1},
-{-1, 1, 1,-1,-1, 0,-1, 0, 1},
-{-1, 1, 1,-1,-1, 0, 0, 1, 1},
-{-1, 1, 1,-1, 0,-1, 1,-1, 0},
-{-1, 1, 1,-1, 0, 1, 1,-1, 0},
-{-1, 1, 1,-1, 0, 1, 1, 1, 0},
-{-1, 1, 1,-1, 1, 0,-1, 0,-1},
-{-1, 1, 1,-1, 1, 0, 0,-1,-1},
-{-1, 1, 1, 0,-1,-1,-1, 0, 1},
-{-1, 1, 1, 0,-1,-1, 1, 0, 1},
-{-1, 1, 1, 0,-1, 0, 1, 0, 0},
-{-1, 1, 1, 0, 1, 1,-1, 0,-1},
-{-1, 1, 1, 0, 1, 1, 1, 0,-1},
-{-1, 1, 1, 1,-1, 0, 0, 1, 1},
-{-1, 1, 1, 1,-1, 0, 1, 0, 1},
-{-1, 1, 1, 1, 0,-1,-1,-1, 0},
-{-1, 1, 1, 1, 0,-1,-1, 1, 0},
-{-1, 1, 1, 1, 0, 0, 0, 0,-1},
-{-1, 1, 1, 1, 0, 1,-1, 1, 0},
-{-1, 1, 1, 1, 1, 0, 0,-1,-1},
-{-1, 1, 1, 1, 1, 0, 1, 0,-1},
-{ 0,-1,-1,-1,-1,-1,-1, 1, 0},
-{ 0,-1,-1,-1,-1,-1, 1, 1, 0},
-{ 0,-1,-1,-1,-1, 0, 0, 0,-1},
-{ 0,-1,-1,-1,-1, 1,-1,-1, 0},
-{ 0,-1,-1,-1, 0,-1,-1, 1,-1},
-{ 0,-1,-1,-1, 0,-1, 1,-1,-1},
-{ 0,-1,-1,-1, 0, 1,-1,-1,-1},
-{ 0,-1,-1,-1, 0, 1, 1, 1,-1},
-{ 0,-1,-1, 0,-1, 0,-1, 0,-1},
-{ 0,-1,-1, 1,-1,-1,-1,-1, 0},
-{ 0,-1,-1, 1,-1,-1, 1,-1, 0},
-{ 0,-1,-1, 1,-1, 1,-1, 1, 0},
-{ 0,-1,-1, 1, 0,-1, 1,-1,-1},
-{ 0,-1,-1, 1, 0, 1,-1,-1,-1},
-{ 0,-1, 0,-1,-1,-1, 0, 0,-1},
-{ 0,-1, 0,-1,-1, 0,-1, 0,-1},
-{ 0,-1, 0,-1,-1, 0, 0,-1,-1},
-{ 0,-1, 0,-1,-1, 0, 0, 1,-1},
-{ 0,-1, 0,-1,-1, 0, 1, 0,-1},
-{ 0,-1, 0,-1,-1, 1, 0, 0,-1},
-{ 0,-1, 0, 0,-1,-1, 1, 0,-1},
-{ 0,-1, 0, 0,-1, 1,-1, 0,-1},
-{ 0,-1, 1,-1,-1,-1, 1, 1, 0},
-{ 0,-1, 1,-1,-1, 0, 0, 0,-1},
-{ 0,-1, 1,-1,-1, 1,-1,-1, 0},
-{ 0,-1, 1,-1,-1, 1, 1,-1, 0},
-{ 0,-1, 1,-1, 0,-1,-1,-1,-1},
-{ 0,-1, 1,-1, 0,-1, 1, 1,-1},
-{ 0,-1, 1,-1, 0, 1,-1, 1,-1},
-{ 0,-1, 1,-1, 0, 1, 1,-1,-1},
-{ 0,-1, 1, 0,-1, 0, 1, 0,-1},
-{ 0,-1, 1, 1,-1,-1, 1,-1, 0},
-{ 0,-1, 1, 1,-1, 1,-1, 1, 0},
-{ 0,-1, 1, 1,-1, 1, 1, 1, 0},
-{ 0,-1, 1, 1, 0,-1, 1, 1,-1},
-{ 0,-1, 1, 1, 0, 1,-1, 1,-1},
-{ 0, 0,-1,-1,-1, 0,-1, 0,-1},
-{ 0, 0,-1,-1,-1, 0, 0, 1,-1},
-{ 0, 0,-1, 0,-1,-1,-1, 0,-1},
-{ 0, 0,-1, 0,-1, 0,-1,-1,-1},
-{ 0, 0,-1, 0,-1, 0,-1, 1,-1},
-{ 0, 0,-1, 0,-1, 1,-1, 0,-1},
-{ 0, 0,-1, 1,-1, 0,-1, 0,-1},
-{ 0, 0,-1, 1,-1, 0, 0,-1,-1},
-{ 0, 0, 1,-1,-1, 0, 0,-1,-1},
-{ 0, 0, 1,-1,-1, 0, 1, 0,-1},
-{ 0, 0, 1, 0,-1,-1, 1, 0,-1},
-{ 0, 0, 1, 0,-1, 0, 1,-1,-1},
-{ 0, 0, 1, 0,-1, 0, 1, 1,-1},
-{ 0, 0, 1, 0,-1, 1, 1, 0,-1},
-{ 0, 0, 1, 1,-1, 0, 0, 1,-1},
-{ 0, 0, 1, 1,-1, 0, 1, 0,-1},
-{ 0, 1,-1,-1,-1,-1,-1,-1, 0},
-{ 0, 1,-1,-1,-1, 1,-1, 1, 0},
-{ 0, 1,-1,-1,-1, 1, 1, 1, 0},
-{ 0, 1,-1,-1, 0,-1,-1, 1,-1},
-{ 0, 1,-1,-1, 0, 1, 1, 1,-1},
-{ 0, 1,-1, 0,-1, 0,-1, 0,-1},
-{ 0, 1,-1, 1,-1,-1,-1, 1, 0},
-{ 0, 1,-1, 1,-1, 0, 0, 0,-1},
-{ 0, 1,-1, 1,-1, 1,-1,-1, 0},
-{ 0, 1,-1, 1,-1, 1, 1,-1, 0},
-{ 0, 1,-1, 1, 0,-1,-1, 1,-1},
-{ 0, 1,-1, 1, 0,-1, 1,-1,-1},
-{ 0, 1,-1, 1, 0, 1,-1,-1,-1},
-{ 0, 1,-1, 1, 0, 1, 1, 1,-1},
-{ 0, 1, 0, 0,-1,-1,-1, 0,-1},
-{ 0, 1, 0, 0,-1, 1, 1, 0,-1},
-{ 0, 1, 0, 1,-1,-1, 0, 0,-1},
-{ 0, 1, 0, 1,-1, 0,-1, 0,-1},
-{ 0, 1, 0, 1,-1, 0, 0,-1,-1},
-{ 0, 1, 0, 1,-1, 0, 0, 1,-1},
-{ 0, 1, 0, 1,-1, 0, 1, 0,-1},
-{ 0, 1, 0, 1,-1, 1, 0, 0,-1},
-{ 0, 1, 1,-1,-1,-1,-1,-1, 0},
-{ 0, 1, 1,-1,-1,-1, 1,-1, 0},
-{ 0, 1, 1,-1,-1, 1, 1, 1, 0},
-{ 0, 1, 1,-1, 0,-1,-1,-1,-1},
-{ 0, 1, 1,-1, 0, 1, 1,-1,-1},
-{ 0, 1, 1, 0,-1, 0, 1, 0,-1},
-{ 0, 1, 1, 1,-1,-1,-1, 1, 0},
-{ 0, 1, 1, 1,-1,-1, 1, 1, 0},
-{ 0, 1, 1, 1,-1, 0, 0, 0,-1},
-{ 0, 1, 1, 1,-1, 1, 1,-1, 0},
-{ 0, 1, 1, 1, 0,-1,-1,-1,-1},
-{ 0, 1, 1, 1, 0,-1, 1, 1,-1},
-{ 0, 1, 1, 1, 0, 1,-1, 1,-1},
-{ 0, 1, 1, 1, 0, 1, 1,-1,-1},
-{ 1,-1,-1,-1,-1, 0, 0,-1,-1},
-{ 1,-1,-1,-1,-1, 0, 1, 0,-1},
-{ 1,-1,-1, 0,-1,-1,-1, 0,-1},
-{ 1,-1,-1, 0,-1,-1, 1, 0,-1},
-{ 1,-1,-1, 1,-1, 0,-1, 0,-1},
-{ 1,-1,-1, 1,-1, 0, 0,-1,-1},
-{ 1,-1, 0,-1,-1,-1,-1, 0,-1},
-{ 1,-1, 0,-1,-1,-1, 0,-1,-1},
-{ 1,-1, 0,-1,-1, 1, 0, 1,-1},
-{ 1,-1, 0,-1,-1, 1, 1, 0,-1},
-{ 1,-1, 0, 0,-1,-1,-1, 1,-1},
-{ 1,-1, 0, 0,-1,-1, 1,-1,-1},
-{ 1,-1, 0, 0,-1, 1,-1, 1,-1},
-{ 1,-1, 0, 0,-1, 1, 1,-1,-1},
-{ 1,-1, 0, 1,-1,-1, 0, 1,-1},
-{ 1,-1, 0, 1,-1,-1, 1, 0,-1},
-{ 1,-1, 0, 1,-1, 1,-1, 0,-1},
-{ 1,-1, 0, 1,-1, 1, 0,-1,-1},
-{ 1,-1, 1,-1,-1, 0,-1, 0,-1},
-{ 1,-1, 1,-1,-1, 0, 0, 1,-1},
-{ 1,-1, 1, 0,-1, 1,-1, 0,-1},
-{ 1,-1, 1, 0,-1, 1, 1, 0,-1},
-{ 1,-1, 1, 1,-1, 0, 0, 1,-1},
-{ 1,-1, 1, 1,-1, 0, 1, 0,-1},
-{ 1, 0,-1,-1,-1, 0,-1,-1,-1},
-{ 1, 0,-1,-1,-1, 0, 1, 1,-1},
-{ 1, 0,-1,-1,-1, 1, 0,-1,-1},
-{ 1, 0,-1,-1,-1, 1, 0, 1,-1},
-{ 1, 0,-1, 0,-1,-1,-1,-1,-1},
-{ 1, 0,-1, 0,-1,-1, 1, 1,-1},
-{ 1, 0,-1, 0,-1, 1,-1, 1,-1},
-{ 1, 0,-1, 0,-1, 1, 1,-1,-1},
-{ 1, 0,-1, 1,-1,-1, 0,-1,-1},
-{ 1, 0,-1, 1,-1,-1, 0, 1,-1},
-{ 1, 0,-1, 1,-1, 0,-1, 1,-1},
-{ 1, 0,-1, 1,-1, 0, 1,-1,-1},
-{ 1, 0, 1,-1,-1,-1, 0,-1,-1},
-{ 1, 0, 1,-1,-1,-1, 0, 1,-1},
-{ 1, 0, 1,-1,-1, 0,-1,-1,-1},
-{ 1, 0, 1,-1,-1, 0, 1, 1,-1},
-{ 1, 0, 1, 0,-1,-1,-1, 1,-1},
-{ 1, 0, 1, 0,-1,-1, 1,-1,-1},
-{ 1, 0, 1, 0,-1, 1,-1,-1,-1},
-{ 1, 0, 1, 0,-1, 1, 1, 1,-1},
-{ 1, 0, 1, 1,-1, 0,-1, 1,-1},
-{ 1, 0, 1, 1,-1, 0, 1,-1,-1},
-{ 1, 0, 1, 1,-1, 1, 0,-1,-1},
-{ 1, 0, 1, 1,-1, 1, 0, 1,-1},
-{ 1, 1,-1,-1,-1, 0,-1, 0,-1},
-{ 1, 1,-1,-1,-1, 0, 0, 1,-1},
-{ 1, 1,-1, 0,-1, 1,-1, 0,-1},
-{ 1, 1,-1, 0,-1, 1, 1, 0,-1},
-{ 1, 1,-1, 1,-1, 0, 0, 1,-1},
-{ 1, 1,-1, 1,-1, 0, 1, 0,-1},
-{ 1, 1, 0,-1,-1,-1,-1, 0,-1},
-{ 1, 1, 0,-1,-1,-1, 0, 1,-1},
-{ 1, 1, 0,-1,-1, 1, 0,-1,-1},
-{ 1, 1, 0,-1,-1, 1, 1, 0,-1},
-{ 1, 1, 0, 0,-1,-1,-1,-1,-1},
-{ 1, 1, 0, 0,-1,-1, 1, 1,-1},
-{ 1, 1, 0, 0,-1, 1,-1,-1,-1},
-{ 1, 1, 0, 0,-1, 1, 1, 1,-1},
-{ 1, 1, 0, 1,-1,-1, 0,-1,-1},
-{ 1, 1, 0, 1,-1,-1, 1, 0,-1},
-{ 1, 1, 0, 1,-1, 1,-1, 0,-1},
-{ 1, 1, 0, 1,-1, 1, 0, 1,-1},
-{ 1, 1, 1,-1,-1, 0, 0,-1,-1},
-{ 1, 1, 1,-1,-1, 0, 1, 0,-1},
-{ 1, 1, 1, 0,-1,-1,-1, 0,-1},
-{ 1, 1, 1, 0,-1,-1, 1, 0,-1},
-{ 1, 1, 1, 1,-1, 0,-1, 0,-1},
-{ 1, 1, 1, 1,-1, 0, 0,-1,-1},
-{-1,-1,-1,-1,-1, 0,-1, 0, 0},
-{-1,-1,-1,-1,-1, 0, 0, 1, 0},
-{-1,-1,-1,-1, 0,-1, 0, 0,-1},
-{-1,-1,-1,-1, 0, 0,-1, 0,-1},
-{-1,-1,-1,-1, 0, 0, 1, 0,-1},
-{-1,-1,-1,-1, 0, 1, 0, 0,-1},
-{-1,-1,-1, 0,-1,-1, 0,-1, 0},
-{-1,-1,-1, 0,-1, 0,-1,-1, 0},
-{-1,-1,-1, 0,-1, 0,-1, 1, 0},
-{-1,-1,-1, 0,-1, 1, 0, 1, 0},
-{-1,-1,-1, 0, 0,-1, 0,-1,-1},
-{-1,-1,-1, 0, 0,-1, 1, 0,-1},
-{-1,-1,-1, 0, 0, 1,-1, 0,-1},
-{-1,-1,-1, 0, 0, 1, 0, 1,-1},
-{-1,-1,-1, 1,-1, 0,-1, 0, 0},
-{-1,-1,-1, 1,-1, 0, 0,-1, 0},
-{-1,-1, 0,-1,-1,-1, 0,-1, 0},
-{-1,-1, 0,-1,-1,-1, 1, 0, 0},
-{-1,-1, 0,-1,-1, 1,-1, 0, 0},
-{-1,-1, 0,-1,-1, 1, 0, 1, 0},
-{-1,-1, 0,-1, 0, 0,-1,-1,-1},
-{-1,-1, 0,-1, 0, 0,-1, 1,-1},
-{-1,-1, 0,-1, 0, 0, 1,-1,-1},
-{-1,-1, 0,-1, 0, 0, 1, 1,-1},
-{-1,-1, 0, 1,-1,-1, 0,-1, 0},
-{-1,-1, 0, 1,-1,-1, 1, 0, 0},
-{-1,-1, 0, 1,-1, 1,-1, 0, 0},
-{-1,-1, 0, 1,-1, 1, 0, 1, 0},
-{-1,-1, 1,-1,-1, 0, 0,-1, 0},
-{-1,-1, 1,-1,-1, 0, 1, 0, 0},
-{-1,-1, 1,-1, 0,-1, 0, 0,-1},
-{-1,-1, 1,-1, 0, 0,-1, 0,-1},
-{-1,-1, 1,-1, 0, 0, 1, 0,-1},
-{-1,-1, 1,-1, 0, 1, 0, 0,-1},
-{-1,-1, 1, 0,-1,-1, 0,-1, 0},
-{-1,-1, 1, 0,-1, 0, 1,-1, 0},
-{-1,-1, 1, 0,-1, 0, 1, 1, 0},
-{-1,-1, 1, 0,-1, 1, 0, 1, 0},
-{-1,-1, 1, 0, 0,-1, 0,-1,-1},
-{-1,-1, 1, 0, 0,-1, 1, 0,-1},
-{-1,-1, 1, 0, 0, 1,-1, 0,-1},
-{-1,-1, 1, 0, 0, 1, 0, 1,-1},
-{-1,-1, 1, 1,-1, 0, 0, 1, 0},
-{-1,-1, 1, 1,-1, 0, 1, 0, 0},
-{-1, 0,-1,-1,-1,-1,-1, 0, 0},
-{-1, 0,-1,-1,-1, 1,-1, 0, 0},
-{-1, 0,-1,-1, 0, 0,-1, 1,-1},
-{-1, 0,-1,-1, 0, 0, 1, 1,-1},
-{-1, 0,-1, 0, 0,-1,-1,-1,-1},
-{-1, 0,-1, 0, 0,-1, 1,-1,-1},
-{-1, 0,-1, 0, 0, 1,-1, 1,-1},
-{-1, 0,-1, 0, 0, 1, 1, 1,-1},
-{-1, 0,-1, 1,-1,-1,-1, 0, 0},
-{-1, 0,-1, 1,-1, 1,-1, 0, 0},
-{-1, 0,-1, 1, 0, 0,-1,-1,-1},
-{-1, 0,-1, 1, 0, 0, 1,-1,-1},
-{-1, 0, 0,-1,-1,-1,-1,-1, 0},
-{-1, 0, 0,-1,-1,-1, 1,-1, 0},
-{-1, 0, 0,-1,-1, 1,-1, 1, 0},
-{-1, 0, 0,-1,-1, 1, 1, 1, 0},
-{-1, 0, 0,-1, 0,-1,-1,-1,-1},
-{-1, 0, 0,-1, 0,-1, 1,-1,-1},
-{-1, 0, 0,-1, 0, 1,-1, 1,-1},
-{-1, 0, 0,-1, 0, 1, 1, 1,-1},
-{-1, 0, 0, 1,-1,-1,-1,-1, 0},
-{-1, 0, 0, 1,-1,-1, 1,-1, 0},
-{-1, 0, 0, 1,-1, 1,-1, 1, 0},
-{-1, 0, 0, 1,-1, 1, 1, 1, 0},
-{-1, 0, 0, 1, 0,-1,-1,-1,-1},
-{-1, 0, 0, 1, 0,-1, 1,-1,-1},
-{-1, 0, 0, 1, 0, 1,-1, 1,-1},
-{-1, 0, 0, 1, 0, 1, 1, 1,-1},
-{-1, 0, 1,-1,-1,-1, 1, 0, 0},
-{-1, 0, 1,-1,-1, 1, 1, 0, 0},
-{-1, 0, 1,-1, 0, 0,-1,-1,-1},
-{-1, 0, 1,-1, 0, 0, 1,-1,-1},
-{-1, 0, 1, 0, 0,-1,-1,-1,-1},
-{-1, 0, 1, 0, 0,-1, 1,-1,-1},
-{-1, 0, 1, 0, 0, 1,-1, 1,-1},
-{-1, 0, 1, 0, 0, 1, 1, 1,-1},
-{-1, 0, 1, 1,-1,-1, 1, 0, 0},
-{-1, 0, 1, 1,-1, 1, 1, 0, 0},
-{-1, 0, 1, 1, 0, 0,-1, 1,-1},
-{-1, 0, 1, 1, 0, 0, 1, 1,-1},
-{-1, 1,-1,-1,-1, 0,-1, 0, 0},
-{-1, 1,-1,-1,-1, 0, 0, 1, 0},
-{-1, 1,-1, 0,-1,-1, 0,-1, 0},
-{-1, 1,-1, 0,-1, 0,-1,-1, 0},
-{-1, 1,-1, 0,-1, 0,-1, 1, 0},
-{-1, 1,-1, 0,-1, 1, 0, 1, 0},
-{-1, 1,-1, 0, 0,-1,-1, 0,-1},
-{-1, 1,-1, 0, 0,-1, 0,-1,-1},
-{-1, 1,-1, 0, 0, 1, 0, 1,-1},
-{-1, 1,-1, 0, 0, 1, 1, 0,-1},
-{-1, 1,-1, 1,-1, 0,-1, 0, 0},
-{-1, 1,-1, 1,-1, 0, 0,-1, 0},
-{-1, 1,-1, 1, 0,-1, 0, 0,-1},
-{-1, 1,-1, 1, 0, 0,-1, 0,-1},
-{-1, 1,-1, 1, 0, 0, 1, 0,-1},
-{-1, 1,-1, 1, 0, 1, 0, 0,-1},
-{-1, 1, 0,-1,-1,-1,-1, 0, 0},
-{-1, 1, 0,-1,-1,-1, 0,-1, 0},
-{-1, 1, 0,-1,-1, 1, 0, 1, 0},
-{-1, 1, 0,-1,-1, 1, 1, 0, 0},
-{-1, 1, 0, 1,-1,-1,-1, 0, 0},
-{-1, 1, 0, 1,-1,-1, 0,-1, 0},
-{-1, 1, 0, 1,-1, 1, 0, 1, 0},
-{-1, 1, 0, 1,-1, 1, 1, 0, 0},
-{-1, 1, 0, 1, 0, 0,-1,-1,-1},
-{-1, 1, 0, 1, 0, 0,-1, 1,-1},
-{-1, 1, 0, 1, 0, 0, 1,-1,-1},
-{-1, 1, 0, 1, 0, 0, 1, 1,-1},
-{-1, 1, 1,-1,-1, 0, 0,-1, 0},
-{-1, 1, 1,-1,-1, 0, 1, 0, 0},
-{-1, 1, 1, 0,-1,-1, 0,-1, 0},
-{-1, 1, 1, 0,-1, 0, 1,-1, 0},
-{-1, 1, 1, 0,-1, 0, 1, 1, 0},
-{-1, 1, 1, 0,-1, 1, 0, 1, 0},
-{-1, 1, 1, 0, 0,-1,-1, 0,-1},
-{-1, 1, 1, 0, 0,-1, 0,-1,-1},
-{-1, 1, 1, 0, 0, 1, 0, 1,-1},
-{-1, 1, 1, 0, 0, 1, 1, 0,-1},
-{-1, 1, 1, 1,-1, 0, 0, 1, 0},
-{-1, 1, 1, 1,-1, 0, 1, 0, 0},
-{-1, 1, 1, 1, 0,-1, 0, 0,-1},
-{-1, 1, 1, 1, 0, 0,-1, 0,-1},
-{-1, 1, 1, 1, 0, 0, 1, 0,-1},
-{-1, 1, 1, 1, 0, 1, 0, 0,-1},
-{ 0,-1,-1,-1,-1,-1, 0, 0,-1},
-{ 0,-1,-1,-1,-1, 1, 0, 0,-1},
-{ 0,-1,-1, 0,-1, 0,-1,-1,-1},
-{ 0,-1,-1, 0,-1, 0,-1, 1,-1},
-{ 0,-1, 0,-1,-1,-1, 0,-1,-1},
-{ 0,-1, 0,-1,-1,-1, 0, 1,-1},
-{ 0,-1, 0,-1,-1, 0,-1,-1,-1},
-{ 0,-1, 0,-1,-1, 0,-1, 1,-1},
-{ 0,-1, 0,-1,-1, 0, 1,-1,-1},
-{ 0,-1, 0,-1,-1, 0, 1, 1,-1},
-{ 0,-1, 0,-1,-1, 1, 0,-1,-1},
-{ 0,-1, 0,-1,-1, 1, 0, 1,-1},
-{ 0,-1, 0, 0,-1,-1, 1,-1,-1},
-{ 0,-1, 0, 0,-1,-1, 1, 1,-1},
-{ 0,-1, 0, 0,-1, 1,-1,-1,-1},
-{ 0,-1, 0, 0,-1, 1,-1, 1,-1},
-{ 0,-1, 1,-1,-1,-1, 0, 0,-1},
-{ 0,-1, 1,-1,-1, 1, 0, 0,-1},
-{ 0,-1, 1, 0,-1, 0, 1,-1,-1},
-{ 0,-1, 1, 0,-1, 0, 1, 1,-1},
-{ 0, 0,-1,-1,-1,-1,-1, 0,-1},
-{ 0, 0,-1,-1,-1,-1, 0, 1,-1},
-{ 0, 0,-1,-1,-1, 1,-1, 0,-1},
-{ 0, 0,-1,-1,-1, 1, 0, 1,-1},
-{ 0, 0,-1, 0,-1,-1,-1,-1,-1},
-{ 0, 0,-1, 0,-1,-1,-1, 1,-1},
-{ 0, 0,-1, 0,-1, 1,-1,-1,-1},
-{ 0, 0,-1, 0,-1, 1,-1, 1,-1},
-{ 0, 0,-1, 1,-1,-1,-1, 0,-1},
-{ 0, 0,-1, 1,-1,-1, 0,-1,-1},
-{ 0, 0,-1, 1,-1, 1,-1, 0,-1},
-{ 0, 0,-1, 1,-1, 1, 0,-1,-1},
-{ 0, 0, 1,-1,-1,-1, 0,-1,-1},
-{ 0, 0, 1,-1,-1,-1, 1, 0,-1},
-{ 0, 0, 1,-1,-1, 1, 0,-1,-1},
-{ 0, 0, 1,-1,-1, 1, 1, 0,-1},
-{ 0, 0, 1, 0,-1,-1, 1,-1,-1},
-{ 0, 0, 1, 0,-1,-1, 1, 1,-1},
-{ 0, 0, 1, 0,-1, 1, 1,-1,-1},
-{ 0, 0, 1, 0,-1, 1, 1, 1,-1},
-{ 0, 0, 1, 1,-1,-1, 0, 1,-1},
-{ 0, 0, 1, 1,-1,-1, 1, 0,-1},
-{ 0, 0, 1, 1,-1, 1, 0, 1,-1},
-{ 0, 0, 1, 1,-1, 1, 1, 0,-1},
-{ 0, 1,-1, 0,-1, 0,-1,-1,-1},
-{ 0, 1,-1, 0,-1, 0,-1, 1,-1},
-{ 0, 1,-1, 1,-1,-1, 0, 0,-1},
-{ 0, 1,-1, 1,-1, 1, 0, 0,-1},
-{ 0, 1, 0, 0,-1,-1,-1,-1,-1},
-{ 0, 1, 0, 0,-1,-1,-1, 1,-1},
-{ 0, 1, 0, 0,-1, 1, 1,-1,-1},
-{ 0, 1, 0, 0,-1, 1, 1, 1,-1},
-{ 0, 1, 0, 1,-1,-1, 0,-1,-1},
-{ 0, 1, 0, 1,-1,-1, 0, 1,-1},
-{ 0, 1, 0, 1,-1, 0,-1,-1,-1},
-{ 0, 1, 0, 1,-1, 0,-1, 1,-1},
-{ 0, 1, 0, 1,-1, 0, 1,-1,-1},
-{ 0, 1, 0, 1,-1, 0, 1, 1,-1},
-{ 0, 1, 0, 1,-1, 1, 0,-1,-1},
-{ 0, 1, 0, 1,-1, 1, 0, 1,-1},
-{ 0, 1, 1, 0,-1, 0, 1,-1,-1},
-{ 0, 1, 1, 0,-1, 0, 1, 1,-1},
-{ 0, 1, 1, 1,-1,-1, 0, 0,-1},
-{ 0, 1, 1, 1,-1, 1, 0, 0,-1},
-{-1,-1,-1,-1, 0,-1, 0,-1,-1},
-{-1,-1,-1,-1, 0,-1, 0, 1,-1},
-{-1,-1,-1, 0,-1,-1,-1,-1, 0},
-{-1,-1,-1, 0,-1,-1, 1,-1, 0},
-{-1,-1,-1, 0,-1, 1,-1,-1, 0},
-{-1,-1,-1, 1, 0,-1, 0,-1,-1},
-{-1,-1, 0,-1, 0,-1,-1,-1,-1},
-{-1,-1, 0,-1, 0,-1, 1, 1,-1},
-{-1,-1, 0,-1, 0, 1,-1,-1,-1},
-{-1,-1, 0,-1, 0, 1, 1, 1,-1},
-{-1,-1, 0, 1, 0,-1, 1,-1,-1},
-{-1,-1, 0, 1, 0, 1,-1, 1,-1},
-{-1,-1, 1,-1, 0, 1, 0,-1,-1},
-{-1,-1, 1,-1, 0, 1, 0, 1,-1},
-{-1,-1, 1, 0,-1,-1, 1, 1, 0},
-{-1,-1, 1, 0,-1, 1,-1, 1, 0},
-{-1,-1, 1, 0,-1, 1, 1, 1, 0},
-{-1,-1, 1, 1, 0, 1, 0, 1,-1},
-{-1, 0,-1,-1,-1,-1,-1,-1, 0},
-{-1, 0,-1,-1,-1,-1,-1, 1, 0},
-{-1, 0,-1,-1,-1, 1, 1, 1, 0},
-{-1, 0,-1, 1,-1,-1, 1,-1, 0},
-{-1, 0,-1, 1,-1, 1,-1,-1, 0},
-{-1, 0,-1, 1,-1, 1,-1, 1, 0},
-{-1, 0, 1,-1,-1,-1,-1,-1, 0},
-{-1, 0, 1,-1,-1, 1, 1,-1, 0},
-{-1, 0, 1,-1,-1, 1, 1, 1, 0},
-{-1, 0, 1, 1,-1,-1, 1,-1, 0},
-{-1, 0, 1, 1,-1,-1, 1, 1, 0},
-{-1, 0, 1, 1,-1, 1,-1, 1, 0},
-{-1, 1,-1,-1, 0, 1, 0, 1,-1},
-{-1, 1,-1, 0,-1,-1,-1, 1, 0},
-{-1, 1,-1, 0,-1, 1,-1, 1, 0},
-{-1, 1,-1, 0,-1, 1, 1, 1, 0},
-{-1, 1,-1, 1, 0, 1, 0,-1,-1},
-{-1, 1,-1, 1, 0, 1, 0, 1,-1},
-{-1, 1, 0,-1, 0,-1,-1,-1,-1},
-{-1, 1, 0,-1, 0, 1, 1, 1,-1},
-{-1, 1, 0, 1, 0,-1,-1, 1,-1},
-{-1, 1, 0, 1, 0,-1, 1,-1,-1},
-{-1, 1, 0, 1, 0, 1,-1, 1,-1},
-{-1, 1, 0, 1, 0, 1, 1,-1,-1},
-{-1, 1, 1,-1, 0,-1, 0,-1,-1},
-{-1, 1, 1, 0,-1,-1,-1,-1, 0},
-{-1, 1, 1, 0,-1,-1, 1,-1, 0},
-{-1, 1, 1, 0,-1, 1, 1,-1, 0},
-{-1, 1, 1, 1, 0,-1, 0,-1,-1},
-{-1, 1, 1, 1, 0,-1, 0, 1,-1},
-{ 0,-1,-1,-1,-1,-1,-1, 0,-1},
-{ 0,-1,-1,-1,-1,-1, 1, 0,-1},
-{ 0,-1,-1,-1,-1, 0,-1,-1,-1},
-{ 0,-1,-1,-1,-1, 0, 1, 1,-1},
-{ 0,-1,-1, 1,-1, 0,-1,-1,-1},
-{ 0,-1,-1, 1,-1, 1,-1, 0,-1},
-{ 0,-1, 1,-1,-1, 0,-1,-1,-1},
-{ 0,-1, 1,-1,-1, 0, 1, 1,-1},
-{ 0,-1, 1,-1,-1, 1,-1, 0,-1},
-{ 0,-1, 1,-1,-1, 1, 1, 0,-1},
-{ 0,-1, 1, 1,-1,-1, 1, 0,-1},
-{ 0,-1, 1, 1,-1, 0, 1, 1,-1},
-{ 0, 1,-1,-1,-1,-1,-1, 0,-1},
-{ 0, 1,-1,-1,-1, 0,-1, 1,-1},
-{ 0, 1,-1, 1,-1, 0,-1, 1,-1},
-{ 0, 1,-1, 1,-1, 0, 1,-1,-1},
-{ 0, 1,-1, 1,-1, 1,-1, 0,-1},
-{ 0, 1,-1, 1,-1, 1, 1, 0,-1},
-{ 0, 1, 1,-1,-1, 0, 1,-1,-1},
-{ 0, 1, 1,-1,-1, 1, 1, 0,-1},
-{ 0, 1, 1, 1,-1,-1,-1, 0,-1},
-{ 0, 1, 1, 1,-1,-1, 1, 0,-1},
-{ 0, 1, 1, 1,-1, 0,-1, 1,-1},
-{ 0, 1, 1, 1,-1, 0, 1,-1,-1},
-{-1,-1,-1,-1,-1, 0,-1, 0,-1},
-{-1,-1,-1,-1,-1, 0, 0, 1,-1},
-{-1,-1,-1, 0,-1, 1,-1, 0,-1},
-{-1,-1, 0,-1,-1,-1, 0,-1,-1},
-{-1,-1, 0,-1,-1,-1, 1, 0,-1},
-{-1,-1, 0,-1,-1, 1,-1, 0,-1},
-{-1,-1, 0,-1,-1, 1, 0, 1,-1},
-{-1,-1, 0, 0,-1,-1, 1,-1,-1},
-{-1,-1, 0, 0,-1, 1,-1, 1,-1},
-{-1,-1, 1,-1,-1, 0, 0,-1,-1},
-{-1,-1, 1,-1,-1, 0, 1, 0,-1},
-{-1,-1, 1, 0,-1,-1, 1, 0,-1},
-{-1, 0,-1,-1,-1, 0,-1, 1,-1},
-{-1, 0,-1,-1,-1, 1, 0, 1,-1},
-{-1, 0,-1, 0,-1,-1,-1,-1,-1},
-{-1, 0,-1, 0,-1, 1,-1, 1,-1},
-{-1, 0,-1, 1,-1,-1, 0,-1,-1},
-{-1, 0,-1, 1,-1, 0,-1,-1,-1},
-{-1, 0, 1,-1,-1,-1, 0,-1,-1},
-{-1, 0, 1,-1,-1, 0, 1,-1,-1},
-{-1, 0, 1, 0,-1,-1, 1,-1,-1},
-{-1, 0, 1, 0,-1, 1, 1, 1,-1},
-{-1, 0, 1, 1,-1, 0, 1, 1,-1},
-{-1, 0, 1, 1,-1, 1, 0, 1,-1},
-{-1, 1,-1, 0,-1,-1,-1, 0,-1},
-{-1, 1,-1, 1,-1, 0,-1, 0,-1},
-{-1, 1,-1, 1,-1, 0, 0,-1,-1},
-{-1, 1, 0, 0,-1,-1,-1,-1,-1},
-{-1, 1, 0, 0,-1, 1, 1, 1,-1},
-{-1, 1, 0, 1,-1,-1,-1, 0,-1},
-{-1, 1, 0, 1,-1,-1, 0,-1,-1},
-{-1, 1, 0, 1,-1, 1, 0, 1,-1},
-{-1, 1, 0, 1,-1, 1, 1, 0,-1},
-{-1, 1, 1, 0,-1, 1, 1, 0,-1},
-{-1, 1, 1, 1,-1, 0, 0, 1,-1},
-{-1, 1, 1, 1,-1, 0, 1, 0,-1},
-};
+// Largest squared distance |N - I|^2 of a neighbourhood matrix from the identity
+#define MAX_NEIGHBOURHOOD_RADIUS 16
 
-#endif
+// The unimodular neighbourhood consists of all 3x3 matrices N with entries in
+// {-1, 0, 1} and det(N) = 1, ordered by their squared Frobenius distance from
+// the identity (and then lexicographically).  The matrices within a squared
+// distance r of the identity therefore form a prefix of the table.
+const int8_t (*unimodular_neighbourhood())[9];
+
+// The same table in structure-of-arrays form: entry k of matrix i is at
+// index k * unimodular_neighbourhood_size(MAX_NEIGHBOURHOOD_RADIUS) + i
+const int8_t* unimodular_neighbourhood_columns();
 
+// Number of neighbourhood matrices within squared distance radius of the identity
+int unimodular_neighbourhood_size(int radius);
+
+#endif
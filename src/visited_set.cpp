@@ -0,0 +1,97 @@
+/*MIT License
+
+Copyright (c) 2019 P. M. Larsen
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.*/
+
+#include <algorithm>
+#include "visited_set.h"
+
+
+static const size_t initial_capacity = 1 << 14;
+
+static size_t hash_key(uint64_t key)
+{
+	// splitmix64 finalizer
+	key ^= key >> 30;
+	key *= 0xbf58476d1ce4e5b9ULL;
+	key ^= key >> 27;
+	key *= 0x94d049bb133111ebULL;
+	key ^= key >> 31;
+	return (size_t)key;
+}
+
+VisitedSet::VisitedSet(uint64_t* allocations)
+	: keys(initial_capacity, 0, allocations), stamps(initial_capacity, 0, allocations), generation(1),
+	  count(0), mask(initial_capacity - 1)
+{
+}
+
+void VisitedSet::clear()
+{
+	count = 0;
+	generation++;
+	if (generation == 0)
+	{
+		// stamps have wrapped around; reset them explicitly
+		std::fill(stamps.begin(), stamps.end(), 0);
+		generation = 1;
+	}
+}
+
+bool VisitedSet::insert(uint64_t key)
+{
+	if (2 * (count + 1) > keys.size())
+		grow();
+
+	size_t i = hash_key(key) & mask;
+	while (stamps[i] == generation)
+	{
+		if (keys[i] == key)
+			return false;
+		i = (i + 1) & mask;
+	}
+
+	stamps[i] = generation;
+	keys[i] = key;
+	count++;
+	return true;
+}
+
+void VisitedSet::grow()
+{
+	counted_vector<uint64_t> old_keys(2 * keys.size(), 0, keys.get_allocator());
+	counted_vector<uint32_t> old_stamps(2 * keys.size(), 0, stamps.get_allocator());
+	old_keys.swap(keys);
+	old_stamps.swap(stamps);
+	mask = keys.size() - 1;
+
+	for (size_t j=0;j<old_keys.size();j++)
+	{
+		if (old_stamps[j] != generation)
+			continue;
+
+		size_t i = hash_key(old_keys[j]) & mask;
+		while (stamps[i] == generation)
+			i = (i + 1) & mask;
+
+		stamps[i] = generation;
+		keys[i] = old_keys[j];
+	}
+}
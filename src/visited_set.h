@@ -0,0 +1,53 @@
+/*MIT License
+
+Copyright (c) 2019 P. M. Larsen
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.*/
+
+#ifndef VISITED_SET_H
+#define VISITED_SET_H
+
+#include <cstdint>
+#include "counting_allocator.h"
+
+// Open-addressing hash set of 64-bit keys.  Slots are stamped with a
+// generation number, so that clear() takes constant time and the storage can
+// be reused across searches without reallocation.  Allocations are counted in
+// *allocations.
+class VisitedSet
+{
+public:
+	VisitedSet(uint64_t* allocations);
+
+	void clear();
+
+	// inserts key, returns false if it was already present
+	bool insert(uint64_t key);
+
+private:
+	counted_vector<uint64_t> keys;
+	counted_vector<uint32_t> stamps;
+	uint32_t generation;
+	size_t count;
+	size_t mask;
+
+	void grow();
+};
+
+#endif
@@ -0,0 +1,98 @@
+import pytest
+import numpy as np
+from numpy.testing import assert_allclose, assert_equal
+import auguste
+from auguste import symmetrize_lattice
+
+
+TOL = 1E-10
+
+
+@pytest.mark.parametrize("seed", range(3))
+def test_calculate_vectors(seed):
+    rng = np.random.RandomState(seed)
+    cells = rng.uniform(-1, 1, (4, 3, 3))
+
+    distances = auguste.calculate_vectors(cells)
+    expected = [auguste.calculate_vector(cell) for cell in cells]
+    assert distances.shape == (4, 14)
+    assert_allclose(distances, expected, atol=TOL)
+
+
+def test_calculate_vectors_strided():
+    rng = np.random.RandomState(0)
+    cells = rng.uniform(-1, 1, (3, 3, 6))[:, :, ::2]
+    out = np.zeros((3, 14))
+
+    auguste.calculate_vectors(cells, out=out)
+    expected = [auguste.calculate_vector(cell) for cell in cells]
+    assert_allclose(out, expected, atol=TOL)
+
+
+@pytest.mark.parametrize("name", auguste.names)
+def test_symmetrize_lattices(name):
+    rng = np.random.RandomState(0)
+    cells = rng.uniform(-1, 1, (3, 3, 3))
+    index = auguste.names.index(name)
+
+    distances, symmetrized, Q, L = auguste.symmetrize_lattices(cells, index)
+    for i, cell in enumerate(cells):
+        d, s, q, l = auguste.symmetrize_lattice(cell, name,
+                                                return_correspondence=True)
+        assert_allclose(distances[i], d, atol=TOL)
+        assert_allclose(symmetrized[i], s, atol=TOL)
+        assert_allclose(Q[i], q, atol=TOL)
+        assert_equal(L[i], l)
+
+
+def test_symmetrize_lattices_broadcast():
+    rng = np.random.RandomState(0)
+    cells = rng.uniform(-1, 1, (2, 1, 3, 3))
+    distances = auguste.symmetrize_lattices(cells, np.arange(14))[0]
+    assert distances.shape == (2, 14)
+    assert_allclose(distances, auguste.calculate_vectors(cells[:, 0]),
+                    atol=TOL)
+
+
+def test_invalid_type():
+    with pytest.raises(TypeError):
+        auguste.symmetrize_lattices(np.eye(3), 14)
+
+
+@pytest.mark.parametrize("num_threads", [2, 4])
+def test_num_threads(num_threads):
+    rng = np.random.RandomState(0)
+    cells = np.eye(3) + rng.uniform(-0.2, 0.2, (6, 3, 3))
+
+    previous = auguste.get_num_threads()
+    try:
+        auguste.set_num_threads(1)
+        expected = auguste.calculate_vectors(cells)
+
+        auguste.set_num_threads(num_threads)
+        assert auguste.get_num_threads() == num_threads
+        assert_equal(auguste.calculate_vectors(cells), expected)
+        assert_equal(auguste.calculate_vector(cells[0]), expected[0])
+
+        distances = auguste.symmetrize_lattices(cells[:, None], np.arange(14))[0]
+        assert_equal(distances, expected)
+    finally:
+        auguste.set_num_threads(previous)
+
+
+@pytest.mark.parametrize("name", auguste.pearson[1:])
+def test_parallel_search(name):
+    rng = np.random.RandomState(1)
+    cell = np.eye(3) + rng.uniform(-0.3, 0.3, (3, 3))
+
+    previous = auguste.get_num_threads()
+    try:
+        auguste.set_num_threads(4)
+        expected = symmetrize_lattice(cell, name, return_correspondence=True)
+        result = symmetrize_lattice(cell, name, return_correspondence=True,
+                                    parallel=True)
+    finally:
+        auguste.set_num_threads(previous)
+
+    for a, b in zip(result, expected):
+        assert_equal(a, b)
@@ -1,3 +1,7 @@
+import os
+import subprocess
+import sys
+import threading
 import pytest
 import numpy as np
 import scipy.linalg
@@ -94,3 +98,333 @@ def test_calculate_vector_basis_invariance(name, cell):
     distancesL = auguste.calculate_vector(cellL)
     distances = auguste.calculate_vector(cell)
     assert_allclose(distances, distancesL, atol=TOL)
+
+
+@pytest.mark.parametrize("cell", [np.zeros((3, 3)), [[1, 0, 0], [0, 1, 0], [1, 1, 0]]])
+def test_singular_basis(cell):
+    with pytest.raises(TypeError, match="singular"):
+        symmetrize_lattice(cell, "primitive cubic")
+    with pytest.raises(TypeError, match="singular"):
+        auguste.calculate_vector(cell)
+    with pytest.raises(TypeError, match="singular"):
+        auguste.calculate_vectors([np.eye(3), cell])
+
+
+@pytest.mark.parametrize("name, cell", input_data.items())
+def test_adaptive_neighbourhood(name, cell):
+    inputL = np.array([[1, 2, 3], [0, 1, 0], [0, 0, 1]])
+    cellL = (cell.T @ inputL.T).T
+
+    distance, symmetrized, info = symmetrize_lattice(cellL, name,
+                                                     adaptive=True,
+                                                     return_info=True)
+    assert distance < TOL
+    assert_allclose(symmetrized, cellL, atol=TOL)
+    assert 0 <= info["radius"] <= 16
+    assert info["rounds"] >= 1
+    assert info["evaluated"] >= 1
+
+
+def test_neighbourhood_radius():
+    rng = np.random.RandomState(0)
+    cell = rng.uniform(-1, 1, (3, 3))
+    name = "primitive hexagonal"
+
+    expected = symmetrize_lattice(cell, name)
+    result = symmetrize_lattice(cell, name, radius=16, max_rounds=40)
+    assert_allclose(result[0], expected[0], atol=0)
+
+    previous = np.inf
+    for radius in [0, 2, 4, 8, 16]:
+        distance, _, info = symmetrize_lattice(cell, name, radius=radius,
+                                               max_rounds=1, return_info=True)
+        assert info["rounds"] == 1
+        assert distance <= previous
+        previous = distance
+
+    with pytest.raises(ValueError):
+        symmetrize_lattice(cell, name, radius=17)
+    with pytest.raises(ValueError):
+        symmetrize_lattice(cell, name, max_rounds=0)
+
+
+def test_warm_start():
+    rng = np.random.RandomState(1)
+    for name in ["primitive hexagonal", "base-centred monoclinic"]:
+        cell = rng.uniform(-1, 1, (3, 3))
+        cold = symmetrize_lattice(cell, name, return_info=True)
+        warm = symmetrize_lattice(cell, name, warm_start=True,
+                                  return_info=True)
+        assert_allclose(warm[0], cold[0], atol=1E-10)
+        assert warm[2]["evaluated"] == cold[2]["evaluated"]
+        assert cold[2]["restarts"] == 0
+        assert warm[2]["stepwise_iterations"] > 0
+        # two-coefficient types are solved without the SQP stage
+        if name == "primitive hexagonal":
+            assert warm[2]["newton_iterations"] == 0
+        else:
+            assert warm[2]["newton_iterations"] > 0
+
+
+def test_iteration_counts():
+    rng = np.random.RandomState(2)
+    cell = rng.uniform(-1, 1, (3, 3))
+    info = symmetrize_lattice(cell, "primitive monoclinic",
+                              return_info=True)[2]
+    assert 0 < info["accelerated_steps"] <= info["stepwise_iterations"]
+    assert info["newton_iterations"] > 0
+
+
+@pytest.mark.parametrize("seed", range(3))
+def test_best_first(seed):
+    rng = np.random.RandomState(seed)
+    cell = rng.uniform(-1, 1, (3, 3))
+    for name in ["primitive monoclinic", "primitive hexagonal",
+                 "face-centred cubic"]:
+        expected, _, expected_info = symmetrize_lattice(cell, name,
+                                                        return_info=True)
+        distance, symmetrized, Q, L, info = symmetrize_lattice(
+            cell, name, strategy="best-first", return_correspondence=True,
+            return_info=True)
+        assert_allclose(distance, expected, atol=1E-9)
+        assert round(abs(np.linalg.det(L))) == 1
+        assert info["rounds"] >= 1
+
+        limited = symmetrize_lattice(cell, name, strategy="best-first",
+                                     max_rounds=1, return_info=True)
+        assert limited[2]["rounds"] == 1
+        assert limited[0] >= distance - 1E-9
+
+    with pytest.raises(ValueError):
+        symmetrize_lattice(cell, "primitive cubic", strategy="depth-first")
+
+
+@pytest.mark.parametrize("strategy", ["hill-climb", "best-first"])
+def test_prefilter(strategy):
+    rng = np.random.RandomState(0)
+    num_verified = 0
+    for cell in rng.uniform(-1, 1, (4, 3, 3)):
+        for name in auguste.names[1:]:
+            expected = symmetrize_lattice(cell, name, strategy=strategy,
+                                          return_info=True)
+            assert expected[2]["verified"]
+
+            distance, _, info = symmetrize_lattice(cell, name,
+                                                   strategy=strategy,
+                                                   prefilter=4,
+                                                   return_info=True)
+            assert distance >= expected[0] - 1E-9
+            if info["verified"]:
+                assert_allclose(distance, expected[0], atol=1E-10)
+                assert info["evaluated"] <= expected[2]["evaluated"]
+                num_verified += 1
+    assert num_verified > 0
+
+    cell = rng.uniform(-1, 1, (3, 3))
+    distances, verified = auguste.calculate_vector(cell, prefilter=4,
+                                                   return_verified=True)
+    assert verified.dtype == bool and verified.shape == (14,)
+    exhaustive = auguste.calculate_vector(cell)
+    assert_allclose(distances[verified], exhaustive[verified], atol=1E-10)
+
+    with pytest.raises(ValueError):
+        symmetrize_lattice(cell, "primitive cubic", prefilter=-1)
+
+
+def test_single_precision():
+    rng = np.random.RandomState(0)
+    num_exact = 0
+    num_total = 0
+    for cell in rng.uniform(-1, 1, (4, 3, 3)):
+        for name in auguste.names[1:]:
+            expected = symmetrize_lattice(cell, name)[0]
+            distance, symmetrized, info = symmetrize_lattice(
+                cell, name, precision="single", validate=True,
+                return_info=True)
+            assert_allclose(distance - info["validation_difference"],
+                            expected, atol=1E-12)
+            assert distance >= expected - 1E-9
+            assert_allclose(distance, expected, atol=1E-4)
+            num_exact += abs(distance - expected) < 1E-10
+            num_total += 1
+    # the result is re-optimized in double precision
+    assert num_exact > 0.9 * num_total
+
+    cell = rng.uniform(-1, 1, (3, 3))
+    distances, differences = auguste.calculate_vector(cell, precision="single",
+                                                      validate=True)
+    exact = auguste.calculate_vector(cell)
+    assert_allclose(distances - differences, exact, atol=1E-12)
+
+    with pytest.raises(ValueError):
+        symmetrize_lattice(cell, "primitive cubic", precision="half")
+    with pytest.raises(ValueError):
+        auguste.calculate_vector(cell, validate=True)
+
+
+def test_polar_decompose():
+    rng = np.random.RandomState(0)
+    F = rng.normal(size=(100, 3, 3))
+    F[:3] = [np.eye(3), -np.eye(3), np.zeros((3, 3))]
+    U, P = auguste.polar_decompose(F)
+    assert U.shape == P.shape == F.shape
+    for f, u, p in zip(F[1:], U[1:], P[1:]):
+        expected_u, expected_p = scipy.linalg.polar(f)
+        assert_allclose(u, expected_u, atol=TOL)
+        assert_allclose(p, expected_p, atol=TOL)
+    assert_allclose(U[0], np.eye(3), atol=TOL)
+
+    # reflections are returned for matrices with negative determinants
+    dets = np.linalg.det(U)
+    assert_allclose(np.abs(dets), 1, atol=TOL)
+    assert dets[1] < 0
+    assert (np.sign(dets[3:]) == np.sign(np.linalg.det(F[3:]))).all()
+
+    # non-contiguous input
+    Ut, Pt = auguste.polar_decompose(np.transpose(F, (0, 2, 1)))
+    assert_allclose(Ut @ Pt, np.transpose(F, (0, 2, 1)), atol=TOL)
+    assert_allclose(Ut[3:], np.transpose(U[3:], (0, 2, 1)), atol=TOL)
+
+    # float32 input is decomposed in single precision
+    Uf, Pf = auguste.polar_decompose(F.astype(np.float32))
+    assert Uf.dtype == Pf.dtype == np.float32
+    assert_allclose(Uf[3:], U[3:], atol=1E-4)
+    assert_allclose(Pf[3:], P[3:], atol=1E-4)
+
+
+ISA_SCRIPT = """
+import sys
+import numpy as np
+import auguste
+rng = np.random.RandomState(0)
+cells = rng.uniform(-1, 1, (8, 3, 3))
+F = rng.normal(size=(20, 3, 3))
+U, P = auguste.polar_decompose(F)
+Uf, Pf = auguste.polar_decompose(F.astype(np.float32))
+np.savez(sys.argv[1], isa=auguste.get_isa(), vectors=auguste.calculate_vectors(cells),
+         U=U, P=P, Uf=Uf, Pf=Pf)
+"""
+
+
+@pytest.mark.parametrize("isa", ["baseline", "avx2", "avx512", "unknown"])
+def test_isa_variants(isa, tmp_path):
+    path = str(tmp_path / "result.npz")
+    env = dict(os.environ, AUGUSTE_ISA=isa)
+    subprocess.check_call([sys.executable, "-c", ISA_SCRIPT, path], env=env)
+    result = np.load(path)
+
+    # an unsupported variant falls back to the best one supported, and
+    # AVX-512 is used only on request
+    names = ["baseline", "avx2", "avx512"]
+    selected = str(result["isa"])
+    assert selected in names
+    if isa in names:
+        assert names.index(selected) <= names.index(isa)
+    else:
+        assert selected == auguste.get_isa()
+    assert auguste.get_isa() != "avx512" or "AUGUSTE_ISA" in os.environ
+
+    # variants differ only in rounding
+    rng = np.random.RandomState(0)
+    cells = rng.uniform(-1, 1, (8, 3, 3))
+    F = rng.normal(size=(20, 3, 3))
+    U, P = auguste.polar_decompose(F)
+    Uf, Pf = auguste.polar_decompose(F.astype(np.float32))
+    assert_allclose(result["vectors"], auguste.calculate_vectors(cells), atol=1E-10)
+    assert_allclose(result["U"], U, atol=1E-10)
+    assert_allclose(result["P"], P, atol=1E-10)
+    assert_allclose(result["Uf"], Uf, atol=1E-5)
+    assert_allclose(result["Pf"], Pf, atol=1E-5)
+
+
+def test_workspace():
+    rng = np.random.RandomState(0)
+    cells = rng.uniform(-1, 1, (4, 3, 3))
+    workspace = auguste.Workspace()
+    assert workspace.allocations > 0
+
+    def run():
+        for cell in cells:
+            for name in auguste.names[1:]:
+                for kwargs in [{}, dict(strategy="best-first"),
+                               dict(precision="single", validate=True)]:
+                    result = symmetrize_lattice(cell, name, workspace=workspace,
+                                                return_correspondence=True, **kwargs)
+                    expected = symmetrize_lattice(cell, name, return_correspondence=True,
+                                                  **kwargs)
+                    assert result[0] == expected[0]
+                    assert (result[3] == expected[3]).all()
+
+    # once grown, the buffers are reused without allocating
+    run()
+    allocations = workspace.allocations
+    run()
+    assert workspace.allocations == allocations
+
+    # a workspace created without __init__ is still usable
+    uninitialized = auguste.Workspace.__new__(auguste.Workspace)
+    assert uninitialized.allocations > 0
+    symmetrize_lattice(cells[0], "primitive cubic", workspace=uninitialized)
+
+    with pytest.raises(TypeError):
+        symmetrize_lattice(cells[0], "primitive cubic", workspace=1)
+
+    # the extension as a whole makes no allocations either, which only a
+    # test build (with AUGUSTE_COUNT_ALLOCATIONS set) can count
+    if not hasattr(auguste, "_get_heap_allocations"):
+        pytest.skip("built without AUGUSTE_COUNT_ALLOCATIONS")
+
+    before = auguste._get_heap_allocations()
+    run()
+    assert auguste._get_heap_allocations() == before
+
+    # on one thread, so that the same workspaces serve both calls
+    num_threads = auguste.get_num_threads()
+    auguste.set_num_threads(1)
+    try:
+        auguste.calculate_vectors(cells)
+        before = auguste._get_heap_allocations()
+        auguste.calculate_vectors(cells)
+        auguste.calculate_vector(cells[0])
+        assert auguste._get_heap_allocations() == before
+    finally:
+        auguste.set_num_threads(num_threads)
+
+
+@pytest.mark.parametrize("call", [
+    lambda cells: symmetrize_lattice(cells[0], "primitive cubic"),
+    lambda cells: auguste.calculate_vector(cells[0]),
+    lambda cells: auguste.calculate_vectors(cells),
+    lambda cells: auguste.symmetrize_lattices(cells, 1),
+    lambda cells: auguste.Workspace(),
+])
+def test_out_of_memory(call):
+    # allocation failures are raised as MemoryError, not left to unwind
+    # through NumPy or the thread pool
+    if not hasattr(auguste, "_fail_heap_allocations"):
+        pytest.skip("built without AUGUSTE_COUNT_ALLOCATIONS")
+
+    cells = np.random.RandomState(0).uniform(-1, 1, (4, 3, 3))
+    errors = []
+
+    def run():
+        # a new thread has no search workspaces or buffers yet, so it must
+        # allocate them
+        auguste._fail_heap_allocations(0)
+        try:
+            call(cells)
+        except MemoryError as e:
+            errors.append(e)
+        finally:
+            auguste._fail_heap_allocations(-1)
+
+    num_threads = auguste.get_num_threads()
+    auguste.set_num_threads(1)
+    try:
+        thread = threading.Thread(target=run)
+        thread.start()
+        thread.join()
+    finally:
+        auguste.set_num_threads(num_threads)
+    assert len(errors) == 1
+    call(cells)
@@ -0,0 +1,128 @@
+import threading
+import pytest
+import numpy as np
+from numpy.testing import assert_allclose, assert_equal
+import auguste
+
+
+TOL = 1E-10
+
+
+def trajectory(base, num_frames, seed=0):
+    rng = np.random.RandomState(seed)
+    frames = []
+    for k in range(num_frames):
+        t = k / num_frames
+        D = np.eye(3) + 0.05 * np.array([[np.sin(3 * t), 0.5 * t, 0],
+                                         [0, np.cos(5 * t) - 1, 0.3 * t],
+                                         [0.2 * np.sin(7 * t), 0, 0]])
+        frames.append(base @ D + rng.normal(0, 0.002, (3, 3)))
+    return frames
+
+
+def test_first_frame():
+    rng = np.random.RandomState(0)
+    cell = rng.uniform(-1, 1, (3, 3))
+
+    tracker = auguste.Tracker()
+    assert_allclose(tracker.calculate_vector(cell),
+                    auguste.calculate_vector(cell), atol=TOL)
+
+    for name in auguste.names:
+        tracker = auguste.Tracker()
+        result = tracker.symmetrize_lattice(cell, name,
+                                            return_correspondence=True)
+        expected = auguste.symmetrize_lattice(cell, name,
+                                              return_correspondence=True)
+        assert_allclose(result[0], expected[0], atol=TOL)
+        assert_allclose(result[1], expected[1], atol=TOL)
+        assert_equal(result[3], expected[3])
+
+
+def test_singular_triclinic():
+    # a triclinic cell is not reduced, so a singular basis is accepted as by
+    # auguste.symmetrize_lattice
+    cell = [[1, 0, 0], [0, 1, 0], [1, 1, 0]]
+    result = auguste.Tracker().symmetrize_lattice(cell, "triclinic")
+    expected = auguste.symmetrize_lattice(cell, "triclinic")
+    assert_allclose(result[0], expected[0], atol=TOL)
+    assert_allclose(result[1], expected[1], atol=TOL)
+
+
+@pytest.mark.parametrize("name", ["primitive hexagonal",
+                                  "primitive tetragonal",
+                                  "face-centred cubic"])
+def test_trajectory(name):
+    tolerance = 0.01
+    base = {"primitive hexagonal": [[1, 0, 0], [-0.5, 0.866, 0], [0, 0, 1.6]],
+            "primitive tetragonal": [[1, 0, 0], [0, 1, 0], [0, 0, 1.3]],
+            "face-centred cubic": [[0, 1, 1], [1, 0, 1], [1, 1, 0]]}[name]
+    frames = trajectory(np.array(base), 40)
+
+    tracker = auguste.Tracker(tolerance=tolerance)
+    num_tracked = 0
+    for cell in frames:
+        distance, _, info = tracker.symmetrize_lattice(cell, name,
+                                                       return_info=True)
+        expected, _ = auguste.symmetrize_lattice(cell, name)
+        assert distance < expected + 2 * tolerance
+        num_tracked += info["radius"] <= 2
+    assert num_tracked > len(frames) / 2
+
+
+def test_reset():
+    frames = trajectory(np.eye(3), 5)
+    tracker = auguste.Tracker()
+    for cell in frames:
+        tracker.calculate_vector(cell)
+
+    tracker.reset()
+    assert_allclose(tracker.calculate_vector(frames[0]),
+                    auguste.calculate_vector(frames[0]), atol=TOL)
+
+
+def test_uninitialized():
+    # a tracker created without __init__ has the default options
+    frames = trajectory(np.eye(3), 10)
+    tracker = auguste.Tracker()
+    uninitialized = auguste.Tracker.__new__(auguste.Tracker)
+    for cell in frames:
+        expected = tracker.symmetrize_lattice(cell, "primitive cubic",
+                                              return_info=True)
+        result = uninitialized.symmetrize_lattice(cell, "primitive cubic",
+                                                  return_info=True)
+        assert_allclose(result[0], expected[0], atol=TOL)
+        assert_allclose(result[1], expected[1], atol=TOL)
+        assert result[2] == expected[2]
+
+
+def test_concurrent_use():
+    frames = trajectory(np.eye(3), 20)
+    tracker = auguste.Tracker()
+    done = threading.Event()
+
+    def worker():
+        for _ in range(50):
+            for cell in frames:
+                tracker.calculate_vector(cell)
+        done.set()
+
+    thread = threading.Thread(target=worker)
+    thread.start()
+    raised = False
+    while not done.is_set() and not raised:
+        try:
+            tracker.reset()
+        except RuntimeError:
+            raised = True
+    thread.join()
+    assert raised
+
+
+def test_invalid_arguments():
+    with pytest.raises(ValueError):
+        auguste.Tracker(radius=17)
+    with pytest.raises(ValueError):
+        auguste.Tracker(tolerance=-1)
+    with pytest.raises(TypeError):
+        auguste.Tracker().symmetrize_lattice(np.eye(3), "hexagonal cubic")